@@ -0,0 +1,567 @@
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cgtub/primitives.hpp>
+
+#include "camera_batch.hpp"
+#include "command_line.hpp"
+#include "frame_cache.hpp"
+#include "helper.hpp"
+#include "instancing.hpp"
+#include "lod.hpp"
+#include "mesh_loader.hpp"
+#include "mesh_optimizer.hpp"
+#include "meshlet.hpp"
+#include "session_trace.hpp"
+#include "simd_transform.hpp"
+#include "software_rasterizer.hpp"
+#include "thread_pool.hpp"
+#include "transform_pipeline.hpp"
+#include "triangle_clipper.hpp"
+
+namespace ex2
+{
+
+namespace
+{
+
+// Upper bounds of the numeric options; the instance count matches the slider of the GUI
+constexpr size_t       max_iterations = size_t(1) << 24;
+constexpr unsigned int max_mesh_scale = 1024;
+constexpr int          max_instances  = 16384;
+
+struct BenchmarkOptions
+{
+    size_t       iterations = 1000;
+    unsigned int mesh_scale = 1;
+    std::string  mesh;
+    std::string  output;
+    std::string  replay;
+    int          threads   = -1;
+    int          instances = 0;
+    bool         optimize  = false;
+};
+
+bool parse_options(int argc, char** argv, BenchmarkOptions* options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+
+        if (std::strcmp(argv[i], "--benchmark") == 0)
+            continue;
+        else if (std::strcmp(argv[i], "--iterations") == 0 && has_value)
+        {
+            if (!parse_option_value("--iterations", argv[++i], size_t(1), max_iterations, &options->iterations))
+                return false;
+        }
+        else if (std::strcmp(argv[i], "--mesh-scale") == 0 && has_value)
+        {
+            if (!parse_option_value("--mesh-scale", argv[++i], 1u, max_mesh_scale, &options->mesh_scale))
+                return false;
+        }
+        else if (std::strcmp(argv[i], "--mesh") == 0 && has_value)
+            options->mesh = argv[++i];
+        else if (std::strcmp(argv[i], "--threads") == 0 && has_value)
+        {
+            unsigned int threads = 0;
+            if (!parse_option_value("--threads", argv[++i], 0u, max_worker_count, &threads))
+                return false;
+            options->threads = static_cast<int>(threads);
+        }
+        else if (std::strcmp(argv[i], "--instances") == 0 && has_value)
+        {
+            if (!parse_option_value("--instances", argv[++i], 0, max_instances, &options->instances))
+                return false;
+        }
+        else if (std::strcmp(argv[i], "--optimize") == 0)
+            options->optimize = true;
+        else if (std::strcmp(argv[i], "--replay") == 0 && has_value)
+            options->replay = argv[++i];
+        else if (std::strcmp(argv[i], "--output") == 0 && has_value)
+            options->output = argv[++i];
+        else
+        {
+            std::cerr << "Unknown or incomplete option: " << argv[i] << std::endl;
+            return false;
+        }
+    }
+
+    return options->iterations > 0 && options->mesh_scale > 0;
+}
+
+/**
+ * Replace the mesh by \c copies slightly shifted copies of itself, so per-vertex costs can be measured on larger meshes.
+ */
+void replicate_mesh(unsigned int copies, std::vector<glm::vec3>* positions, std::vector<glm::u32vec3>* indices)
+{
+    size_t vertex_count   = positions->size();
+    size_t triangle_count = indices->size();
+
+    positions->resize(vertex_count * copies);
+    indices->resize(triangle_count * copies);
+
+    for (unsigned int c = 1; c < copies; c++)
+    {
+        glm::vec3 offset = 1e-3f * glm::vec3(static_cast<float>(c % 7), static_cast<float>(c % 11), static_cast<float>(c % 13));
+        uint32_t  base   = static_cast<uint32_t>(c * vertex_count);
+
+        for (size_t i = 0; i < vertex_count; i++)
+            (*positions)[base + i] = (*positions)[i] + offset;
+        for (size_t i = 0; i < triangle_count; i++)
+            (*indices)[c * triangle_count + i] = (*indices)[i] + glm::u32vec3(base);
+    }
+}
+
+struct Stage
+{
+    char const*         name;
+    size_t              vertices;
+    std::vector<double> samples_ns;
+    size_t              triangles = 0; //!< Triangles drawn per sample, for stages that rasterize
+};
+
+class StageTimer
+{
+public:
+    explicit StageTimer(Stage* stage)
+        : m_stage(stage), m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~StageTimer()
+    {
+        auto end = std::chrono::steady_clock::now();
+        m_stage->samples_ns.push_back(std::chrono::duration<double, std::nano>(end - m_start).count());
+    }
+
+private:
+    Stage*                                m_stage;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+void write_report(std::ostream& out, BenchmarkOptions const& options, size_t mesh_vertices, size_t mesh_triangles, MeshOptimizationReport const& vertex_cache,
+                  std::vector<Stage>& stages, double checksum)
+{
+    out << "{\n";
+    out << "  \"iterations\": " << options.iterations << ",\n";
+    out << "  \"mesh_scale\": " << options.mesh_scale << ",\n";
+    out << "  \"mesh_vertices\": " << mesh_vertices << ",\n";
+    out << "  \"mesh_triangles\": " << mesh_triangles << ",\n";
+    out << "  \"vertex_cache\": {\"optimized\": " << (options.optimize ? "true" : "false")
+        << ", \"acmr_before\": " << vertex_cache.before.acmr << ", \"acmr_after\": " << vertex_cache.after.acmr
+        << ", \"atvr_before\": " << vertex_cache.before.atvr << ", \"atvr_after\": " << vertex_cache.after.atvr << "},\n";
+    out << "  \"isa\": \"" << simd::isa_name(simd::active_isa()) << "\",\n";
+    out << "  \"threads\": " << default_thread_pool().worker_count() + 1 << ",\n";
+    out << "  \"stages\": [\n";
+
+    for (size_t s = 0; s < stages.size(); s++)
+    {
+        std::vector<double>& samples = stages[s].samples_ns;
+        std::sort(samples.begin(), samples.end());
+
+        double total = 0.0;
+        for (double sample : samples)
+            total += sample;
+
+        double mean = total / static_cast<double>(samples.size());
+        double p50  = samples[samples.size() / 2];
+        double p99  = samples[std::min(samples.size() - 1, samples.size() * 99 / 100)];
+
+        out << "    {\"name\": \"" << stages[s].name << "\""
+            << ", \"vertices\": " << stages[s].vertices
+            << ", \"mean_ns\": " << mean
+            << ", \"p50_ns\": " << p50
+            << ", \"p99_ns\": " << p99;
+
+        if (stages[s].vertices > 0)
+        {
+            double ns_per_vertex = mean / static_cast<double>(stages[s].vertices);
+            out << ", \"ns_per_vertex\": " << ns_per_vertex
+                << ", \"vertices_per_second\": " << 1e9 / ns_per_vertex;
+        }
+        if (stages[s].triangles > 0)
+        {
+            out << ", \"triangles\": " << stages[s].triangles
+                << ", \"triangles_per_second\": " << 1e9 * static_cast<double>(stages[s].triangles) / mean;
+        }
+
+        out << "}" << (s + 1 < stages.size() ? "," : "") << "\n";
+    }
+
+    out << "  ],\n";
+    out << "  \"checksum\": " << checksum << "\n";
+    out << "}\n";
+}
+
+/**
+ * Replay a recorded session through a \c FrameCache, as the main loop does, and time every frame.
+ *
+ * The session is replayed once to warm up and once measured, each time with a new cache, so both passes do the same work.
+ * Without canvases, only \c FrameCache::update(...) is timed, so the update and frame times are the same.
+ */
+bool replay_session(BenchmarkOptions const& options, MeshView mesh, std::span<glm::vec3 const> axes_positions, std::vector<FrameTiming>* timings)
+{
+    SessionTrace trace;
+    if (!load_session_trace(options.replay, &trace))
+        return false;
+
+    MeshletMesh meshlets;
+    build_meshlets(mesh, &meshlets);
+
+    InstanceSettings       instance_settings;
+    std::vector<glm::mat4> instance_models;
+    if (options.instances > 0)
+    {
+        instance_settings.count = options.instances;
+        generate_instance_models(instance_settings, &instance_models);
+    }
+
+    timings->assign(trace.frames.size(), FrameTiming());
+    for (int pass = 0; pass < 2; pass++)
+    {
+        FrameCache cache(mesh, axes_positions);
+        cache.set_meshlets(&meshlets);
+        cache.set_instances(instance_models);
+
+        for (size_t i = 0; i < trace.frames.size(); i++)
+        {
+            SessionFrame const& frame = trace.frames[i];
+
+            auto start = std::chrono::steady_clock::now();
+            cache.update(frame.parameters, frame.changes);
+            auto end = std::chrono::steady_clock::now();
+
+            double elapsed_ns = std::chrono::duration<double, std::nano>(end - start).count();
+            (*timings)[i]     = {frame.changes, elapsed_ns, elapsed_ns};
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+bool benchmark_requested(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--benchmark") == 0)
+            return true;
+    }
+    return false;
+}
+
+int run_benchmark(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    if (!parse_options(argc, argv, &options))
+    {
+        std::cerr << "Usage: " << argv[0] << " --benchmark [--iterations N] [--mesh FILE] [--mesh-scale K] [--threads N] [--instances N] [--optimize] [--replay TRACE] [--output FILE]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (options.threads >= 0)
+        configure_default_thread_pool(static_cast<unsigned int>(options.threads));
+
+    std::vector<glm::vec3>    mesh_positions;
+    std::vector<glm::u32vec3> mesh_indices;
+    if (options.mesh.empty())
+        create_bunny_geometry(&mesh_positions, &mesh_indices);
+    else
+    {
+        Mesh mesh;
+        if (!load_mesh(options.mesh, &mesh))
+            return EXIT_FAILURE;
+        mesh_positions = std::move(mesh.positions);
+        mesh_indices   = std::move(mesh.indices);
+    }
+    replicate_mesh(options.mesh_scale, &mesh_positions, &mesh_indices);
+
+    // Without --optimize, the statistics before and after are those of the mesh as loaded
+    MeshOptimizationReport vertex_cache;
+    if (options.optimize)
+        vertex_cache = optimize_mesh(&mesh_positions, mesh_indices);
+    else
+    {
+        vertex_cache.triangles       = mesh_indices.size();
+        vertex_cache.vertices_before = vertex_cache.vertices_after = mesh_positions.size();
+        vertex_cache.before = vertex_cache.after = analyze_vertex_cache(mesh_indices, mesh_positions.size());
+    }
+
+    std::vector<glm::vec3>    sphere_positions;
+    std::vector<glm::u32vec3> sphere_indices;
+    cgtub::create_sphere_geometry(0.03f, &sphere_positions, &sphere_indices);
+
+    glm::vec3 const axes_positions[] = {{0, 0, 0}, {1, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 1}};
+
+    if (!options.replay.empty())
+    {
+        std::vector<FrameTiming> timings;
+        if (!replay_session(options, {mesh_positions, mesh_indices}, axes_positions, &timings))
+            return EXIT_FAILURE;
+
+        if (options.output.empty())
+        {
+            write_frame_timings(std::cout, timings, UpdateSpan::FrameCache);
+            return EXIT_SUCCESS;
+        }
+
+        std::ofstream file(options.output);
+        if (!file)
+        {
+            std::cerr << "Could not open " << options.output << " for writing" << std::endl;
+            return EXIT_FAILURE;
+        }
+        write_frame_timings(file, timings, UpdateSpan::FrameCache);
+        return EXIT_SUCCESS;
+    }
+
+    simd::Positions            mesh_soa;
+    simd::HomogeneousPositions clip_soa;
+    simd::Positions            ndc_soa;
+    simd::to_soa(mesh_positions, &mesh_soa);
+    clip_soa.resize(mesh_soa.size());
+    ndc_soa.resize(mesh_soa.size());
+
+    QuantizedMesh quantized_mesh;
+    quantize_mesh({mesh_positions, mesh_indices}, &quantized_mesh);
+
+    TransformPipeline mesh_pipeline;
+    TransformPipeline quantized_mesh_pipeline;
+    TransformPipeline axes_pipeline;
+    TriangleClipper   mesh_clipper;
+    MeshletCuller     meshlet_culler;
+    TransformPipeline culled_mesh_pipeline;
+    LodChain          lod_chain;
+    LodSelector       lod_selector;
+    TransformPipeline lod_mesh_pipeline;
+    glm::mat4         camera_marker_model;
+    InstanceBatch     camera_marker;
+    InstanceBatch     instances;
+    Camera<float>     camera;
+    Camera<float>     view_space_camera;
+    CameraGeometry    world_camera;
+    CameraGeometry    view_camera;
+    CameraGeometry    world_camera_glm;
+    CameraGeometry    view_camera_glm;
+
+    // A sweep of cameras transformed in one pass, and the same cameras transformed in one pass each for comparison
+    CameraBatchSettings           camera_batch_settings;
+    std::vector<CameraParameters> camera_sweep;
+    CameraBatch                   camera_batch;
+    std::vector<CameraBatch>      single_camera_batches(static_cast<size_t>(camera_batch_settings.count));
+
+    MeshletMesh meshlets;
+    build_meshlets({mesh_positions, mesh_indices}, &meshlets);
+    lod_chain.build({mesh_positions, mesh_indices});
+
+    // The level of detail is selected for a canvas of the default window, which is also the size rasterized on the CPU
+    glm::vec2 const lod_viewport = glm::vec2(400.f, 400.f);
+
+    Framebuffer      raster_target(static_cast<int>(lod_viewport.x), static_cast<int>(lod_viewport.y));
+    SoftwareRenderer rasterizer(&raster_target, glm::vec4(0.f, 0.f, 1.f, 1.f));
+
+    camera_marker.set_mesh({sphere_positions, {}});
+
+    // The instanced scene uses the default layout of the GUI
+    InstanceSettings       instance_settings;
+    std::vector<glm::mat4> instance_models;
+    instance_settings.count = options.instances;
+    generate_instance_models(instance_settings, &instance_models);
+    instances.set_mesh({mesh_positions, mesh_indices});
+    instances.set_instances(instance_models);
+
+    enum StageIndex
+    {
+        Matrices = 0,
+        CameraGeometryStage,
+        CameraGeometryGlmInverse,
+        CameraMarker,
+        MeshTransform,
+        QuantizedMeshTransform,
+        TriangleClipping,
+        MeshletCulling,
+        CulledMeshTransform,
+        LodMeshTransform,
+        InstanceTransform,
+        CameraBatchTransform,
+        SingleCameraTransforms,
+        AxesTransform,
+        MeshClipNdcSimd,
+        Rasterize,
+        Frame,
+        StageCount
+    };
+
+    std::vector<Stage> stages = {
+        {"matrices", 0, {}},
+        {"camera_geometry", 0, {}},
+        {"camera_geometry_glm_inverse", 0, {}},
+        {"camera_marker", sphere_positions.size(), {}},
+        {"mesh_transform", mesh_positions.size(), {}},
+        {"quantized_mesh_transform", mesh_positions.size(), {}},
+        {"triangle_clipping", mesh_positions.size(), {}},
+        {"meshlet_culling", mesh_positions.size(), {}},
+        {"culled_mesh_transform", mesh_positions.size(), {}},
+        {"lod_mesh_transform", mesh_positions.size(), {}},
+        {"instance_transform", instances.world().positions.size(), {}},
+        {"camera_batch_transform", single_camera_batches.size() * mesh_positions.size(), {}},
+        {"single_camera_transforms", single_camera_batches.size() * mesh_positions.size(), {}},
+        {"axes_transform", std::size(axes_positions), {}},
+        {"mesh_clip_ndc_simd", mesh_positions.size(), {}},
+        {"rasterize", mesh_positions.size(), {}},
+        {"frame", mesh_positions.size() + sphere_positions.size() + std::size(axes_positions), {}},
+    };
+
+    stages[Rasterize].triangles = mesh_indices.size();
+
+    size_t warmup_iterations = std::max<size_t>(1, options.iterations / 10);
+    double checksum          = 0.0;
+
+    // Recording a sample must not allocate inside the measured region
+    for (Stage& stage : stages)
+        stage.samples_ns.reserve(std::max(warmup_iterations, options.iterations));
+
+    for (size_t i = 0; i < warmup_iterations + options.iterations; i++)
+    {
+        bool measured = i >= warmup_iterations;
+        if (i == warmup_iterations)
+        {
+            for (Stage& stage : stages)
+                stage.samples_ns.clear();
+        }
+
+        CameraParameters parameters = sweep_camera_parameters(i % options.iterations, options.iterations);
+
+        StageTimer frame_timer(&stages[Frame]);
+
+        glm::vec3 camera_origin;
+        {
+            StageTimer timer(&stages[Matrices]);
+            camera_origin = camera_position(parameters.azimuth);
+            camera.set_view(camera_view(camera_origin));
+            camera.set_projection(camera_projection(parameters));
+            view_space_camera.set_projection(camera.projection());
+        }
+        glm::mat4 const& view       = camera.view_matrix();
+        glm::mat4 const& projection = camera.projection_matrix();
+        {
+            StageTimer timer(&stages[CameraGeometryStage]);
+            compute_camera_geometry(camera, &world_camera);
+            compute_camera_geometry(view_space_camera, &view_camera);
+        }
+        {
+            // The same visualization from the bare matrices, which inverts them numerically
+            StageTimer timer(&stages[CameraGeometryGlmInverse]);
+            compute_camera_geometry(view, projection, &world_camera_glm);
+            compute_camera_geometry(glm::mat4(1.0f), projection, &view_camera_glm);
+        }
+        {
+            StageTimer timer(&stages[CameraMarker]);
+            camera_marker_model = glm::translate(glm::mat4(1.f), camera_origin);
+            camera_marker.set_instances({&camera_marker_model, 1});
+        }
+        {
+            StageTimer timer(&stages[MeshTransform]);
+            mesh_pipeline.run(mesh_positions, view, projection);
+        }
+        {
+            StageTimer timer(&stages[QuantizedMeshTransform]);
+            quantized_mesh_pipeline.run(quantized_mesh.positions, quantized_mesh.decode_matrix, view, projection);
+        }
+        {
+            StageTimer timer(&stages[TriangleClipping]);
+            mesh_clipper.run(mesh_pipeline.clip(), mesh_pipeline.ndc(), mesh_indices, ClipOptions());
+        }
+        {
+            StageTimer timer(&stages[MeshletCulling]);
+            meshlet_culler.run(meshlets, mesh_positions, camera, false);
+        }
+        {
+            StageTimer timer(&stages[CulledMeshTransform]);
+            culled_mesh_pipeline.run(meshlet_culler.mesh().positions, view, projection);
+        }
+        {
+            StageTimer timer(&stages[LodMeshTransform]);
+            float      radius = projected_sphere_radius(lod_chain.center(), lod_chain.radius(), view, projection, lod_viewport);
+            lod_mesh_pipeline.run(lod_chain.level(lod_selector.select(lod_chain, radius)).positions, view, projection);
+        }
+        {
+            StageTimer timer(&stages[InstanceTransform]);
+            instances.run(camera, true);
+        }
+        {
+            StageTimer timer(&stages[CameraBatchTransform]);
+            generate_camera_sweep(parameters, camera_batch_settings, &camera_sweep);
+            camera_batch.set_cameras(camera_sweep);
+            camera_batch.run(mesh_positions);
+        }
+        {
+            StageTimer timer(&stages[SingleCameraTransforms]);
+            for (size_t k = 0; k < single_camera_batches.size(); k++)
+            {
+                single_camera_batches[k].set_cameras({&camera_sweep[k], 1});
+                single_camera_batches[k].run(mesh_positions);
+            }
+        }
+        {
+            StageTimer timer(&stages[AxesTransform]);
+            axes_pipeline.run(axes_positions, view, projection);
+        }
+        {
+            StageTimer timer(&stages[MeshClipNdcSimd]);
+            glm::mat4 view_projection = projection * view;
+            parallel_for(mesh_soa.size(), TransformPipeline::parallel_threshold, TransformPipeline::parallel_chunk_size, [&](size_t begin, size_t end) {
+                simd::transform_points(view_projection, mesh_soa, &clip_soa, begin, end);
+                simd::perspective_divide(clip_soa, &ndc_soa, begin, end);
+            });
+        }
+        {
+            StageTimer timer(&stages[Rasterize]);
+            rasterizer.clear(glm::vec3(1.f));
+            rasterizer.set_camera(camera);
+            rasterizer.render_mesh(mesh_positions, mesh_indices, glm::vec3(0.75f));
+        }
+
+        // Consume the results, so the compiler cannot drop any of the work
+        if (measured)
+        {
+            size_t k = i % mesh_positions.size();
+            checksum += mesh_pipeline.ndc()[k].x + quantized_mesh_pipeline.ndc()[k].y + ndc_soa.x[k] + axes_pipeline.clip()[1].w +
+                        camera_marker.world().positions[0].y + world_camera.axes_lines[1].x + view_camera.axes_lines[1].y +
+                        world_camera_glm.frustum_corners[6].z + view_camera_glm.frustum_corners[6].z +
+                        camera_batch.clip(camera_batch.camera_count() - 1)[k].x + single_camera_batches.back().clip(0)[k].y +
+                        static_cast<double>(raster_target.pixel(raster_target.width() / 2, raster_target.height() / 2) & 0xFF) +
+                        static_cast<double>(mesh_clipper.stats().emitted + meshlet_culler.stats().visible_meshlets + instances.stats().visible + lod_selector.level());
+        }
+    }
+
+    if (options.output.empty())
+    {
+        write_report(std::cout, options, mesh_positions.size(), mesh_indices.size(), vertex_cache, stages, checksum);
+    }
+    else
+    {
+        std::ofstream file(options.output);
+        if (!file)
+        {
+            std::cerr << "Could not open " << options.output << " for writing" << std::endl;
+            return EXIT_FAILURE;
+        }
+        write_report(file, options, mesh_positions.size(), mesh_indices.size(), vertex_cache, stages, checksum);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace ex2
@@ -0,0 +1,37 @@
+#pragma once
+
+namespace ex2
+{
+
+/**
+ * \brief Check if the headless benchmark was requested on the command line (`--benchmark`).
+ */
+bool benchmark_requested(int argc, char** argv);
+
+/**
+ * \brief Run the CPU side of the frame without a window or GL context and report timings as JSON.
+ *
+ * The camera parameters are swept over the ranges of the GUI sliders, alternating between the orthographic and
+ * perspective transformation. For each stage of the frame, the mean, p50 and p99 latency, the time per vertex and
+ * the vertex throughput are reported, along with the vertex cache statistics of the mesh. The mesh is also rasterized
+ * on the CPU by \c SoftwareRenderer into a canvas of the default window size, reported in triangles per second.
+ *
+ * Options:
+ *  - `--iterations N`  Number of measured frames (default: 1000)
+ *  - `--mesh FILE`     Use the mesh in FILE instead of the bunny (see \c load_mesh(...))
+ *  - `--mesh-scale K`  Use K copies of the mesh to measure how stages scale with mesh size (default: 1)
+ *  - `--threads N`     Use N worker threads in addition to the main thread (default: hardware threads - 1)
+ *  - `--instances N`   Also transform an instanced scene with N instances (default: 0)
+ *  - `--optimize`      Optimize the mesh for the vertex cache and vertex fetch before measuring (see \c optimize_mesh(...))
+ *  - `--replay TRACE`  Replay a session recorded with `--record` through the frame cache instead of sweeping the
+ *                      parameters, and report the time of every frame (see \c write_frame_timings(...)). Only the
+ *                      frame cache update is timed (\c UpdateSpan::FrameCache), unlike the window replay.
+ *  - `--output FILE`   Write the JSON report to FILE instead of stdout
+ *
+ * The accuracy of the camera math is not checked here, see \c run_self_test(...).
+ *
+ * \return The exit code of the program
+ */
+int run_benchmark(int argc, char** argv);
+
+} // namespace ex2
@@ -1,6 +1,7 @@
 #include <array>
 #include <glm/glm.hpp>
 
-constexpr std::array<glm::vec3, 590> bunny_positions = {{{-1.186695e-01, -3.837063e-01, 5.900632e-02}, {-5.722795e-02, -3.877266e-01, 2.285976e-01}, {-7.055075e-02, -3.731972e-01, 1.810177e-01}, {4.730478e-02, 6.330683e-05, 2.326259e-01}, {1.993143e-01, -3.843474e-01, 8.390702e-02}, {5.030318e-02, -3.687842e-01, 2.008168e-01}, {-1.713559e-01, -3.972273e-01, 1.339433e-01}, {7.093745e-04, -3.689826e-01, 2.111948e-01}, {-1.644854e-01, -3.883267e-01, 7.016882e-02}, {-2.135439e-02, -3.740377e-01, -7.861519e-02}, {1.374781e-02, 2.734943e-01, -4.777974e-02}, {1.481328e-01, -3.902352e-01, 8.415601e-02}, {1.830975e-01, -3.936427e-01, 1.187905e-02}, {-6.570993e-02, -3.860979e-01, -9.192215e-02}, {1.079957e-01, -3.946138e-01, 4.910634e-02}, {-1.360096e-01, -3.966855e-01, -3.141749e-02}, {3.110164e-01, -2.064128e-01, 1.452663e-01}, {-2.691872e-02, 3.857084e-01, -5.314276e-02}, {-1.053011e-01, -3.728783e-01, -5.285005e-02}, {-1.053281e-01, -3.937192e-01, -8.388013e-02}, {-7.907992e-02, -3.981004e-01, 1.104061e-01}, {-9.908968e-02, -3.989250e-01, 4.370999e-02}, {-1.237572e-01, -3.967286e-01, 3.762341e-03}, {-1.108497e-01, -9.442298e-02, -1.134703e-01}, {-1.422590e-01, -3.982147e-01, -1.038957e-01}, {-7.501008e-02, -3.740251e-01, 1.802053e-02}, {-1.671514e-01, -3.968230e-01, 3.957545e-02}, {-2.349724e-01, -3.958335e-01, 1.169828e-01}, {-2.534720e-01, 2.920772e-01, -1.261775e-01}, {2.638136e-01, -1.480030e-01, 2.197978e-01}, {-5.914824e-02, -3.768313e-01, 6.087184e-02}, {-1.412733e-01, -3.955580e-01, -1.306703e-01}, {-1.962185e-01, -3.977036e-01, 7.055479e-02}, {-3.297268e-01, 2.333461e-01, 9.424703e-02}, {-1.822399e-01, -2.837124e-01, 7.910153e-02}, {-2.600443e-01, -2.014876e-01, 1.981095e-01}, {1.930479e-01, -1.019869e-01, -1.204018e-01}, {-2.146129e-01, -4.150209e-02, 2.286885e-01}, {-2.598728e-01, -1.689783e-01, 2.183599e-01}, {-1.884792e-01, -2.708136e-01, 1.216375e-01}, {-2.854378e-01, -2.046572e-01, 1.782572e-01}, {-2.727023e-01, -2.561353e-01, 7.460281e-02}, {-3.754968e-01, 1.185097e-01, 2.717307e-02}, {-2.454101e-01, -2.299499e-01, 1.734867e-01}, {-2.640757e-01, -2.506942e-01, 1.147502e-01}, {-1.872199e-01, 1.288808e-01, 1.647480e-01}, {-3.272500e-01, -1.745794e-01, 1.576945e-01}, {-2.830491e-01, 1.003679e-02, 2.602416e-01}, {3.483656e-01, -3.369541e-01, 2.655309e-02}, {-2.638651e-01, -2.501137e-01, 2.213067e-02}, {1.297505e-01, -3.682084e-01, 1.712455e-01}, {-3.080685e-01, -1.323912e-02, 1.935547e-01}, {-3.061186e-01, -2.158802e-01, 1.156321e-01}, {-3.212401e-01, 2.759828e-03, 2.433060e-01}, {2.598603e-01, -3.884772e-01, 6.060996e-02}, {2.092883e-02, 1.001098e-01, 4.856507e-02}, {-6.514852e-02, 4.911352e-02, 1.564408e-01}, {1.426167e-01, -3.935101e-01, -3.264844e-02}, {-3.724556e-01, 1.175077e-02, 2.288884e-01}, {6.466951e-02, -3.685688e-01, -6.037965e-02}, {-3.751536e-01, 2.094143e-01, 7.433115e-02}, {-3.610332e-01, -1.682172e-02, 1.040836e-01}, {-7.059447e-02, -2.167292e-02, -1.055427e-01}, {-1.354365e-01, -1.152140e-01, 2.303042e-01}, {3.841582e-02, 1.013176e-01, 1.257327e-01}, {3.086769e-01, -3.186070e-01, 1.774405e-01}, {-4.003284e-01, 9.920701e-02, 9.990834e-02}, {-1.679781e-01, -3.986779e-01, -5.383268e-02}, {2.516370e-01, -3.725609e-01, 1.358060e-01}, {8.362856e-02, -3.905447e-01, 2.151823e-01}, {2.083602e-01, -3.787011e-01, 1.672034e-01}, {-3.680121e-01, -1.287521e-01, 5.202687e-02}, {1.286078e-01, -3.897090e-01, -6.778339e-02}, {9.630995e-02, -3.950809e-01, 9.782056e-02}, {-2.374206e-01, 2.080803e-01, -2.254022e-02}, {3.459913e-01, -3.409605e-01, 1.163403e-01}, {1.366291e-01, -3.913863e-01, 2.217348e-01}, {2.168849e-01, -3.926011e-01, 5.197912e-02}, {-1.638566e-01, 2.683809e-01, 4.230234e-02}, {-3.229953e-01, 3.459068e-01, -2.457299e-01}, {-2.702200e-01, 3.245628e-01, -1.960222e-01}, {1.983673e-01, -3.913734e-01, 1.109104e-01}, {5.858759e-02, 1.070288e-01, 4.138527e-02}, {1.996950e-01, -3.885210e-01, 1.501074e-01}, {-5.158721e-02, -1.289168e-01, -1.841878e-01}, {-3.686586e-02, -2.325680e-01, -1.720525e-01}, {-2.642075e-02, -3.053868e-01, -1.444658e-01}, {-1.104430e-01, 7.104784e-02, 1.419407e-01}, {-2.132263e-01, -2.672669e-01, 1.204306e-02}, {-3.045102e-02, -1.957481e-01, -1.921667e-01}, {4.811712e-03, 3.081062e-01, -1.071534e-01}, {-2.881721e-01, -3.945912e-01, 8.289939e-03}, {-6.071264e-02, -3.783824e-01, 1.199330e-01}, {7.322205e-03, -2.152760e-01, -1.892797e-01}, {1.343434e-01, -3.928506e-01, 1.389408e-01}, {7.130697e-03, -1.351202e-01, -1.958791e-01}, {-3.534169e-03, 6.983417e-02, 1.605743e-01}, {5.961547e-02, -1.606338e-01, -1.865997e-01}, {3.214830e-02, -3.730705e-01, -1.260531e-01}, {1.592478e-03, -3.412858e-01, -1.367712e-01}, {4.761283e-02, -2.523489e-01, -1.749954e-01}, {2.060894e-02, -3.294869e-01, -1.471069e-01}, {-1.630296e-01, 1.403519e-01, 6.822623e-02}, {-2.208845e-01, -5.096154e-02, -9.173360e-02}, {3.195167e-01, -3.362266e-01, 1.540539e-01}, {1.064978e-01, -2.219765e-01, -1.653485e-01}, {3.558391e-02, -2.904774e-01, -1.658947e-01}, {8.596737e-02, -3.272915e-01, -1.429265e-01}, {1.076637e-01, -1.746755e-01, -1.738113e-01}, {8.342162e-02, -3.476425e-01, -1.235965e-01}, {-4.050000e-01, 6.288667e-02, 9.133427e-02}, {1.134128e-01, -2.901334e-01, -1.491156e-01}, {1.370322e-01, -2.965667e-01, -1.469768e-01}, {-3.221333e-01, 8.157427e-02, -2.498339e-02}, {-3.514577e-01, 2.064978e-01, 1.805691e-01}, {1.554673e-01, -3.211750e-01, -1.287690e-01}, {1.485462e-01, -3.907538e-01, 1.832300e-01}, {1.503014e-01, -2.069713e-01, -1.564288e-01}, {1.566222e-01, -2.526734e-01, -1.458165e-01}, {1.966529e-01, -2.912217e-01, -1.300290e-01}, {-1.475566e-01, -2.834328e-01, -4.986265e-02}, {-1.532229e-01, -2.253381e-01, -6.917280e-02}, {-1.264440e-01, -1.285961e-01, -1.039960e-01}, {-2.807891e-01, -1.789885e-01, -6.264913e-02}, {2.176817e-01, -3.494460e-01, -2.482951e-02}, {-1.959618e-01, -1.997470e-01, -7.514418e-02}, {-3.478638e-01, -1.545791e-02, 1.423117e-01}, {2.823369e-01, -3.671486e-01, 5.654305e-03}, {3.343854e-01, -2.843519e-01, -2.406047e-02}, {7.314667e-03, -3.715985e-01, -1.902075e-02}, {3.195431e-01, -3.100224e-01, -2.409481e-02}, {-2.373035e-01, 1.510617e-01, -2.834834e-02}, {-6.163522e-02, -1.752285e-01, 2.315321e-01}, {-1.777445e-01, -5.362050e-02, -1.063422e-01}, {-2.844018e-02, -3.745638e-01, 9.349827e-02}, {-1.534185e-01, -1.792882e-01, -8.523153e-02}, {-2.963481e-01, 2.012915e-02, -2.836824e-02}, {-2.738371e-01, 9.389907e-02, -3.966421e-02}, {-7.574359e-02, 5.834547e-02, -3.201729e-02}, {1.298981e-01, 6.390943e-02, 1.899317e-01}, {-1.208488e-01, 8.271782e-02, -2.775780e-02}, {5.347596e-02, 9.609194e-02, 1.487497e-01}, {-1.706850e-01, 9.444285e-02, -1.148588e-02}, {1.570039e-01, -6.931094e-02, -1.158602e-01}, {-2.211707e-01, 6.487653e-03, -7.634725e-02}, {-9.333451e-02, 2.412654e-01, -4.988746e-02}, {-2.013175e-01, 1.168412e-01, -1.784299e-02}, {-2.077847e-02, -1.045037e-01, -1.835872e-01}, {3.246573e-01, -2.037216e-01, 2.688626e-02}, {3.497389e-01, -3.159993e-01, -8.085766e-04}, {-1.106261e-02, -8.381563e-02, -1.687618e-01}, {3.472404e-01, -2.505004e-01, -8.453102e-03}, {9.842808e-02, 7.512197e-02, -3.805923e-02}, {-3.267026e-01, 7.239141e-02, 2.772718e-01}, {2.129971e-01, -1.593531e-01, -1.234724e-01}, {-1.516594e-01, 5.961813e-02, -5.808135e-02}, {9.604857e-02, 1.074525e-01, 1.921750e-02}, {-3.258368e-01, 1.169871e-01, 2.813875e-01}, {-4.265867e-02, -3.411687e-01, -1.420014e-01}, {-6.145983e-03, -6.269401e-02, -1.208776e-01}, {-3.492454e-01, 2.131983e-01, 3.401672e-02}, {-1.941307e-01, -1.518421e-01, -1.037490e-01}, {-3.442888e-01, 1.521898e-01, 1.008080e-02}, {-1.716807e-01, 2.900095e-01, 1.503433e-02}, {-3.121806e-01, 1.831774e-01, -2.066533e-02}, {-2.583874e-01, 7.232429e-04, 2.013025e-01}, {-2.134788e-01, -3.157370e-01, 1.843636e-02}, {-3.417948e-01, -3.820951e-02, -1.527509e-02}, {-3.547772e-01, -1.357451e-01, 6.070333e-03}, {-3.499347e-01, -9.884135e-02, -1.908175e-02}, {-3.179044e-01, -1.887645e-01, -2.055838e-02}, {-3.029641e-01, -2.185380e-01, 1.891649e-02}, {-2.569691e-01, -3.993176e-01, -3.385954e-02}, {-1.217230e-01, 3.296259e-01, -3.237535e-02}, {-6.227856e-02, -3.968901e-01, -1.456009e-01}, {-3.281746e-01, 7.375760e-03, -2.204984e-03}, {-3.120091e-01, -9.324665e-02, -6.067729e-02}, {2.214987e-01, 5.350905e-02, -7.441596e-03}, {6.987165e-02, 2.283017e-03, -1.025288e-01}, {-2.582227e-01, -9.011068e-02, -8.293500e-02}, {4.336388e-02, 1.737794e-03, -1.030971e-01}, {-3.615467e-02, 5.424203e-02, -4.213998e-02}, {-2.279352e-01, 5.223123e-02, -4.157341e-02}, {1.409056e-01, -3.638067e-01, -1.139623e-01}, {2.655911e-01, -8.108377e-02, -6.674280e-02}, {-2.678506e-01, 2.337970e-01, 1.275535e-02}, {5.317513e-02, -7.319447e-02, -1.606048e-01}, {1.059989e-01, -8.084381e-02, -1.581173e-01}, {-3.118747e-01, 2.236799e-01, -3.378395e-02}, {-1.314570e-01, 9.668173e-02, 3.095302e-02}, {-3.073394e-01, 2.061632e-01, -6.974804e-02}, {1.846008e-01, -4.865951e-02, -1.075812e-01}, {6.831622e-03, -2.706793e-01, -1.748533e-01}, {4.895742e-02, -9.785384e-02, -1.788849e-01}, {-2.703789e-01, -2.186160e-01, -2.191417e-02}, {5.647855e-02, 2.779424e-02, -7.917641e-02}, {-1.628605e-01, -3.691364e-01, -5.720686e-02}, {-5.367959e-02, -7.705149e-02, -1.203251e-01}, {9.415796e-03, -3.856411e-01, -8.579918e-02}, {-8.427741e-02, -2.785649e-01, -4.717014e-02}, {-2.093773e-03, 3.993176e-01, -1.097275e-01}, {-6.455215e-02, -3.138239e-01, -1.041615e-01}, {-8.626993e-02, -2.104852e-01, -9.678356e-02}, {-4.843410e-02, -2.857057e-01, -1.373583e-01}, {-1.227817e-01, -3.363796e-01, -1.020184e-01}, {-2.476507e-01, -3.418018e-02, -7.841098e-02}, {-3.792689e-01, 2.496384e-02, 1.484471e-01}, {-1.499796e-01, -6.350096e-02, -1.062137e-01}, {-9.339105e-02, -1.359436e-01, -1.167322e-01}, {-6.842934e-02, -2.238093e-01, -1.378999e-01}, {-2.411702e-01, 3.264311e-01, -3.149304e-01}, {-2.957244e-01, 2.330731e-01, -1.415031e-01}, {-5.865106e-02, -1.013314e-01, -1.551173e-01}, {5.618203e-02, -5.948973e-02, -1.311413e-01}, {1.031599e-01, 2.268643e-02, -9.502155e-02}, {-3.114552e-01, 1.789204e-01, 2.416214e-01}, {-7.571977e-02, -1.696641e-01, -1.647835e-01}, {2.412170e-01, -2.013578e-02, -6.274826e-02}, {6.559005e-03, 3.667399e-02, -7.060764e-02}, {3.072935e-02, -4.583906e-02, -1.170049e-01}, {1.934259e-01, -2.292100e-02, -8.384155e-02}, {9.841641e-03, 8.161994e-02, -9.943909e-03}, {-2.683916e-01, -3.502568e-01, 7.970666e-03}, {-3.790565e-01, -9.254422e-02, 1.129564e-01}, {-2.641317e-01, 3.437361e-02, -3.813875e-02}, {-1.604408e-01, 2.107405e-01, -1.567671e-02}, {-2.956563e-01, 2.798271e-01, -1.926023e-01}, {1.521449e-01, 5.156352e-02, -6.360140e-02}, {6.683073e-02, -3.728642e-01, 1.105835e-01}, {-2.892318e-01, 3.456290e-01, -2.710325e-01}, {-2.709746e-01, 3.103536e-01, -2.728657e-01}, {3.047706e-01, -2.141517e-01, -1.744906e-02}, {7.841750e-02, 5.910081e-02, -5.283282e-02}, {-3.537371e-01, 1.530896e-01, 2.376953e-01}, {-1.833022e-01, 1.686367e-01, 9.693009e-03}, {-3.967738e-01, 5.913219e-02, 2.253699e-01}, {-3.676360e-01, 4.382475e-02, 2.580976e-01}, {-3.304347e-01, -1.368587e-01, 1.864968e-01}, {1.471477e-01, -2.039075e-02, -9.522372e-02}, {-5.436580e-02, -3.888023e-01, 2.878269e-01}, {-2.219206e-01, -3.667292e-01, 1.103829e-01}, {-2.757004e-01, 1.119672e-01, 2.666120e-01}, {-3.424595e-01, -6.547647e-02, 1.726519e-01}, {-2.814692e-01, 1.857413e-01, 2.336137e-01}, {1.393876e-01, -3.854664e-01, 4.289868e-02}, {-2.236543e-01, 2.264768e-01, 9.147885e-03}, {-1.011836e-01, 1.122650e-02, -8.576475e-02}, {3.172323e-01, -1.559825e-01, -8.323129e-04}, {-2.326641e-01, 2.367489e-01, -1.515265e-01}, {-9.218740e-02, -3.933037e-01, 1.981736e-01}, {-3.620222e-01, 9.856985e-02, 2.618130e-01}, {-2.777973e-01, -3.617061e-01, 4.932580e-02}, {-2.873247e-01, 2.408246e-01, 1.058166e-01}, {-3.721824e-01, 1.787017e-01, 6.451345e-02}, {-2.069793e-01, -3.672624e-01, 2.557670e-01}, {-2.599772e-01, -3.935681e-01, 1.641612e-01}, {1.242898e-01, -3.724883e-01, -4.056673e-02}, {-2.430732e-01, -3.343754e-01, 1.934915e-01}, {1.118591e-01, -2.101111e-01, 2.983765e-01}, {2.884137e-01, -5.068832e-03, 7.476860e-02}, {3.041034e-01, -4.540078e-02, 5.327542e-03}, {-2.563550e-01, -3.846777e-01, 2.182110e-01}, {-1.855477e-01, -2.363226e-01, 1.910894e-01}, {-2.752401e-01, 2.296729e-01, -2.570463e-01}, {-3.064067e-01, -1.149084e-01, 2.132208e-01}, {-3.029173e-02, -3.969284e-01, -1.062959e-01}, {-9.700430e-02, -3.184399e-01, 2.116433e-01}, {-3.109403e-01, 2.667267e-01, -7.667381e-02}, {-3.059895e-01, -3.868752e-02, 1.980876e-01}, {-1.816134e-01, -2.363867e-01, -4.802983e-02}, {-3.213789e-01, 2.685292e-01, -1.236052e-01}, {-4.477407e-02, -7.923349e-02, 2.401428e-01}, {2.274676e-01, -1.080861e-01, -1.063739e-01}, {9.773428e-02, -5.212006e-02, -1.106962e-01}, {-1.602600e-01, 1.796449e-01, 3.290092e-02}, {2.515563e-03, -8.266985e-02, 2.907441e-01}, {-2.239911e-02, -2.035307e-01, 2.785198e-01}, {-4.057042e-02, -1.482592e-01, 2.919133e-01}, {-8.113255e-02, -3.615654e-01, 2.740571e-01}, {-3.577827e-01, -1.533075e-01, 1.068441e-01}, {-2.878247e-01, 2.655952e-01, -4.323975e-02}, {-2.197533e-01, -3.284862e-01, 2.258219e-01}, {-2.832512e-02, -3.033046e-01, 2.373573e-01}, {-2.655419e-01, 1.953448e-01, -1.448559e-01}, {2.036689e-01, -6.119546e-02, 2.475814e-01}, {1.312854e-01, 1.093665e-01, 1.064905e-01}, {-5.039757e-02, 3.398542e-01, -8.881952e-02}, {1.909799e-01, 8.726785e-02, 1.028129e-01}, {1.991819e-01, 8.021215e-02, 2.475846e-02}, {-2.075674e-01, -3.193415e-01, 5.524531e-02}, {1.515612e-01, 8.190271e-02, 1.655588e-01}, {-3.786182e-01, -4.746961e-02, 7.972857e-02}, {2.089947e-01, 7.316427e-02, 1.308969e-01}, {8.708782e-02, -6.192095e-02, 2.793944e-01}, {2.748472e-01, -3.796868e-01, 9.328336e-02}, {2.405119e-01, 4.416880e-02, 1.404998e-01}, {2.417637e-01, 5.387670e-02, 6.822137e-02}, {-2.970209e-01, 6.085587e-02, 2.880439e-01}, {-3.132519e-01, 2.250926e-01, 2.380161e-03}, {-2.165747e-01, 2.384998e-01, 6.107254e-02}, {-2.975260e-01, 3.376050e-01, -2.053725e-01}, {-1.381195e-01, 9.911474e-02, 8.224155e-02}, {1.395751e-01, 9.933247e-02, 1.423111e-01}, {-1.282301e-01, 2.636953e-01, -5.184929e-02}, {-5.583639e-02, 7.857489e-02, 9.293140e-02}, {-1.892148e-01, 1.451524e-01, 1.533556e-01}, {-3.616074e-01, 6.986672e-02, -4.201502e-03}, {2.219119e-01, -2.597731e-01, -1.116911e-01}, {-2.611284e-01, 2.395097e-01, 1.323654e-01}, {-3.138594e-01, 2.282858e-01, 1.654091e-01}, {-3.295912e-01, 2.282974e-01, 5.067560e-02}, {-9.840160e-02, 9.032541e-02, 5.486926e-02}, {-2.996321e-01, 2.702649e-02, 2.781529e-01}, {-1.721488e-01, -2.494810e-01, 1.860037e-01}, {-2.427884e-01, 2.303369e-01, 1.659802e-02}, {3.202027e-01, -3.588275e-01, 5.609190e-02}, {2.628862e-01, 2.482947e-02, 1.729271e-02}, {-6.724569e-02, -3.901190e-01, 7.344329e-02}, {3.794356e-01, -1.924476e-01, 9.947271e-02}, {3.864422e-01, -2.000716e-01, 5.017292e-02}, {-2.927001e-01, 3.017494e-01, -1.106678e-01}, {-1.826779e-01, -3.127217e-01, 1.840635e-01}, {-1.003839e-01, 3.300511e-01, 5.138082e-03}, {-2.622988e-01, 2.566229e-01, -4.616245e-02}, {-2.668653e-01, 2.229579e-01, 1.888214e-01}, {-2.714546e-01, 3.710473e-01, -2.764896e-01}, {-1.843812e-01, 1.682539e-01, 1.099840e-01}, {4.030822e-01, -2.271846e-01, 9.777817e-02}, {4.050000e-01, -2.536600e-01, 5.268210e-02}, {3.161955e-01, -9.545453e-02, 1.299557e-01}, {3.898574e-01, -2.899421e-01, 1.173724e-01}, {1.287717e-01, -1.162148e-01, 2.992421e-01}, {3.049382e-01, -3.710632e-02, 8.216494e-02}, {-2.387666e-01, 2.881329e-01, -2.038978e-01}, {-2.371963e-01, -3.958178e-01, 9.040479e-02}, {3.133700e-01, -2.323771e-01, 4.065558e-03}, {-2.849874e-01, 1.765795e-01, -6.374017e-02}, {-3.955100e-01, 6.341234e-02, 1.651896e-01}, {2.314118e-01, -6.692336e-02, -8.882647e-02}, {3.016520e-01, -8.257030e-02, -2.447089e-02}, {-1.957475e-01, -3.284521e-01, 1.404878e-01}, {-1.836734e-01, -2.800420e-01, 1.566811e-01}, {-3.748658e-01, 1.390537e-01, 1.578123e-01}, {-5.770292e-02, 8.079711e-02, 5.866108e-02}, {-1.311996e-01, -3.280649e-01, -5.326022e-02}, {-2.380808e-01, 2.711937e-01, -2.323650e-01}, {2.543947e-01, 8.426472e-03, -3.083190e-02}, {1.047033e-01, -2.483927e-01, 3.028607e-01}, {-1.888538e-01, -2.931897e-01, -2.689984e-02}, {-6.239503e-02, 6.710825e-02, -6.759141e-03}, {-3.387612e-02, 2.513320e-01, -4.718212e-02}, {-2.208925e-01, -1.030453e-01, -9.862062e-02}, {2.455460e-01, -3.091696e-01, -5.509391e-02}, {3.736651e-01, -3.107937e-01, 2.648005e-02}, {2.774770e-01, -2.889830e-01, -2.780536e-02}, {-8.854961e-02, -3.063335e-01, -4.776618e-02}, {-3.953196e-01, 2.382067e-02, 9.804440e-02}, {7.982022e-02, -3.709237e-01, 1.323441e-02}, {-2.392697e-01, 3.289626e-01, -2.656076e-01}, {1.530628e-01, -3.929366e-01, -9.682287e-02}, {3.206314e-01, -2.893187e-01, 1.793792e-01}, {2.903315e-01, -2.175732e-01, -5.189347e-02}, {-3.895545e-01, 2.014199e-01, 1.195680e-01}, {-2.246561e-01, -3.919682e-01, 2.427183e-01}, {1.362560e-01, 8.888093e-02, -1.766452e-02}, {2.310825e-01, -3.163872e-01, -8.676682e-02}, {2.684104e-01, -1.549411e-01, -8.291527e-02}, {2.069223e-01, -2.139829e-01, -1.301498e-01}, {1.133565e-01, 1.129837e-01, 7.148327e-02}, {-3.875266e-01, 2.927889e-02, 4.679052e-02}, {-2.606490e-01, -3.379250e-01, 3.958815e-02}, {-3.886446e-01, 9.810550e-02, 1.783394e-01}, {3.026530e-01, -1.661399e-01, -3.111713e-02}, {1.029517e-01, -3.860301e-01, -1.150334e-01}, {-3.613855e-01, -1.110192e-02, 5.581855e-02}, {2.627279e-01, -2.636950e-01, -6.739771e-02}, {1.285670e-01, -3.472251e-01, 2.446010e-01}, {2.525075e-01, -3.626450e-01, 1.511764e-01}, {-3.006156e-01, 2.036609e-01, -1.353679e-01}, {2.805157e-01, -1.190681e-01, -7.635475e-02}, {3.145959e-01, -1.366107e-01, -1.484463e-02}, {2.613168e-01, -2.112743e-01, -8.084957e-02}, {5.132937e-02, -3.957663e-01, -1.006113e-01}, {-3.683835e-01, -6.065187e-02, 3.327182e-02}, {-1.788853e-02, 8.793446e-03, -9.299278e-02}, {-2.309659e-01, 2.585533e-01, -1.545728e-01}, {-1.338544e-02, -3.912403e-01, -1.356988e-01}, {-9.077555e-02, -3.921725e-01, 1.631196e-01}, {-3.734369e-01, -9.510368e-02, 4.739676e-02}, {5.457847e-02, 8.782963e-02, -2.660378e-02}, {1.375915e-01, -6.528340e-02, 2.645868e-01}, {2.869412e-02, -3.895617e-01, 2.677842e-01}, {-2.142390e-01, -1.792038e-01, 2.288399e-01}, {-1.201292e-01, 3.477882e-02, -6.887025e-02}, {-2.306419e-01, -3.407366e-01, 7.012248e-02}, {-3.719141e-01, -6.624204e-02, 1.318539e-01}, {-5.704461e-02, 2.547127e-01, 1.149657e-02}, {-1.114102e-01, 2.699008e-01, 8.078252e-03}, {-2.290298e-01, 3.016079e-01, -3.115706e-01}, {-2.175700e-01, 1.812724e-01, -6.173841e-03}, {-1.990728e-01, -3.276235e-01, -2.293324e-02}, {-2.375920e-01, -2.509879e-01, -8.662866e-03}, {-1.177311e-01, 2.402305e-01, 3.414526e-02}, {-1.879601e-01, 4.287931e-03, -8.587431e-02}, {-1.407028e-01, 2.506163e-01, 4.003521e-02}, {-1.649559e-01, 2.149677e-01, 6.546510e-02}, {-2.950829e-01, -6.963543e-02, -6.760965e-02}, {2.509729e-01, -3.411772e-01, 1.664277e-01}, {-3.965348e-01, 3.779761e-02, 1.950487e-01}, {-2.982801e-01, -1.329548e-01, -7.355224e-02}, {-2.846124e-02, -3.369742e-01, 2.853532e-01}, {-1.459106e-01, -3.370624e-01, 2.262172e-01}, {-1.536983e-01, 2.924422e-01, -2.938699e-02}, {-1.873329e-01, 2.253777e-01, 8.155233e-02}, {2.722432e-01, -6.094768e-02, 1.909024e-01}, {-2.338757e-01, -2.065371e-01, -6.710635e-02}, {-1.003952e-01, -3.374228e-01, -1.294427e-01}, {-1.249781e-01, -3.920723e-01, 2.228665e-01}, {3.741119e-01, -3.226266e-01, 7.648475e-02}, {-1.751401e-01, -3.312727e-01, 9.961541e-02}, {-3.759070e-01, 1.708549e-01, 1.742512e-01}, {2.788430e-01, -2.306834e-01, 1.996185e-01}, {-5.634835e-02, 2.763631e-01, -1.986813e-02}, {-2.816055e-01, -3.866349e-01, 6.499363e-02}, {9.825455e-02, -3.098028e-01, 2.838980e-01}, {-1.609734e-01, 1.171731e-01, 1.261883e-01}, {2.171753e-01, -2.542710e-02, 2.130199e-01}, {3.666108e-01, -2.842780e-01, 1.523715e-01}, {-1.701694e-01, -1.662315e-01, 2.338636e-01}, {-1.739235e-01, 9.128516e-02, 1.737146e-01}, {-2.279838e-01, 9.077528e-02, -3.282662e-02}, {1.466755e-01, -1.123033e-01, -1.538341e-01}, {-1.963396e-01, 1.643326e-01, 1.591610e-01}, {2.312208e-01, -2.540905e-01, 2.327861e-01}, {3.951935e-01, -2.903362e-01, 7.665489e-02}, {-3.853491e-01, 1.348051e-01, 9.362511e-02}, {-2.798978e-01, 2.683275e-01, -2.337053e-01}, {-2.000177e-01, 9.907819e-02, 2.003016e-01}, {-1.795087e-01, 6.630334e-02, 1.891593e-01}, {6.694634e-02, -1.376598e-01, 3.063708e-01}, {1.871752e-01, -3.646911e-01, 2.327750e-01}, {-2.160832e-01, 2.194891e-01, 1.830387e-01}, {-2.280268e-01, 1.752440e-01, 1.959645e-01}, {-1.990770e-01, 2.218162e-02, 1.890342e-01}, {-2.384672e-01, 1.407501e-01, 1.975224e-01}, {1.984385e-01, -1.716463e-01, 2.738113e-01}, {-1.017073e-01, 2.129005e-01, 9.177472e-03}, {1.786491e-01, -7.746897e-02, 2.559806e-01}, {-3.685406e-01, 4.924982e-03, 1.070094e-01}, {-2.536709e-01, -1.239264e-01, 2.409145e-01}, {-3.413407e-02, 2.769781e-01, -7.514112e-02}, {-2.316008e-01, 4.206834e-02, 2.234967e-01}, {1.844259e-01, -4.045041e-02, 2.457416e-01}, {-2.329438e-04, -3.906423e-01, 2.420245e-01}, {-3.657093e-01, -1.237405e-01, 1.270387e-01}, {-8.067005e-02, 2.998623e-01, -7.685286e-02}, {2.172889e-01, -2.887987e-01, 2.290679e-01}, {1.826792e-01, -3.224990e-01, 2.289429e-01}, {2.777967e-02, -5.981803e-02, 2.652369e-01}, {-3.633993e-02, 2.625152e-01, -7.084974e-03}, {-2.209154e-01, 6.649742e-02, 2.256639e-01}, {2.264747e-01, -9.626302e-02, 2.443575e-01}, {-2.469196e-01, 1.747364e-01, 2.124427e-01}, {-2.474757e-01, -8.437341e-02, 2.375579e-01}, {-2.574179e-01, -5.291731e-02, 2.251900e-01}, {2.977096e-02, 3.418510e-01, -1.104632e-01}, {1.915658e-01, -3.823154e-04, 2.095048e-01}, {2.059475e-01, -1.468056e-01, 2.672743e-01}, {2.987345e-01, -1.444781e-01, 1.751738e-01}, {2.359255e-01, 8.454184e-03, 1.842522e-01}, {3.214546e-01, -7.772036e-02, 5.870647e-02}, {-9.962890e-02, -3.390691e-02, -1.012433e-01}, {2.633496e-01, -2.646364e-01, 2.063334e-01}, {1.716634e-01, -3.859078e-01, 2.335051e-01}, {-2.569398e-01, 5.335011e-02, 2.791217e-01}, {-1.005803e-01, -3.940208e-01, 1.520970e-01}, {1.970312e-01, -2.355964e-01, 2.540996e-01}, {2.947166e-01, -4.551766e-02, 1.429248e-01}, {-2.031070e-01, 2.261345e-01, 1.580783e-01}, {-1.442529e-01, -3.931639e-01, 1.802953e-01}, {-1.498820e-01, -3.618749e-01, -8.120626e-02}, {3.224745e-01, -9.354723e-02, 2.652687e-02}, {4.228685e-02, 3.127448e-01, -1.331327e-01}, {2.398599e-01, -3.217118e-01, 1.949300e-01}, {1.990325e-01, -3.283071e-01, -1.016405e-01}, {1.487500e-01, -2.950830e-01, 2.750373e-01}, {2.864911e-01, -9.998380e-02, 1.910103e-01}, {-1.190586e-01, -3.772151e-01, 2.320862e-01}, {2.453072e-01, -1.865568e-01, 2.291701e-01}, {-2.535684e-01, -1.703470e-01, -8.300712e-02}, {1.809027e-01, -2.760099e-01, 2.632165e-01}, {2.620248e-01, -9.464812e-02, 2.212719e-01}, {2.859993e-01, -2.735313e-01, 1.713262e-01}, {6.365819e-03, 3.813415e-01, -9.999236e-02}, {3.749025e-01, -2.522255e-01, 1.528115e-01}, {1.483666e-01, -2.598538e-01, 2.778658e-01}, {1.553296e-01, -1.389244e-01, 2.857905e-01}, {-1.622253e-01, -4.443113e-02, 2.259207e-01}, {3.630494e-01, -2.156264e-01, 1.450089e-01}, {-6.903446e-02, 3.027536e-01, -3.280888e-02}, {-3.476564e-01, -1.759247e-01, 3.338825e-02}, {-2.268050e-02, 3.326241e-01, -1.066084e-01}, {6.754847e-02, -1.884610e-01, 3.149304e-01}, {5.258589e-02, -3.332735e-01, 2.557906e-01}, {2.787536e-01, -3.877351e-02, -4.121604e-02}, {6.727342e-02, -2.370930e-01, 3.011236e-01}, {1.686656e-02, 3.822388e-01, -1.403366e-01}, {-2.564129e-01, 2.211751e-01, -2.126513e-01}, {-1.656221e-01, -1.217207e-01, 2.420264e-01}, {5.353719e-03, 5.350876e-02, 1.903929e-01}, {9.714137e-02, 1.569320e-02, 2.261411e-01}, {9.279154e-02, -4.266259e-02, 2.366803e-01}, {3.291056e-02, -2.876698e-01, 2.802232e-01}, {5.274558e-03, -5.357894e-02, 2.388629e-01}, {-2.904373e-01, 2.354524e-01, 2.499185e-02}, {-4.710572e-03, -2.487361e-01, 2.779416e-01}, {-7.513383e-02, -3.004207e-01, 1.984346e-01}, {-2.492915e-02, -1.199709e-01, 2.996979e-01}, {-1.617144e-02, 1.119739e-02, 2.133022e-01}, {1.007162e-02, -2.221776e-01, 2.884957e-01}, {-2.036934e-01, -1.142985e-01, 2.422692e-01}, {-3.791237e-01, 1.226979e-01, 2.079482e-01}, {1.101743e-01, -1.623057e-01, 3.022840e-01}, {-2.864610e-01, -1.680458e-01, 2.047890e-01}, {-1.251728e-02, -1.517473e-01, 3.050194e-01}, {-3.891783e-03, -2.973787e-01, 2.599810e-01}, {3.191016e-02, -4.514871e-02, 2.370319e-01}, {3.292027e-01, -2.059559e-01, 1.239889e-01}, {-2.150721e-02, -6.696469e-02, 2.438756e-01}, {-1.517323e-01, -3.064827e-01, 2.060158e-01}, {1.260029e-01, -3.860030e-01, 2.439535e-01}, {3.310630e-01, -1.897818e-01, 6.211984e-02}, {2.162582e-01, -3.664241e-01, 1.866101e-01}, {1.929922e-01, 5.306164e-02, 1.778301e-01}, {-2.646253e-01, -3.779775e-01, -2.761656e-02}, {-3.172453e-01, 1.239877e-01, -2.270618e-02}, {3.186296e-01, -1.485304e-01, 1.352784e-01}, {-2.875104e-01, 2.063993e-01, -2.153102e-01}, {-6.000591e-02, -3.277881e-01, 2.594370e-01}, {-2.345833e-01, 2.368715e-01, -7.629739e-02}, {3.873958e-01, -2.154175e-01, 2.783101e-02}, {-1.719846e-01, -7.758006e-02, 2.372957e-01}, {4.764079e-02, -8.182549e-02, 2.972562e-01}, {-3.695232e-01, 2.205642e-01, 1.131079e-01}, {4.193639e-02, -1.617395e-01, 3.096647e-01}, {-5.419047e-02, 3.745126e-01, -4.522864e-02}, {7.955950e-02, 5.724895e-02, 2.021856e-01}, {8.984801e-02, 6.962290e-02, 1.877494e-01}, {-2.315792e-02, 2.464547e-01, -2.505784e-02}, {-6.354220e-04, -1.840810e-02, -1.073135e-01}, {-3.273885e-01, 3.030806e-01, -1.894554e-01}, {-5.640335e-02, -2.370865e-01, 2.028476e-01}, {-2.485357e-01, 2.472569e-01, -2.806842e-01}, {3.270754e-01, -1.708405e-01, 1.009349e-01}, {-1.747194e-01, 1.503687e-01, 1.921722e-02}, {3.907269e-02, 2.840759e-01, -8.720787e-02}, {-5.811862e-02, -6.146436e-03, 2.108494e-01}, {-6.440260e-02, -4.517994e-02, 2.309991e-01}, {1.559931e-01, 1.028033e-01, 3.525319e-02}, {-2.666714e-01, 1.595029e-01, -3.301630e-02}, {-1.126702e-01, -2.125484e-01, -7.602102e-02}, {3.739521e-01, -2.687750e-01, 5.903652e-03}, {-5.990259e-02, -9.772754e-02, 2.403461e-01}, {-3.283511e-01, -2.055350e-01, 7.948738e-02}, {2.058484e-01, -3.876152e-01, 3.628968e-03}, {2.676489e-01, 1.680393e-02, 1.377036e-01}, {1.508650e-01, -2.074362e-01, 2.897420e-01}, {-1.559472e-01, -1.870713e-01, 2.274556e-01}, {2.695302e-01, -1.902741e-01, -7.119102e-02}, {-1.006650e-01, -3.889512e-01, -1.535832e-01}, {-1.570153e-01, 1.838227e-01, 5.224481e-03}, {-2.602297e-01, 1.804821e-01, -9.186024e-02}, {-9.933203e-02, 2.288819e-02, 1.834475e-01}, {1.757928e-01, -3.887307e-01, -7.598617e-02}, {-1.498673e-01, 6.144281e-02, 1.437416e-01}, {8.371397e-02, -2.797746e-01, 2.922466e-01}, {-2.731793e-01, 1.676271e-01, 2.430633e-01}, {-1.152757e-01, -4.659966e-02, 2.227641e-01}, {-9.817012e-02, -2.371684e-01, 2.204122e-01}, {-2.435673e-01, 1.960407e-01, -9.889631e-02}, {-1.782588e-01, 1.938922e-01, 8.583124e-02}, {-1.309212e-01, -2.186390e-01, 2.254161e-01}, {1.474010e-01, -3.385558e-03, 2.177980e-01}, {-9.946177e-02, -9.278224e-02, 2.384547e-01}, {-1.143702e-01, -1.510126e-01, 2.331464e-01}, {-2.431304e-01, -3.621943e-01, 1.394871e-01}, {-2.419023e-01, 3.571764e-01, -3.017302e-01}, {-1.180161e-01, -2.837720e-01, 2.153051e-01}, {-1.507722e-01, -5.988754e-03, 2.096344e-01}, {-1.454905e-01, -2.569643e-01, 2.132857e-01}}};
+// Vertices and triangles in the order of ex2::optimize_mesh(...), for the post-transform vertex cache and vertex fetch
+constexpr std::array<glm::vec3, 590> bunny_positions = {{{-6.071264e-02, -3.783824e-01, 1.199330e-01}, {-6.724569e-02, -3.901190e-01, 7.344329e-02}, {-5.914824e-02, -3.768313e-01, 6.087184e-02}, {-2.844018e-02, -3.745638e-01, 9.349827e-02}, {-7.501008e-02, -3.740251e-01, 1.802053e-02}, {-7.907992e-02, -3.981004e-01, 1.104061e-01}, {-9.908968e-02, -3.989250e-01, 4.370999e-02}, {-7.055075e-02, -3.731972e-01, 1.810177e-01}, {7.314667e-03, -3.715985e-01, -1.902075e-02}, {-1.186695e-01, -3.837063e-01, 5.900632e-02}, {-1.237572e-01, -3.967286e-01, 3.762341e-03}, {-1.005803e-01, -3.940208e-01, 1.520970e-01}, {-1.053011e-01, -3.728783e-01, -5.285005e-02}, {-1.671514e-01, -3.968230e-01, 3.957545e-02}, {-1.360096e-01, -3.966855e-01, -3.141749e-02}, {-1.644854e-01, -3.883267e-01, 7.016882e-02}, {-1.962185e-01, -3.977036e-01, 7.055479e-02}, {-1.713559e-01, -3.972273e-01, 1.339433e-01}, {-9.077555e-02, -3.921725e-01, 1.631196e-01}, {-1.442529e-01, -3.931639e-01, 1.802953e-01}, {-9.218740e-02, -3.933037e-01, 1.981736e-01}, {-5.722795e-02, -3.877266e-01, 2.285976e-01}, {-1.249781e-01, -3.920723e-01, 2.228665e-01}, {-2.349724e-01, -3.958335e-01, 1.169828e-01}, {-2.371963e-01, -3.958178e-01, 9.040479e-02}, {-1.679781e-01, -3.986779e-01, -5.383268e-02}, {-2.569691e-01, -3.993176e-01, -3.385954e-02}, {-2.816055e-01, -3.866349e-01, 6.499363e-02}, {-2.881721e-01, -3.945912e-01, 8.289939e-03}, {-1.628605e-01, -3.691364e-01, -5.720686e-02}, {-2.646253e-01, -3.779775e-01, -2.761656e-02}, {-2.777973e-01, -3.617061e-01, 4.932580e-02}, {-2.683916e-01, -3.502568e-01, 7.970666e-03}, {-1.990728e-01, -3.276235e-01, -2.293324e-02}, {-2.606490e-01, -3.379250e-01, 3.958815e-02}, {-2.219206e-01, -3.667292e-01, 1.103829e-01}, {-2.306419e-01, -3.407366e-01, 7.012248e-02}, {-2.134788e-01, -3.157370e-01, 1.843636e-02}, {-2.075674e-01, -3.193415e-01, 5.524531e-02}, {-1.751401e-01, -3.312727e-01, 9.961541e-02}, {-2.431304e-01, -3.621943e-01, 1.394871e-01}, {-1.957475e-01, -3.284521e-01, 1.404878e-01}, {-2.599772e-01, -3.935681e-01, 1.641612e-01}, {-2.430732e-01, -3.343754e-01, 1.934915e-01}, {-1.826779e-01, -3.127217e-01, 1.840635e-01}, {-2.563550e-01, -3.846777e-01, 2.182110e-01}, {-1.836734e-01, -2.800420e-01, 1.566811e-01}, {-2.197533e-01, -3.284862e-01, 2.258219e-01}, {-2.246561e-01, -3.919682e-01, 2.427183e-01}, {-2.069793e-01, -3.672624e-01, 2.557670e-01}, {-1.459106e-01, -3.370624e-01, 2.262172e-01}, {-1.190586e-01, -3.772151e-01, 2.320862e-01}, {-5.436580e-02, -3.888023e-01, 2.878269e-01}, {-1.517323e-01, -3.064827e-01, 2.060158e-01}, {-9.700430e-02, -3.184399e-01, 2.116433e-01}, {-1.180161e-01, -2.837720e-01, 2.153051e-01}, {-8.113255e-02, -3.615654e-01, 2.740571e-01}, {-6.000591e-02, -3.277881e-01, 2.594370e-01}, {-2.846124e-02, -3.369742e-01, 2.853532e-01}, {-2.832512e-02, -3.033046e-01, 2.373573e-01}, {-7.513383e-02, -3.004207e-01, 1.984346e-01}, {2.869412e-02, -3.895617e-01, 2.677842e-01}, {-9.817012e-02, -2.371684e-01, 2.204122e-01}, {-2.329438e-04, -3.906423e-01, 2.420245e-01}, {-5.640335e-02, -2.370865e-01, 2.028476e-01}, {7.093745e-04, -3.689826e-01, 2.111948e-01}, {5.030318e-02, -3.687842e-01, 2.008168e-01}, {6.683073e-02, -3.728642e-01, 1.105835e-01}, {8.362856e-02, -3.905447e-01, 2.151823e-01}, {1.297505e-01, -3.682084e-01, 1.712455e-01}, {1.260029e-01, -3.860030e-01, 2.439535e-01}, {9.630995e-02, -3.950809e-01, 9.782056e-02}, {1.366291e-01, -3.913863e-01, 2.217348e-01}, {1.485462e-01, -3.907538e-01, 1.832300e-01}, {1.343434e-01, -3.928506e-01, 1.389408e-01}, {1.481328e-01, -3.902352e-01, 8.415601e-02}, {1.983673e-01, -3.913734e-01, 1.109104e-01}, {1.996950e-01, -3.885210e-01, 1.501074e-01}, {1.716634e-01, -3.859078e-01, 2.335051e-01}, {5.258589e-02, -3.332735e-01, 2.557906e-01}, {1.285670e-01, -3.472251e-01, 2.446010e-01}, {-3.891783e-03, -2.973787e-01, 2.599810e-01}, {-4.710572e-03, -2.487361e-01, 2.779416e-01}, {3.291056e-02, -2.876698e-01, 2.802232e-01}, {9.825455e-02, -3.098028e-01, 2.838980e-01}, {6.727342e-02, -2.370930e-01, 3.011236e-01}, {8.371397e-02, -2.797746e-01, 2.922466e-01}, {1.487500e-01, -2.950830e-01, 2.750373e-01}, {1.483666e-01, -2.598538e-01, 2.778658e-01}, {1.047033e-01, -2.483927e-01, 3.028607e-01}, {1.826792e-01, -3.224990e-01, 2.289429e-01}, {1.118591e-01, -2.101111e-01, 2.983765e-01}, {1.871752e-01, -3.646911e-01, 2.327750e-01}, {1.809027e-01, -2.760099e-01, 2.632165e-01}, {2.162582e-01, -3.664241e-01, 1.866101e-01}, {1.508650e-01, -2.074362e-01, 2.897420e-01}, {1.970312e-01, -2.355964e-01, 2.540996e-01}, {2.172889e-01, -2.887987e-01, 2.290679e-01}, {2.398599e-01, -3.217118e-01, 1.949300e-01}, {2.312208e-01, -2.540905e-01, 2.327861e-01}, {2.633496e-01, -2.646364e-01, 2.063334e-01}, {2.509729e-01, -3.411772e-01, 1.664277e-01}, {2.859993e-01, -2.735313e-01, 1.713262e-01}, {2.788430e-01, -2.306834e-01, 1.996185e-01}, {2.453072e-01, -1.865568e-01, 2.291701e-01}, {1.984385e-01, -1.716463e-01, 2.738113e-01}, {2.638136e-01, -1.480030e-01, 2.197978e-01}, {1.553296e-01, -1.389244e-01, 2.857905e-01}, {2.059475e-01, -1.468056e-01, 2.672743e-01}, {2.264747e-01, -9.626302e-02, 2.443575e-01}, {1.786491e-01, -7.746897e-02, 2.559806e-01}, {2.036689e-01, -6.119546e-02, 2.475814e-01}, {2.620248e-01, -9.464812e-02, 2.212719e-01}, {1.101743e-01, -1.623057e-01, 3.022840e-01}, {1.287717e-01, -1.162148e-01, 2.992421e-01}, {6.754847e-02, -1.884610e-01, 3.149304e-01}, {6.694634e-02, -1.376598e-01, 3.063708e-01}, {1.007162e-02, -2.221776e-01, 2.884957e-01}, {4.193639e-02, -1.617395e-01, 3.096647e-01}, {-2.239911e-02, -2.035307e-01, 2.785198e-01}, {-1.251728e-02, -1.517473e-01, 3.050194e-01}, {4.764079e-02, -8.182549e-02, 2.972562e-01}, {-2.492915e-02, -1.199709e-01, 2.996979e-01}, {-4.057042e-02, -1.482592e-01, 2.919133e-01}, {-6.163522e-02, -1.752285e-01, 2.315321e-01}, {-5.990259e-02, -9.772754e-02, 2.403461e-01}, {-1.143702e-01, -1.510126e-01, 2.331464e-01}, {-9.946177e-02, -9.278224e-02, 2.384547e-01}, {-4.477407e-02, -7.923349e-02, 2.401428e-01}, {-1.309212e-01, -2.186390e-01, 2.254161e-01}, {2.515563e-03, -8.266985e-02, 2.907441e-01}, {-1.454905e-01, -2.569643e-01, 2.132857e-01}, {-1.721488e-01, -2.494810e-01, 1.860037e-01}, {-1.559472e-01, -1.870713e-01, 2.274556e-01}, {-1.855477e-01, -2.363226e-01, 1.910894e-01}, {-1.354365e-01, -1.152140e-01, 2.303042e-01}, {-1.884792e-01, -2.708136e-01, 1.216375e-01}, {-2.142390e-01, -1.792038e-01, 2.288399e-01}, {-1.822399e-01, -2.837124e-01, 7.910153e-02}, {-2.454101e-01, -2.299499e-01, 1.734867e-01}, {-2.132263e-01, -2.672669e-01, 1.204306e-02}, {-2.600443e-01, -2.014876e-01, 1.981095e-01}, {-2.640757e-01, -2.506942e-01, 1.147502e-01}, {-2.854378e-01, -2.046572e-01, 1.782572e-01}, {-2.727023e-01, -2.561353e-01, 7.460281e-02}, {-3.061186e-01, -2.158802e-01, 1.156321e-01}, {-2.638651e-01, -2.501137e-01, 2.213067e-02}, {-3.283511e-01, -2.055350e-01, 7.948738e-02}, {-3.029641e-01, -2.185380e-01, 1.891649e-02}, {-3.272500e-01, -1.745794e-01, 1.576945e-01}, {-2.864610e-01, -1.680458e-01, 2.047890e-01}, {-3.577827e-01, -1.533075e-01, 1.068441e-01}, {-2.598728e-01, -1.689783e-01, 2.183599e-01}, {-3.304347e-01, -1.368587e-01, 1.864968e-01}, {-2.536709e-01, -1.239264e-01, 2.409145e-01}, {-3.064067e-01, -1.149084e-01, 2.132208e-01}, {-2.036934e-01, -1.142985e-01, 2.422692e-01}, {-2.474757e-01, -8.437341e-02, 2.375579e-01}, {-1.701694e-01, -1.662315e-01, 2.338636e-01}, {-1.656221e-01, -1.217207e-01, 2.420264e-01}, {-1.719846e-01, -7.758006e-02, 2.372957e-01}, {-1.152757e-01, -4.659966e-02, 2.227641e-01}, {-2.146129e-01, -4.150209e-02, 2.286885e-01}, {-1.622253e-01, -4.443113e-02, 2.259207e-01}, {-6.440260e-02, -4.517994e-02, 2.309991e-01}, {-1.507722e-01, -5.988754e-03, 2.096344e-01}, {-2.150721e-02, -6.696469e-02, 2.438756e-01}, {-5.811862e-02, -6.146436e-03, 2.108494e-01}, {2.777967e-02, -5.981803e-02, 2.652369e-01}, {-1.617144e-02, 1.119739e-02, 2.133022e-01}, {5.274558e-03, -5.357894e-02, 2.388629e-01}, {8.708782e-02, -6.192095e-02, 2.793944e-01}, {3.191016e-02, -4.514871e-02, 2.370319e-01}, {4.730478e-02, 6.330683e-05, 2.326259e-01}, {9.279154e-02, -4.266259e-02, 2.366803e-01}, {1.375915e-01, -6.528340e-02, 2.645868e-01}, {1.474010e-01, -3.385558e-03, 2.177980e-01}, {1.844259e-01, -4.045041e-02, 2.457416e-01}, {2.171753e-01, -2.542710e-02, 2.130199e-01}, {9.714137e-02, 1.569320e-02, 2.261411e-01}, {1.915658e-01, -3.823154e-04, 2.095048e-01}, {1.298981e-01, 6.390943e-02, 1.899317e-01}, {7.955950e-02, 5.724895e-02, 2.021856e-01}, {8.984801e-02, 6.962290e-02, 1.877494e-01}, {5.353719e-03, 5.350876e-02, 1.903929e-01}, {5.347596e-02, 9.609194e-02, 1.487497e-01}, {-6.514852e-02, 4.911352e-02, 1.564408e-01}, {-3.534169e-03, 6.983417e-02, 1.605743e-01}, {-9.933203e-02, 2.288819e-02, 1.834475e-01}, {-1.104430e-01, 7.104784e-02, 1.419407e-01}, {-5.583639e-02, 7.857489e-02, 9.293140e-02}, {3.841582e-02, 1.013176e-01, 1.257327e-01}, {-1.498673e-01, 6.144281e-02, 1.437416e-01}, {-1.381195e-01, 9.911474e-02, 8.224155e-02}, {-1.990770e-01, 2.218162e-02, 1.890342e-01}, {-9.840160e-02, 9.032541e-02, 5.486926e-02}, {-5.770292e-02, 8.079711e-02, 5.866108e-02}, {-1.314570e-01, 9.668173e-02, 3.095302e-02}, {-1.208488e-01, 8.271782e-02, -2.775780e-02}, {2.092883e-02, 1.001098e-01, 4.856507e-02}, {-1.630296e-01, 1.403519e-01, 6.822623e-02}, {-6.239503e-02, 6.710825e-02, -6.759141e-03}, {-1.706850e-01, 9.444285e-02, -1.148588e-02}, {-1.609734e-01, 1.171731e-01, 1.261883e-01}, {-7.574359e-02, 5.834547e-02, -3.201729e-02}, {-1.739235e-01, 9.128516e-02, 1.737146e-01}, {-3.615467e-02, 5.424203e-02, -4.213998e-02}, {-1.795087e-01, 6.630334e-02, 1.891593e-01}, {-1.201292e-01, 3.477882e-02, -6.887025e-02}, {-1.516594e-01, 5.961813e-02, -5.808135e-02}, {9.841641e-03, 8.161994e-02, -9.943909e-03}, {5.858759e-02, 1.070288e-01, 4.138527e-02}, {6.559005e-03, 3.667399e-02, -7.060764e-02}, {1.133565e-01, 1.129837e-01, 7.148327e-02}, {5.457847e-02, 8.782963e-02, -2.660378e-02}, {9.604857e-02, 1.074525e-01, 1.921750e-02}, {1.312854e-01, 1.093665e-01, 1.064905e-01}, {1.559931e-01, 1.028033e-01, 3.525319e-02}, {1.395751e-01, 9.933247e-02, 1.423111e-01}, {1.909799e-01, 8.726785e-02, 1.028129e-01}, {1.515612e-01, 8.190271e-02, 1.655588e-01}, {1.991819e-01, 8.021215e-02, 2.475846e-02}, {1.929922e-01, 5.306164e-02, 1.778301e-01}, {2.089947e-01, 7.316427e-02, 1.308969e-01}, {2.359255e-01, 8.454184e-03, 1.842522e-01}, {2.405119e-01, 4.416880e-02, 1.404998e-01}, {2.417637e-01, 5.387670e-02, 6.822137e-02}, {2.676489e-01, 1.680393e-02, 1.377036e-01}, {2.722432e-01, -6.094768e-02, 1.909024e-01}, {2.864911e-01, -9.998380e-02, 1.910103e-01}, {2.947166e-01, -4.551766e-02, 1.429248e-01}, {2.987345e-01, -1.444781e-01, 1.751738e-01}, {3.161955e-01, -9.545453e-02, 1.299557e-01}, {3.049382e-01, -3.710632e-02, 8.216494e-02}, {3.110164e-01, -2.064128e-01, 1.452663e-01}, {3.186296e-01, -1.485304e-01, 1.352784e-01}, {3.270754e-01, -1.708405e-01, 1.009349e-01}, {3.214546e-01, -7.772036e-02, 5.870647e-02}, {2.884137e-01, -5.068832e-03, 7.476860e-02}, {3.041034e-01, -4.540078e-02, 5.327542e-03}, {2.628862e-01, 2.482947e-02, 1.729271e-02}, {2.214987e-01, 5.350905e-02, -7.441596e-03}, {2.787536e-01, -3.877351e-02, -4.121604e-02}, {1.362560e-01, 8.888093e-02, -1.766452e-02}, {2.543947e-01, 8.426472e-03, -3.083190e-02}, {1.521449e-01, 5.156352e-02, -6.360140e-02}, {9.842808e-02, 7.512197e-02, -3.805923e-02}, {7.841750e-02, 5.910081e-02, -5.283282e-02}, {1.031599e-01, 2.268643e-02, -9.502155e-02}, {5.647855e-02, 2.779424e-02, -7.917641e-02}, {1.934259e-01, -2.292100e-02, -8.384155e-02}, {1.471477e-01, -2.039075e-02, -9.522372e-02}, {2.412170e-01, -2.013578e-02, -6.274826e-02}, {1.846008e-01, -4.865951e-02, -1.075812e-01}, {2.314118e-01, -6.692336e-02, -8.882647e-02}, {6.987165e-02, 2.283017e-03, -1.025288e-01}, {1.570039e-01, -6.931094e-02, -1.158602e-01}, {4.336388e-02, 1.737794e-03, -1.030971e-01}, {9.773428e-02, -5.212006e-02, -1.106962e-01}, {3.072935e-02, -4.583906e-02, -1.170049e-01}, {-6.354220e-04, -1.840810e-02, -1.073135e-01}, {5.618203e-02, -5.948973e-02, -1.311413e-01}, {-1.788853e-02, 8.793446e-03, -9.299278e-02}, {-6.145983e-03, -6.269401e-02, -1.208776e-01}, {-7.059447e-02, -2.167292e-02, -1.055427e-01}, {-1.011836e-01, 1.122650e-02, -8.576475e-02}, {-9.962890e-02, -3.390691e-02, -1.012433e-01}, {-1.777445e-01, -5.362050e-02, -1.063422e-01}, {-5.367959e-02, -7.705149e-02, -1.203251e-01}, {5.317513e-02, -7.319447e-02, -1.606048e-01}, {-1.108497e-01, -9.442298e-02, -1.134703e-01}, {-1.106261e-02, -8.381563e-02, -1.687618e-01}, {1.059989e-01, -8.084381e-02, -1.581173e-01}, {4.895742e-02, -9.785384e-02, -1.788849e-01}, {-5.865106e-02, -1.013314e-01, -1.551173e-01}, {1.466755e-01, -1.123033e-01, -1.538341e-01}, {-2.077847e-02, -1.045037e-01, -1.835872e-01}, {1.076637e-01, -1.746755e-01, -1.738113e-01}, {1.930479e-01, -1.019869e-01, -1.204018e-01}, {2.129971e-01, -1.593531e-01, -1.234724e-01}, {2.274676e-01, -1.080861e-01, -1.063739e-01}, {1.503014e-01, -2.069713e-01, -1.564288e-01}, {2.684104e-01, -1.549411e-01, -8.291527e-02}, {2.069223e-01, -2.139829e-01, -1.301498e-01}, {2.805157e-01, -1.190681e-01, -7.635475e-02}, {2.655911e-01, -8.108377e-02, -6.674280e-02}, {3.016520e-01, -8.257030e-02, -2.447089e-02}, {3.224745e-01, -9.354723e-02, 2.652687e-02}, {3.145959e-01, -1.366107e-01, -1.484463e-02}, {3.310630e-01, -1.897818e-01, 6.211984e-02}, {3.172323e-01, -1.559825e-01, -8.323129e-04}, {3.026530e-01, -1.661399e-01, -3.111713e-02}, {2.695302e-01, -1.902741e-01, -7.119102e-02}, {3.047706e-01, -2.141517e-01, -1.744906e-02}, {2.903315e-01, -2.175732e-01, -5.189347e-02}, {2.613168e-01, -2.112743e-01, -8.084957e-02}, {3.246573e-01, -2.037216e-01, 2.688626e-02}, {3.133700e-01, -2.323771e-01, 4.065558e-03}, {2.627279e-01, -2.636950e-01, -6.739771e-02}, {2.774770e-01, -2.889830e-01, -2.780536e-02}, {3.472404e-01, -2.505004e-01, -8.453102e-03}, {2.219119e-01, -2.597731e-01, -1.116911e-01}, {2.455460e-01, -3.091696e-01, -5.509391e-02}, {1.566222e-01, -2.526734e-01, -1.458165e-01}, {2.310825e-01, -3.163872e-01, -8.676682e-02}, {1.966529e-01, -2.912217e-01, -1.300290e-01}, {1.064978e-01, -2.219765e-01, -1.653485e-01}, {1.370322e-01, -2.965667e-01, -1.469768e-01}, {5.961547e-02, -1.606338e-01, -1.865997e-01}, {1.134128e-01, -2.901334e-01, -1.491156e-01}, {4.761283e-02, -2.523489e-01, -1.749954e-01}, {7.130697e-03, -1.351202e-01, -1.958791e-01}, {7.322205e-03, -2.152760e-01, -1.892797e-01}, {-5.158721e-02, -1.289168e-01, -1.841878e-01}, {-3.045102e-02, -1.957481e-01, -1.921667e-01}, {6.831622e-03, -2.706793e-01, -1.748533e-01}, {3.558391e-02, -2.904774e-01, -1.658947e-01}, {8.596737e-02, -3.272915e-01, -1.429265e-01}, {2.060894e-02, -3.294869e-01, -1.471069e-01}, {-3.686586e-02, -2.325680e-01, -1.720525e-01}, {1.592478e-03, -3.412858e-01, -1.367712e-01}, {-2.642075e-02, -3.053868e-01, -1.444658e-01}, {8.342162e-02, -3.476425e-01, -1.235965e-01}, {-7.571977e-02, -1.696641e-01, -1.647835e-01}, {1.554673e-01, -3.211750e-01, -1.287690e-01}, {-9.339105e-02, -1.359436e-01, -1.167322e-01}, {1.990325e-01, -3.283071e-01, -1.016405e-01}, {1.409056e-01, -3.638067e-01, -1.139623e-01}, {1.029517e-01, -3.860301e-01, -1.150334e-01}, {2.176817e-01, -3.494460e-01, -2.482951e-02}, {1.530628e-01, -3.929366e-01, -9.682287e-02}, {1.757928e-01, -3.887307e-01, -7.598617e-02}, {3.214830e-02, -3.730705e-01, -1.260531e-01}, {5.132937e-02, -3.957663e-01, -1.006113e-01}, {-4.265867e-02, -3.411687e-01, -1.420014e-01}, {-1.338544e-02, -3.912403e-01, -1.356988e-01}, {1.286078e-01, -3.897090e-01, -6.778339e-02}, {-6.227856e-02, -3.968901e-01, -1.456009e-01}, {-3.029173e-02, -3.969284e-01, -1.062959e-01}, {9.415796e-03, -3.856411e-01, -8.579918e-02}, {1.426167e-01, -3.935101e-01, -3.264844e-02}, {6.466951e-02, -3.685688e-01, -6.037965e-02}, {2.058484e-01, -3.876152e-01, 3.628968e-03}, {1.242898e-01, -3.724883e-01, -4.056673e-02}, {1.079957e-01, -3.946138e-01, 4.910634e-02}, {7.982022e-02, -3.709237e-01, 1.323441e-02}, {-2.135439e-02, -3.740377e-01, -7.861519e-02}, {-6.570993e-02, -3.860979e-01, -9.192215e-02}, {-1.053281e-01, -3.937192e-01, -8.388013e-02}, {-1.422590e-01, -3.982147e-01, -1.038957e-01}, {-1.006650e-01, -3.889512e-01, -1.535832e-01}, {-1.498820e-01, -3.618749e-01, -8.120626e-02}, {-1.412733e-01, -3.955580e-01, -1.306703e-01}, {-1.003952e-01, -3.374228e-01, -1.294427e-01}, {-1.227817e-01, -3.363796e-01, -1.020184e-01}, {-1.311996e-01, -3.280649e-01, -5.326022e-02}, {-6.455215e-02, -3.138239e-01, -1.041615e-01}, {-1.888538e-01, -2.931897e-01, -2.689984e-02}, {-8.854961e-02, -3.063335e-01, -4.776618e-02}, {-1.816134e-01, -2.363867e-01, -4.802983e-02}, {-1.475566e-01, -2.834328e-01, -4.986265e-02}, {-8.427741e-02, -2.785649e-01, -4.717014e-02}, {-4.843410e-02, -2.857057e-01, -1.373583e-01}, {-6.842934e-02, -2.238093e-01, -1.378999e-01}, {-8.626993e-02, -2.104852e-01, -9.678356e-02}, {-1.126702e-01, -2.125484e-01, -7.602102e-02}, {-1.264440e-01, -1.285961e-01, -1.039960e-01}, {-1.532229e-01, -2.253381e-01, -6.917280e-02}, {-1.534185e-01, -1.792882e-01, -8.523153e-02}, {-1.959618e-01, -1.997470e-01, -7.514418e-02}, {-1.499796e-01, -6.350096e-02, -1.062137e-01}, {-1.941307e-01, -1.518421e-01, -1.037490e-01}, {-2.375920e-01, -2.509879e-01, -8.662866e-03}, {-2.535684e-01, -1.703470e-01, -8.300712e-02}, {-2.338757e-01, -2.065371e-01, -6.710635e-02}, {-2.703789e-01, -2.186160e-01, -2.191417e-02}, {-2.208925e-01, -1.030453e-01, -9.862062e-02}, {-2.807891e-01, -1.789885e-01, -6.264913e-02}, {-3.179044e-01, -1.887645e-01, -2.055838e-02}, {-2.982801e-01, -1.329548e-01, -7.355224e-02}, {-3.476564e-01, -1.759247e-01, 3.338825e-02}, {-3.547772e-01, -1.357451e-01, 6.070333e-03}, {-3.680121e-01, -1.287521e-01, 5.202687e-02}, {-3.657093e-01, -1.237405e-01, 1.270387e-01}, {-3.734369e-01, -9.510368e-02, 4.739676e-02}, {-3.790565e-01, -9.254422e-02, 1.129564e-01}, {-3.719141e-01, -6.624204e-02, 1.318539e-01}, {-3.499347e-01, -9.884135e-02, -1.908175e-02}, {-3.786182e-01, -4.746961e-02, 7.972857e-02}, {-3.120091e-01, -9.324665e-02, -6.067729e-02}, {-3.683835e-01, -6.065187e-02, 3.327182e-02}, {-3.417948e-01, -3.820951e-02, -1.527509e-02}, {-2.950829e-01, -6.963543e-02, -6.760965e-02}, {-2.582227e-01, -9.011068e-02, -8.293500e-02}, {-2.963481e-01, 2.012915e-02, -2.836824e-02}, {-2.208845e-01, -5.096154e-02, -9.173360e-02}, {-2.476507e-01, -3.418018e-02, -7.841098e-02}, {-1.879601e-01, 4.287931e-03, -8.587431e-02}, {-2.211707e-01, 6.487653e-03, -7.634725e-02}, {-2.279352e-01, 5.223123e-02, -4.157341e-02}, {-2.641317e-01, 3.437361e-02, -3.813875e-02}, {-2.013175e-01, 1.168412e-01, -1.784299e-02}, {-2.279838e-01, 9.077528e-02, -3.282662e-02}, {-1.747194e-01, 1.503687e-01, 1.921722e-02}, {-2.373035e-01, 1.510617e-01, -2.834834e-02}, {-2.738371e-01, 9.389907e-02, -3.966421e-02}, {-3.221333e-01, 8.157427e-02, -2.498339e-02}, {-3.172453e-01, 1.239877e-01, -2.270618e-02}, {-3.616074e-01, 6.986672e-02, -4.201502e-03}, {-3.281746e-01, 7.375760e-03, -2.204984e-03}, {-2.666714e-01, 1.595029e-01, -3.301630e-02}, {-3.613855e-01, -1.110192e-02, 5.581855e-02}, {-3.875266e-01, 2.927889e-02, 4.679052e-02}, {-3.610332e-01, -1.682172e-02, 1.040836e-01}, {-3.685406e-01, 4.924982e-03, 1.070094e-01}, {-3.478638e-01, -1.545791e-02, 1.423117e-01}, {-3.953196e-01, 2.382067e-02, 9.804440e-02}, {-3.792689e-01, 2.496384e-02, 1.484471e-01}, {-3.424595e-01, -6.547647e-02, 1.726519e-01}, {-3.059895e-01, -3.868752e-02, 1.980876e-01}, {-3.080685e-01, -1.323912e-02, 1.935547e-01}, {-2.574179e-01, -5.291731e-02, 2.251900e-01}, {-2.583874e-01, 7.232429e-04, 2.013025e-01}, {-3.724556e-01, 1.175077e-02, 2.288884e-01}, {-2.316008e-01, 4.206834e-02, 2.234967e-01}, {-3.212401e-01, 2.759828e-03, 2.433060e-01}, {-2.830491e-01, 1.003679e-02, 2.602416e-01}, {-2.209154e-01, 6.649742e-02, 2.256639e-01}, {-2.569398e-01, 5.335011e-02, 2.791217e-01}, {-2.996321e-01, 2.702649e-02, 2.781529e-01}, {-2.970209e-01, 6.085587e-02, 2.880439e-01}, {-2.757004e-01, 1.119672e-01, 2.666120e-01}, {-2.000177e-01, 9.907819e-02, 2.003016e-01}, {-2.384672e-01, 1.407501e-01, 1.975224e-01}, {-1.872199e-01, 1.288808e-01, 1.647480e-01}, {-1.892148e-01, 1.451524e-01, 1.533556e-01}, {-1.843812e-01, 1.682539e-01, 1.099840e-01}, {-1.963396e-01, 1.643326e-01, 1.591610e-01}, {-1.782588e-01, 1.938922e-01, 8.583124e-02}, {-2.031070e-01, 2.261345e-01, 1.580783e-01}, {-2.280268e-01, 1.752440e-01, 1.959645e-01}, {-2.469196e-01, 1.747364e-01, 2.124427e-01}, {-2.160832e-01, 2.194891e-01, 1.830387e-01}, {-2.731793e-01, 1.676271e-01, 2.430633e-01}, {-2.814692e-01, 1.857413e-01, 2.336137e-01}, {-2.668653e-01, 2.229579e-01, 1.888214e-01}, {-3.114552e-01, 1.789204e-01, 2.416214e-01}, {-3.258368e-01, 1.169871e-01, 2.813875e-01}, {-3.267026e-01, 7.239141e-02, 2.772718e-01}, {-3.676360e-01, 4.382475e-02, 2.580976e-01}, {-3.620222e-01, 9.856985e-02, 2.618130e-01}, {-3.537371e-01, 1.530896e-01, 2.376953e-01}, {-3.967738e-01, 5.913219e-02, 2.253699e-01}, {-3.791237e-01, 1.226979e-01, 2.079482e-01}, {-3.965348e-01, 3.779761e-02, 1.950487e-01}, {-3.955100e-01, 6.341234e-02, 1.651896e-01}, {-3.886446e-01, 9.810550e-02, 1.783394e-01}, {-4.050000e-01, 6.288667e-02, 9.133427e-02}, {-3.748658e-01, 1.390537e-01, 1.578123e-01}, {-3.754968e-01, 1.185097e-01, 2.717307e-02}, {-4.003284e-01, 9.920701e-02, 9.990834e-02}, {-3.853491e-01, 1.348051e-01, 9.362511e-02}, {-3.759070e-01, 1.708549e-01, 1.742512e-01}, {-3.895545e-01, 2.014199e-01, 1.195680e-01}, {-3.514577e-01, 2.064978e-01, 1.805691e-01}, {-3.721824e-01, 1.787017e-01, 6.451345e-02}, {-3.138594e-01, 2.282858e-01, 1.654091e-01}, {-3.695232e-01, 2.205642e-01, 1.131079e-01}, {-3.751536e-01, 2.094143e-01, 7.433115e-02}, {-3.297268e-01, 2.333461e-01, 9.424703e-02}, {-2.611284e-01, 2.395097e-01, 1.323654e-01}, {-2.873247e-01, 2.408246e-01, 1.058166e-01}, {-3.295912e-01, 2.282974e-01, 5.067560e-02}, {-2.165747e-01, 2.384998e-01, 6.107254e-02}, {-2.904373e-01, 2.354524e-01, 2.499185e-02}, {-3.492454e-01, 2.131983e-01, 3.401672e-02}, {-3.132519e-01, 2.250926e-01, 2.380161e-03}, {-3.442888e-01, 1.521898e-01, 1.008080e-02}, {-3.121806e-01, 1.831774e-01, -2.066533e-02}, {-3.118747e-01, 2.236799e-01, -3.378395e-02}, {-2.849874e-01, 1.765795e-01, -6.374017e-02}, {-3.073394e-01, 2.061632e-01, -6.974804e-02}, {-3.109403e-01, 2.667267e-01, -7.667381e-02}, {-3.006156e-01, 2.036609e-01, -1.353679e-01}, {-2.878247e-01, 2.655952e-01, -4.323975e-02}, {-2.602297e-01, 1.804821e-01, -9.186024e-02}, {-2.435673e-01, 1.960407e-01, -9.889631e-02}, {-2.655419e-01, 1.953448e-01, -1.448559e-01}, {-2.875104e-01, 2.063993e-01, -2.153102e-01}, {-2.957244e-01, 2.330731e-01, -1.415031e-01}, {-2.564129e-01, 2.211751e-01, -2.126513e-01}, {-2.752401e-01, 2.296729e-01, -2.570463e-01}, {-3.213789e-01, 2.685292e-01, -1.236052e-01}, {-2.798978e-01, 2.683275e-01, -2.337053e-01}, {-2.927001e-01, 3.017494e-01, -1.106678e-01}, {-2.956563e-01, 2.798271e-01, -1.926023e-01}, {-3.273885e-01, 3.030806e-01, -1.894554e-01}, {-2.709746e-01, 3.103536e-01, -2.728657e-01}, {-3.229953e-01, 3.459068e-01, -2.457299e-01}, {-2.892318e-01, 3.456290e-01, -2.710325e-01}, {-2.411702e-01, 3.264311e-01, -3.149304e-01}, {-2.975260e-01, 3.376050e-01, -2.053725e-01}, {-2.714546e-01, 3.710473e-01, -2.764896e-01}, {-2.419023e-01, 3.571764e-01, -3.017302e-01}, {-2.290298e-01, 3.016079e-01, -3.115706e-01}, {-2.392697e-01, 3.289626e-01, -2.656076e-01}, {-2.485357e-01, 2.472569e-01, -2.806842e-01}, {-2.380808e-01, 2.711937e-01, -2.323650e-01}, {-2.326641e-01, 2.367489e-01, -1.515265e-01}, {-2.387666e-01, 2.881329e-01, -2.038978e-01}, {-2.309659e-01, 2.585533e-01, -1.545728e-01}, {-2.345833e-01, 2.368715e-01, -7.629739e-02}, {-2.702200e-01, 3.245628e-01, -1.960222e-01}, {-2.534720e-01, 2.920772e-01, -1.261775e-01}, {-2.622988e-01, 2.566229e-01, -4.616245e-02}, {-2.374206e-01, 2.080803e-01, -2.254022e-02}, {-2.678506e-01, 2.337970e-01, 1.275535e-02}, {-2.427884e-01, 2.303369e-01, 1.659802e-02}, {-2.175700e-01, 1.812724e-01, -6.173841e-03}, {-1.833022e-01, 1.686367e-01, 9.693009e-03}, {-2.236543e-01, 2.264768e-01, 9.147885e-03}, {-1.604408e-01, 2.107405e-01, -1.567671e-02}, {-1.602600e-01, 1.796449e-01, 3.290092e-02}, {-1.570153e-01, 1.838227e-01, 5.224481e-03}, {-1.282301e-01, 2.636953e-01, -5.184929e-02}, {-9.333451e-02, 2.412654e-01, -4.988746e-02}, {-1.017073e-01, 2.129005e-01, 9.177472e-03}, {-1.649559e-01, 2.149677e-01, 6.546510e-02}, {-1.873329e-01, 2.253777e-01, 8.155233e-02}, {-1.638566e-01, 2.683809e-01, 4.230234e-02}, {-1.177311e-01, 2.402305e-01, 3.414526e-02}, {-1.716807e-01, 2.900095e-01, 1.503433e-02}, {-1.407028e-01, 2.506163e-01, 4.003521e-02}, {-1.003839e-01, 3.300511e-01, 5.138082e-03}, {-1.114102e-01, 2.699008e-01, 8.078252e-03}, {-1.536983e-01, 2.924422e-01, -2.938699e-02}, {-1.217230e-01, 3.296259e-01, -3.237535e-02}, {-8.067005e-02, 2.998623e-01, -7.685286e-02}, {-5.039757e-02, 3.398542e-01, -8.881952e-02}, {-5.419047e-02, 3.745126e-01, -4.522864e-02}, {-2.093773e-03, 3.993176e-01, -1.097275e-01}, {-2.691872e-02, 3.857084e-01, -5.314276e-02}, {1.686656e-02, 3.822388e-01, -1.403366e-01}, {6.365819e-03, 3.813415e-01, -9.999236e-02}, {-6.903446e-02, 3.027536e-01, -3.280888e-02}, {2.977096e-02, 3.418510e-01, -1.104632e-01}, {-2.268050e-02, 3.326241e-01, -1.066084e-01}, {4.228685e-02, 3.127448e-01, -1.331327e-01}, {4.811712e-03, 3.081062e-01, -1.071534e-01}, {-3.413407e-02, 2.769781e-01, -7.514112e-02}, {3.907269e-02, 2.840759e-01, -8.720787e-02}, {-3.387612e-02, 2.513320e-01, -4.718212e-02}, {1.374781e-02, 2.734943e-01, -4.777974e-02}, {-2.315792e-02, 2.464547e-01, -2.505784e-02}, {-5.634835e-02, 2.763631e-01, -1.986813e-02}, {-3.633993e-02, 2.625152e-01, -7.084974e-03}, {-5.704461e-02, 2.547127e-01, 1.149657e-02}, {1.393876e-01, -3.854664e-01, 4.289868e-02}, {1.993143e-01, -3.843474e-01, 8.390702e-02}, {1.830975e-01, -3.936427e-01, 1.187905e-02}, {2.168849e-01, -3.926011e-01, 5.197912e-02}, {2.598603e-01, -3.884772e-01, 6.060996e-02}, {2.823369e-01, -3.671486e-01, 5.654305e-03}, {2.748472e-01, -3.796868e-01, 9.328336e-02}, {3.202027e-01, -3.588275e-01, 5.609190e-02}, {3.195431e-01, -3.100224e-01, -2.409481e-02}, {3.343854e-01, -2.843519e-01, -2.406047e-02}, {3.497389e-01, -3.159993e-01, -8.085766e-04}, {3.739521e-01, -2.687750e-01, 5.903652e-03}, {3.483656e-01, -3.369541e-01, 2.655309e-02}, {3.736651e-01, -3.107937e-01, 2.648005e-02}, {3.873958e-01, -2.154175e-01, 2.783101e-02}, {4.050000e-01, -2.536600e-01, 5.268210e-02}, {3.951935e-01, -2.903362e-01, 7.665489e-02}, {3.741119e-01, -3.226266e-01, 7.648475e-02}, {3.898574e-01, -2.899421e-01, 1.173724e-01}, {3.459913e-01, -3.409605e-01, 1.163403e-01}, {4.030822e-01, -2.271846e-01, 9.777817e-02}, {3.864422e-01, -2.000716e-01, 5.017292e-02}, {3.794356e-01, -1.924476e-01, 9.947271e-02}, {3.749025e-01, -2.522255e-01, 1.528115e-01}, {3.292027e-01, -2.059559e-01, 1.239889e-01}, {3.630494e-01, -2.156264e-01, 1.450089e-01}, {3.206314e-01, -2.893187e-01, 1.793792e-01}, {3.666108e-01, -2.842780e-01, 1.523715e-01}, {3.086769e-01, -3.186070e-01, 1.774405e-01}, {3.195167e-01, -3.362266e-01, 1.540539e-01}, {2.525075e-01, -3.626450e-01, 1.511764e-01}, {2.516370e-01, -3.725609e-01, 1.358060e-01}, {2.083602e-01, -3.787011e-01, 1.672034e-01}}};
 
-constexpr std::array<glm::u32vec3, 1176> bunny_indices = {{{244, 4, 11}, {0, 475, 8}, {475, 6, 8}, {525, 515, 282}, {69, 50, 116}, {459, 548, 10}, {69, 453, 5}, {3, 518, 513}, {458, 526, 513}, {81, 11, 4}, {91, 534, 172}, {22, 25, 21}, {4, 244, 12}, {474, 241, 297}, {14, 244, 11}, {81, 94, 11}, {442, 441, 462}, {492, 16, 421}, {466, 452, 426}, {87, 572, 56}, {437, 45, 444}, {69, 5, 50}, {442, 432, 441}, {129, 134, 25}, {18, 129, 25}, {13, 265, 198}, {265, 174, 386}, {577, 583, 557}, {13, 198, 9}, {104, 377, 68}, {363, 417, 254}, {421, 29, 488}, {231, 335, 361}, {9, 18, 13}, {12, 14, 57}, {6, 479, 27}, {25, 22, 18}, {265, 24, 174}, {265, 13, 24}, {564, 77, 12}, {27, 479, 417}, {18, 22, 15}, {24, 13, 19}, {564, 12, 57}, {492, 421, 472}, {581, 567, 313}, {315, 54, 127}, {456, 433, 490}, {25, 134, 30}, {363, 255, 417}, {511, 526, 293}, {363, 261, 255}, {81, 83, 116}, {567, 262, 313}, {76, 530, 69}, {407, 483, 532}, {19, 15, 24}, {532, 377, 407}, {69, 530, 391}, {398, 210, 586}, {174, 24, 569}, {58, 236, 235}, {67, 15, 26}, {127, 54, 564}, {377, 65, 407}, {392, 262, 567}, {574, 443, 588}, {8, 32, 26}, {25, 317, 21}, {569, 24, 31}, {262, 43, 39}, {32, 6, 334}, {256, 59, 72}, {262, 392, 35}, {91, 423, 251}, {228, 7, 2}, {67, 480, 24}, {315, 294, 54}, {301, 425, 574}, {343, 311, 304}, {172, 67, 32}, {31, 24, 480}, {392, 38, 35}, {35, 43, 262}, {40, 43, 35}, {342, 420, 362}, {503, 376, 424}, {255, 585, 27}, {514, 314, 185}, {25, 30, 317}, {527, 553, 16}, {41, 34, 39}, {530, 473, 376}, {44, 43, 40}, {41, 39, 44}, {27, 423, 334}, {21, 0, 26}, {256, 14, 357}, {39, 43, 44}, {497, 588, 37}, {34, 41, 49}, {116, 94, 81}, {49, 88, 34}, {68, 377, 70}, {70, 377, 532}, {172, 334, 91}, {334, 423, 91}, {132, 551, 276}, {30, 134, 92}, {390, 452, 582}, {49, 171, 401}, {57, 14, 256}, {73, 94, 50}, {72, 57, 256}, {40, 46, 52}, {44, 40, 52}, {141, 547, 302}, {196, 67, 172}, {47, 474, 312}, {1, 2, 7}, {336, 378, 571}, {481, 247, 380}, {254, 261, 363}, {239, 278, 487}, {523, 35, 38}, {41, 44, 52}, {294, 68, 83}, {383, 374, 175}, {315, 75, 294}, {127, 48, 315}, {49, 41, 171}, {153, 297, 157}, {47, 53, 165}, {46, 523, 237}, {46, 40, 523}, {165, 53, 51}, {73, 228, 14}, {357, 14, 228}, {47, 312, 53}, {229, 586, 210}, {32, 334, 172}, {229, 79, 325}, {53, 312, 297}, {417, 1, 239}, {46, 237, 279}, {52, 46, 563}, {532, 440, 473}, {563, 171, 41}, {394, 240, 419}, {532, 473, 70}, {20, 92, 2}, {68, 70, 83}, {239, 1, 453}, {236, 53, 153}, {51, 206, 126}, {382, 72, 198}, {54, 294, 81}, {294, 83, 81}, {54, 81, 77}, {51, 53, 58}, {500, 563, 279}, {563, 46, 279}, {53, 236, 58}, {228, 73, 50}, {300, 79, 550}, {391, 239, 453}, {270, 550, 226}, {51, 58, 206}, {440, 532, 483}, {75, 68, 294}, {428, 392, 567}, {487, 417, 239}, {297, 241, 157}, {157, 576, 215}, {94, 116, 50}, {70, 473, 83}, {11, 73, 14}, {573, 564, 57}, {206, 58, 408}, {216, 202, 208}, {104, 68, 75}, {170, 176, 409}, {116, 76, 69}, {448, 206, 356}, {81, 4, 77}, {54, 77, 564}, {297, 153, 53}, {188, 190, 164}, {473, 530, 76}, {83, 473, 76}, {408, 58, 235}, {377, 104, 65}, {356, 206, 337}, {57, 72, 359}, {72, 382, 359}, {69, 391, 453}, {2, 1, 249}, {453, 1, 7}, {573, 124, 564}, {83, 76, 116}, {378, 537, 283}, {77, 4, 12}, {215, 576, 243}, {465, 482, 506}, {244, 14, 12}, {62, 159, 197}, {84, 89, 216}, {382, 265, 386}, {245, 399, 314}, {99, 158, 86}, {207, 161, 133}, {224, 144, 136}, {216, 89, 85}, {338, 36, 191}, {549, 219, 159}, {351, 103, 133}, {62, 549, 159}, {95, 89, 84}, {203, 85, 86}, {501, 90, 455}, {455, 90, 450}, {135, 161, 122}, {62, 384, 549}, {85, 89, 192}, {181, 393, 138}, {179, 406, 205}, {86, 101, 99}, {137, 559, 131}, {205, 103, 179}, {354, 124, 352}, {93, 89, 95}, {535, 113, 306}, {409, 179, 351}, {95, 84, 147}, {89, 93, 192}, {86, 192, 101}, {98, 158, 99}, {386, 158, 98}, {263, 230, 210}, {475, 479, 6}, {192, 86, 85}, {506, 200, 493}, {489, 123, 409}, {489, 161, 125}, {192, 106, 101}, {175, 306, 136}, {409, 406, 179}, {2, 249, 387}, {194, 170, 415}, {393, 133, 403}, {125, 161, 135}, {492, 360, 498}, {170, 123, 415}, {95, 147, 193}, {121, 125, 135}, {26, 22, 21}, {192, 93, 100}, {464, 165, 268}, {97, 93, 95}, {100, 93, 97}, {489, 125, 415}, {425, 326, 305}, {131, 234, 146}, {125, 121, 269}, {351, 161, 489}, {489, 409, 351}, {286, 455, 412}, {382, 198, 265}, {8, 26, 0}, {20, 21, 317}, {406, 136, 205}, {92, 20, 317}, {100, 106, 192}, {1, 417, 249}, {196, 534, 400}, {304, 56, 96}, {100, 97, 105}, {147, 84, 212}, {98, 99, 109}, {234, 399, 225}, {113, 137, 224}, {137, 535, 559}, {193, 187, 108}, {97, 95, 193}, {399, 245, 225}, {108, 97, 193}, {99, 101, 107}, {103, 205, 403}, {403, 205, 144}, {355, 120, 199}, {304, 96, 64}, {105, 97, 108}, {107, 101, 106}, {98, 109, 373}, {234, 225, 570}, {111, 100, 105}, {99, 107, 109}, {382, 98, 373}, {31, 416, 569}, {224, 430, 182}, {178, 238, 273}, {146, 142, 182}, {123, 489, 415}, {373, 109, 183}, {182, 430, 146}, {246, 471, 133}, {107, 106, 111}, {351, 179, 103}, {121, 560, 120}, {431, 108, 187}, {111, 106, 100}, {348, 120, 344}, {136, 406, 167}, {105, 118, 111}, {112, 107, 111}, {115, 109, 112}, {109, 107, 112}, {183, 109, 115}, {225, 245, 303}, {348, 121, 120}, {108, 117, 105}, {136, 113, 224}, {238, 143, 273}, {112, 111, 118}, {171, 194, 401}, {401, 194, 415}, {273, 187, 213}, {117, 108, 431}, {401, 88, 49}, {161, 351, 133}, {569, 158, 174}, {118, 105, 117}, {222, 400, 534}, {122, 161, 207}, {348, 269, 121}, {585, 240, 27}, {117, 431, 154}, {480, 67, 196}, {92, 317, 30}, {238, 214, 227}, {344, 400, 348}, {115, 112, 119}, {561, 128, 151}, {253, 160, 162}, {183, 115, 484}, {196, 400, 344}, {121, 135, 560}, {119, 112, 118}, {484, 115, 119}, {381, 307, 367}, {386, 174, 158}, {36, 143, 191}, {207, 23, 122}, {118, 117, 367}, {559, 535, 164}, {103, 403, 133}, {207, 133, 471}, {133, 393, 246}, {344, 120, 355}, {170, 409, 123}, {225, 303, 145}, {500, 279, 71}, {120, 560, 199}, {119, 118, 307}, {392, 449, 38}, {154, 272, 366}, {307, 118, 367}, {238, 191, 143}, {367, 117, 154}, {263, 436, 230}, {154, 366, 367}, {137, 430, 224}, {401, 415, 125}, {430, 137, 131}, {125, 269, 401}, {370, 289, 166}, {348, 88, 269}, {137, 113, 535}, {20, 475, 0}, {269, 88, 401}, {272, 379, 366}, {164, 336, 559}, {463, 37, 464}, {176, 406, 409}, {167, 406, 176}, {399, 131, 74}, {124, 354, 130}, {432, 305, 326}, {127, 564, 124}, {129, 59, 357}, {127, 124, 130}, {126, 268, 51}, {560, 135, 122}, {354, 128, 130}, {520, 449, 392}, {534, 91, 222}, {224, 182, 144}, {430, 131, 146}, {306, 113, 136}, {149, 127, 130}, {48, 127, 149}, {23, 207, 471}, {151, 128, 354}, {35, 523, 40}, {399, 234, 131}, {149, 130, 128}, {151, 540, 561}, {182, 142, 155}, {149, 128, 561}, {412, 303, 245}, {163, 173, 412}, {507, 552, 345}, {180, 219, 549}, {389, 152, 232}, {138, 393, 140}, {520, 463, 449}, {36, 272, 154}, {193, 150, 186}, {563, 41, 52}, {152, 227, 214}, {349, 138, 140}, {55, 82, 221}, {545, 17, 200}, {148, 151, 335}, {143, 36, 431}, {148, 531, 319}, {20, 0, 21}, {156, 364, 152}, {346, 504, 217}, {288, 177, 364}, {37, 463, 541}, {393, 155, 140}, {36, 338, 272}, {512, 424, 575}, {504, 184, 338}, {134, 129, 228}, {554, 274, 580}, {221, 218, 181}, {393, 403, 155}, {344, 480, 196}, {349, 221, 181}, {314, 399, 74}, {197, 150, 212}, {148, 319, 540}, {195, 180, 549}, {195, 549, 218}, {37, 165, 464}, {129, 357, 228}, {195, 218, 232}, {544, 502, 522}, {186, 159, 213}, {140, 155, 142}, {390, 582, 511}, {59, 9, 198}, {55, 221, 349}, {512, 515, 525}, {558, 364, 156}, {36, 154, 431}, {186, 187, 193}, {339, 379, 184}, {520, 541, 463}, {155, 403, 144}, {142, 146, 554}, {37, 443, 165}, {505, 575, 347}, {227, 152, 364}, {212, 150, 147}, {182, 155, 144}, {346, 217, 220}, {273, 143, 187}, {142, 554, 102}, {575, 505, 512}, {178, 273, 219}, {218, 384, 181}, {219, 273, 213}, {227, 220, 238}, {389, 156, 152}, {151, 354, 335}, {193, 147, 150}, {246, 393, 181}, {263, 552, 507}, {217, 504, 338}, {177, 346, 227}, {218, 549, 384}, {246, 384, 62}, {270, 320, 550}, {201, 158, 416}, {214, 178, 195}, {232, 214, 195}, {181, 138, 349}, {475, 387, 479}, {219, 180, 178}, {213, 187, 186}, {134, 228, 2}, {232, 218, 389}, {227, 346, 220}, {389, 82, 156}, {272, 338, 379}, {62, 471, 246}, {183, 359, 373}, {247, 481, 531}, {175, 167, 383}, {314, 74, 185}, {196, 172, 534}, {159, 186, 150}, {217, 338, 191}, {191, 220, 217}, {218, 221, 389}, {504, 339, 184}, {260, 339, 504}, {142, 102, 189}, {531, 148, 247}, {338, 184, 379}, {181, 384, 246}, {37, 588, 443}, {177, 227, 364}, {335, 231, 148}, {367, 366, 568}, {204, 201, 416}, {316, 346, 177}, {158, 569, 416}, {8, 6, 32}, {159, 150, 197}, {431, 187, 143}, {238, 220, 191}, {151, 148, 540}, {178, 180, 195}, {26, 32, 67}, {82, 389, 221}, {219, 213, 159}, {71, 388, 168}, {88, 166, 289}, {370, 166, 400}, {306, 369, 42}, {374, 369, 175}, {136, 144, 205}, {388, 383, 169}, {168, 388, 169}, {171, 563, 500}, {370, 400, 222}, {411, 321, 281}, {160, 298, 164}, {160, 164, 162}, {42, 162, 306}, {369, 306, 175}, {520, 392, 428}, {520, 428, 508}, {162, 164, 535}, {586, 229, 325}, {383, 167, 169}, {19, 18, 15}, {521, 420, 342}, {13, 18, 19}, {164, 298, 188}, {162, 535, 306}, {500, 71, 168}, {88, 348, 166}, {343, 304, 64}, {166, 348, 400}, {371, 235, 521}, {72, 59, 198}, {167, 175, 136}, {92, 134, 2}, {500, 168, 170}, {171, 500, 170}, {170, 194, 171}, {3, 546, 509}, {546, 141, 509}, {169, 176, 170}, {170, 168, 169}, {235, 337, 408}, {223, 395, 291}, {167, 176, 169}, {333, 80, 28}, {55, 64, 82}, {508, 541, 520}, {178, 214, 238}, {448, 61, 126}, {61, 291, 395}, {388, 71, 223}, {71, 454, 223}, {519, 502, 544}, {341, 39, 419}, {341, 340, 321}, {164, 190, 336}, {156, 82, 368}, {374, 291, 61}, {64, 285, 368}, {412, 173, 286}, {37, 541, 497}, {152, 214, 232}, {173, 545, 200}, {173, 200, 286}, {342, 435, 66}, {374, 448, 356}, {94, 73, 11}, {61, 448, 374}, {510, 547, 546}, {417, 479, 249}, {201, 355, 199}, {201, 344, 355}, {480, 344, 204}, {447, 284, 390}, {253, 362, 60}, {529, 321, 411}, {228, 50, 5}, {245, 299, 163}, {579, 131, 559}, {368, 82, 64}, {368, 558, 156}, {298, 160, 310}, {235, 371, 337}, {211, 190, 188}, {188, 270, 211}, {408, 337, 206}, {240, 585, 340}, {340, 419, 240}, {447, 467, 284}, {439, 542, 544}, {362, 543, 60}, {270, 188, 267}, {204, 344, 201}, {285, 141, 302}, {199, 202, 203}, {454, 279, 237}, {200, 506, 286}, {559, 571, 579}, {371, 521, 342}, {336, 190, 378}, {508, 63, 541}, {20, 387, 475}, {340, 585, 257}, {511, 582, 510}, {480, 204, 31}, {286, 506, 501}, {211, 378, 190}, {66, 371, 342}, {9, 59, 129}, {337, 371, 110}, {371, 66, 110}, {203, 202, 209}, {203, 201, 199}, {567, 63, 428}, {428, 63, 508}, {209, 202, 216}, {270, 226, 211}, {206, 448, 126}, {204, 416, 31}, {65, 360, 407}, {208, 212, 216}, {454, 395, 223}, {362, 253, 435}, {209, 216, 85}, {203, 209, 85}, {340, 257, 321}, {320, 300, 550}, {211, 226, 436}, {212, 84, 216}, {378, 211, 537}, {9, 129, 18}, {211, 436, 263}, {211, 263, 537}, {299, 78, 163}, {226, 550, 79}, {226, 79, 229}, {230, 226, 229}, {436, 226, 230}, {439, 331, 542}, {228, 5, 7}, {263, 398, 552}, {230, 229, 210}, {145, 450, 350}, {493, 465, 506}, {250, 233, 521}, {235, 236, 250}, {87, 574, 588}, {264, 449, 463}, {347, 258, 505}, {233, 114, 420}, {233, 420, 521}, {250, 521, 235}, {86, 201, 203}, {197, 471, 62}, {584, 63, 567}, {303, 455, 145}, {560, 202, 199}, {145, 455, 450}, {163, 412, 245}, {423, 27, 240}, {23, 471, 197}, {242, 268, 126}, {523, 264, 237}, {581, 584, 567}, {420, 114, 362}, {153, 157, 250}, {341, 313, 262}, {242, 126, 395}, {63, 577, 541}, {275, 271, 517}, {270, 267, 320}, {394, 289, 370}, {587, 589, 529}, {419, 34, 289}, {515, 276, 551}, {27, 334, 6}, {261, 254, 281}, {281, 257, 261}, {251, 240, 394}, {240, 251, 423}, {276, 277, 132}, {145, 548, 446}, {487, 266, 411}, {546, 547, 141}, {242, 395, 237}, {589, 587, 581}, {242, 264, 268}, {257, 255, 261}, {242, 237, 264}, {541, 577, 497}, {577, 588, 497}, {577, 572, 588}, {395, 126, 61}, {454, 237, 395}, {233, 215, 114}, {251, 394, 370}, {560, 122, 208}, {505, 258, 502}, {266, 587, 411}, {411, 587, 529}, {529, 589, 313}, {584, 583, 63}, {267, 298, 280}, {360, 427, 494}, {370, 222, 251}, {266, 538, 282}, {278, 239, 410}, {463, 268, 264}, {87, 588, 572}, {236, 153, 250}, {331, 390, 293}, {212, 208, 197}, {250, 157, 233}, {322, 173, 163}, {3, 509, 518}, {278, 410, 538}, {251, 222, 91}, {157, 215, 233}, {455, 286, 501}, {581, 313, 589}, {39, 341, 262}, {390, 511, 293}, {449, 523, 38}, {524, 517, 277}, {517, 562, 277}, {449, 264, 523}, {455, 303, 412}, {146, 234, 554}, {576, 157, 241}, {276, 519, 524}, {281, 321, 257}, {453, 7, 5}, {578, 581, 587}, {457, 485, 376}, {268, 463, 464}, {282, 515, 551}, {411, 254, 487}, {188, 298, 267}, {583, 584, 132}, {282, 516, 266}, {341, 529, 313}, {517, 271, 562}, {577, 63, 583}, {515, 519, 276}, {278, 538, 266}, {74, 131, 579}, {510, 582, 139}, {528, 458, 513}, {277, 562, 132}, {208, 23, 197}, {457, 490, 485}, {271, 275, 528}, {341, 321, 529}, {278, 266, 487}, {362, 114, 543}, {482, 90, 501}, {309, 114, 215}, {528, 275, 458}, {501, 506, 482}, {276, 524, 277}, {266, 516, 587}, {558, 285, 287}, {364, 558, 288}, {110, 66, 42}, {319, 327, 540}, {287, 285, 302}, {288, 558, 287}, {28, 323, 539}, {458, 275, 542}, {302, 290, 287}, {492, 483, 407}, {80, 320, 28}, {293, 458, 542}, {290, 139, 533}, {516, 578, 587}, {526, 458, 293}, {323, 280, 185}, {407, 360, 492}, {185, 280, 514}, {189, 102, 301}, {45, 437, 429}, {287, 290, 292}, {280, 298, 514}, {331, 439, 522}, {309, 215, 324}, {397, 17, 322}, {503, 424, 512}, {141, 96, 509}, {292, 290, 533}, {42, 253, 162}, {413, 405, 78}, {64, 141, 285}, {295, 292, 533}, {296, 287, 292}, {288, 287, 296}, {177, 288, 296}, {581, 578, 584}, {357, 59, 256}, {425, 305, 45}, {533, 469, 295}, {296, 292, 295}, {556, 572, 577}, {557, 556, 577}, {299, 308, 478}, {252, 308, 299}, {189, 311, 140}, {443, 438, 460}, {316, 177, 296}, {67, 24, 15}, {140, 142, 189}, {565, 296, 295}, {316, 296, 259}, {507, 283, 537}, {308, 324, 478}, {114, 309, 543}, {346, 316, 504}, {578, 551, 584}, {358, 300, 80}, {260, 259, 332}, {163, 78, 322}, {325, 300, 358}, {311, 189, 301}, {295, 469, 565}, {255, 27, 417}, {245, 314, 299}, {314, 252, 299}, {466, 582, 452}, {545, 173, 322}, {140, 343, 349}, {33, 309, 252}, {311, 301, 304}, {343, 140, 311}, {259, 296, 565}, {260, 316, 259}, {17, 545, 322}, {102, 425, 301}, {301, 87, 304}, {548, 145, 350}, {290, 547, 139}, {514, 33, 252}, {56, 509, 96}, {259, 565, 332}, {551, 578, 516}, {444, 432, 442}, {551, 132, 584}, {462, 444, 442}, {132, 562, 583}, {320, 280, 323}, {28, 320, 323}, {309, 324, 308}, {254, 417, 487}, {443, 574, 438}, {33, 543, 309}, {343, 55, 349}, {435, 342, 362}, {215, 243, 324}, {33, 60, 543}, {60, 33, 310}, {299, 478, 413}, {60, 310, 160}, {304, 87, 56}, {441, 324, 243}, {254, 411, 281}, {252, 309, 308}, {499, 397, 422}, {556, 56, 572}, {78, 299, 413}, {301, 574, 87}, {225, 145, 570}, {555, 450, 90}, {492, 498, 527}, {300, 320, 80}, {55, 343, 64}, {319, 318, 327}, {478, 324, 441}, {533, 466, 469}, {562, 557, 583}, {451, 474, 47}, {310, 33, 514}, {337, 110, 356}, {234, 570, 274}, {165, 451, 47}, {263, 507, 537}, {551, 516, 282}, {267, 280, 320}, {557, 562, 271}, {531, 553, 527}, {531, 527, 318}, {390, 284, 452}, {64, 96, 141}, {298, 310, 514}, {319, 531, 318}, {369, 356, 110}, {445, 496, 566}, {318, 527, 498}, {51, 268, 165}, {498, 327, 318}, {325, 358, 586}, {252, 314, 514}, {498, 494, 327}, {300, 325, 79}, {454, 71, 279}, {323, 185, 74}, {326, 425, 102}, {358, 80, 333}, {328, 540, 327}, {470, 332, 329}, {553, 531, 470}, {358, 333, 345}, {330, 328, 327}, {434, 328, 330}, {330, 327, 494}, {418, 48, 434}, {329, 332, 477}, {552, 398, 345}, {330, 75, 418}, {208, 202, 560}, {330, 418, 434}, {183, 484, 359}, {332, 565, 477}, {553, 329, 536}, {347, 575, 495}, {10, 499, 422}, {75, 330, 427}, {481, 339, 260}, {336, 571, 559}, {580, 274, 405}, {122, 23, 208}, {580, 326, 102}, {274, 570, 446}, {576, 241, 462}, {478, 326, 580}, {326, 478, 432}, {347, 566, 258}, {477, 486, 329}, {366, 380, 372}, {375, 361, 354}, {568, 366, 372}, {548, 396, 446}, {365, 375, 352}, {579, 248, 539}, {260, 332, 470}, {477, 414, 486}, {518, 556, 557}, {539, 323, 74}, {119, 365, 484}, {361, 372, 231}, {466, 533, 139}, {485, 495, 424}, {379, 481, 380}, {380, 247, 372}, {573, 57, 359}, {419, 289, 394}, {307, 381, 375}, {119, 307, 365}, {354, 361, 335}, {241, 474, 460}, {341, 419, 340}, {124, 484, 365}, {307, 375, 365}, {374, 356, 369}, {241, 444, 462}, {427, 104, 75}, {361, 568, 372}, {481, 379, 339}, {510, 139, 547}, {528, 557, 271}, {366, 379, 380}, {518, 56, 556}, {253, 42, 435}, {481, 260, 470}, {253, 60, 160}, {359, 484, 573}, {539, 74, 579}, {451, 460, 474}, {373, 359, 382}, {374, 383, 291}, {375, 354, 352}, {90, 482, 555}, {413, 478, 580}, {255, 257, 585}, {375, 381, 361}, {48, 418, 315}, {249, 479, 387}, {573, 484, 124}, {443, 460, 451}, {365, 352, 124}, {576, 462, 243}, {248, 507, 345}, {243, 462, 441}, {538, 410, 282}, {482, 465, 555}, {381, 568, 361}, {531, 481, 470}, {39, 34, 419}, {98, 382, 386}, {274, 446, 405}, {557, 528, 518}, {34, 88, 289}, {110, 42, 369}, {345, 333, 385}, {345, 385, 248}, {293, 542, 331}, {571, 283, 579}, {381, 367, 568}, {360, 494, 498}, {451, 165, 443}, {424, 376, 485}, {586, 358, 398}, {385, 333, 28}, {580, 102, 554}, {507, 579, 283}, {385, 539, 248}, {385, 28, 539}, {561, 540, 328}, {435, 42, 66}, {291, 388, 223}, {579, 507, 248}, {20, 2, 387}, {509, 56, 518}, {422, 396, 459}, {391, 530, 503}, {446, 396, 402}, {445, 488, 467}, {476, 488, 445}, {470, 329, 553}, {422, 397, 396}, {483, 456, 457}, {433, 476, 490}, {452, 284, 426}, {22, 26, 15}, {499, 465, 493}, {460, 444, 241}, {396, 397, 402}, {421, 433, 472}, {414, 565, 469}, {459, 10, 422}, {488, 461, 467}, {566, 495, 476}, {467, 496, 445}, {3, 511, 510}, {397, 322, 404}, {461, 284, 467}, {10, 555, 465}, {426, 414, 469}, {460, 438, 437}, {492, 472, 483}, {468, 421, 16}, {315, 418, 75}, {456, 490, 457}, {499, 493, 17}, {414, 284, 491}, {139, 582, 466}, {468, 329, 486}, {402, 397, 404}, {522, 439, 544}, {158, 201, 86}, {258, 566, 522}, {522, 502, 258}, {368, 285, 558}, {440, 483, 457}, {432, 444, 45}, {528, 513, 518}, {457, 376, 440}, {456, 472, 433}, {65, 427, 360}, {536, 16, 553}, {446, 402, 405}, {402, 404, 405}, {149, 561, 353}, {527, 16, 492}, {491, 461, 29}, {421, 488, 433}, {210, 398, 263}, {536, 468, 16}, {548, 459, 396}, {525, 282, 503}, {468, 536, 329}, {353, 561, 328}, {469, 466, 426}, {302, 547, 290}, {350, 450, 555}, {345, 398, 358}, {468, 486, 29}, {404, 78, 405}, {247, 231, 372}, {483, 472, 456}, {445, 566, 476}, {503, 530, 376}, {517, 542, 275}, {231, 247, 148}, {3, 510, 546}, {410, 503, 282}, {544, 542, 517}, {433, 488, 476}, {491, 486, 414}, {391, 503, 410}, {461, 488, 29}, {512, 505, 515}, {350, 555, 10}, {234, 274, 554}, {496, 447, 331}, {149, 353, 48}, {504, 316, 260}, {29, 421, 468}, {405, 413, 580}, {424, 495, 575}, {388, 291, 383}, {239, 391, 410}, {437, 444, 460}, {544, 524, 519}, {566, 347, 495}, {461, 491, 284}, {465, 499, 10}, {477, 565, 414}, {496, 331, 522}, {513, 526, 3}, {446, 570, 145}, {490, 495, 485}, {284, 414, 426}, {17, 493, 200}, {331, 447, 390}, {330, 494, 427}, {544, 517, 524}, {473, 440, 376}, {490, 476, 495}, {486, 491, 29}, {499, 17, 397}, {104, 427, 65}, {353, 328, 434}, {429, 425, 45}, {574, 425, 429}, {429, 438, 574}, {404, 322, 78}, {526, 511, 3}, {519, 505, 502}, {522, 566, 496}, {525, 503, 512}, {297, 312, 474}, {434, 48, 353}, {378, 283, 571}, {305, 432, 45}, {438, 429, 437}, {447, 496, 467}, {10, 548, 350}, {515, 505, 519}, {432, 478, 441}}};
+constexpr std::array<glm::u32vec3, 1176> bunny_indices = {{{0, 1, 2}, {2, 3, 0}, {4, 2, 1}, {4, 3, 2}, {0, 5, 1}, {4, 1, 6}, {5, 6, 1}, {0, 3, 7}, {5, 0, 7}, {8, 3, 4}, {5, 9, 6}, {10, 4, 6}, {5, 11, 9}, {4, 10, 12}, {12, 8, 4}, {13, 10, 6}, {6, 9, 13}, {12, 10, 14}, {10, 13, 14}, {15, 13, 9}, {9, 11, 15}, {15, 16, 13}, {11, 17, 15}, {15, 17, 16}, {5, 18, 11}, {5, 7, 18}, {11, 18, 19}, {11, 19, 17}, {7, 20, 18}, {20, 19, 18}, {7, 21, 20}, {22, 19, 20}, {21, 22, 20}, {17, 19, 23}, {23, 19, 22}, {16, 17, 24}, {23, 24, 17}, {13, 16, 25}, {25, 14, 13}, {16, 24, 26}, {26, 25, 16}, {23, 27, 24}, {26, 24, 28}, {24, 27, 28}, {29, 25, 26}, {28, 30, 26}, {29, 26, 30}, {28, 27, 31}, {30, 28, 32}, {31, 32, 28}, {32, 33, 30}, {29, 30, 33}, {34, 32, 31}, {34, 33, 32}, {35, 31, 27}, {27, 23, 35}, {31, 36, 34}, {31, 35, 36}, {34, 37, 33}, {36, 38, 34}, {34, 38, 37}, {36, 35, 39}, {39, 38, 36}, {40, 35, 23}, {41, 39, 35}, {35, 40, 41}, {42, 40, 23}, {42, 23, 22}, {41, 40, 43}, {42, 43, 40}, {41, 43, 44}, {43, 42, 45}, {46, 41, 44}, {46, 39, 41}, {47, 44, 43}, {47, 43, 45}, {48, 45, 42}, {48, 42, 22}, {49, 45, 48}, {45, 49, 47}, {48, 22, 49}, {50, 44, 47}, {49, 50, 47}, {49, 22, 51}, {50, 49, 51}, {51, 22, 52}, {22, 21, 52}, {53, 44, 50}, {46, 44, 53}, {51, 54, 50}, {50, 55, 53}, {54, 55, 50}, {56, 54, 51}, {52, 56, 51}, {56, 57, 54}, {56, 52, 58}, {56, 58, 57}, {54, 57, 59}, {57, 58, 59}, {54, 60, 55}, {59, 60, 54}, {52, 61, 58}, {60, 62, 55}, {61, 52, 63}, {52, 21, 63}, {64, 62, 60}, {64, 60, 59}, {63, 21, 65}, {21, 7, 65}, {63, 65, 66}, {67, 65, 7}, {67, 66, 65}, {3, 67, 7}, {68, 63, 66}, {68, 61, 63}, {3, 8, 67}, {68, 66, 69}, {67, 69, 66}, {68, 70, 61}, {67, 71, 69}, {72, 70, 68}, {68, 69, 73}, {73, 72, 68}, {71, 74, 69}, {74, 73, 69}, {74, 71, 75}, {73, 74, 76}, {76, 74, 75}, {77, 72, 73}, {76, 77, 73}, {78, 70, 72}, {77, 78, 72}, {61, 70, 79}, {61, 79, 58}, {58, 79, 59}, {70, 78, 80}, {79, 70, 80}, {81, 59, 79}, {81, 82, 59}, {59, 82, 64}, {81, 79, 83}, {83, 82, 81}, {79, 84, 83}, {79, 80, 84}, {83, 85, 82}, {83, 84, 86}, {86, 85, 83}, {84, 80, 87}, {84, 88, 86}, {87, 88, 84}, {85, 86, 89}, {89, 86, 88}, {90, 87, 80}, {89, 91, 85}, {90, 80, 92}, {78, 92, 80}, {90, 93, 87}, {93, 88, 87}, {94, 92, 78}, {95, 89, 88}, {89, 95, 91}, {93, 96, 88}, {95, 88, 96}, {97, 93, 90}, {92, 98, 90}, {98, 97, 90}, {92, 94, 98}, {97, 99, 93}, {99, 96, 93}, {98, 100, 97}, {97, 100, 99}, {101, 98, 94}, {102, 100, 98}, {102, 98, 101}, {103, 99, 100}, {102, 103, 100}, {99, 104, 96}, {103, 104, 99}, {96, 104, 105}, {105, 95, 96}, {103, 106, 104}, {105, 107, 95}, {105, 104, 108}, {108, 107, 105}, {104, 109, 108}, {109, 104, 106}, {110, 107, 108}, {109, 111, 108}, {110, 108, 111}, {112, 109, 106}, {109, 112, 111}, {113, 95, 107}, {91, 95, 113}, {107, 110, 114}, {107, 114, 113}, {113, 115, 91}, {85, 91, 115}, {114, 116, 113}, {117, 85, 115}, {82, 85, 117}, {118, 115, 113}, {113, 116, 118}, {117, 115, 118}, {82, 117, 119}, {82, 119, 64}, {118, 120, 117}, {119, 117, 120}, {116, 121, 118}, {116, 114, 121}, {118, 122, 120}, {118, 121, 122}, {119, 120, 123}, {120, 122, 123}, {119, 123, 124}, {124, 64, 119}, {122, 125, 123}, {123, 125, 124}, {64, 124, 126}, {62, 64, 126}, {124, 125, 127}, {127, 126, 124}, {122, 128, 125}, {129, 62, 126}, {62, 129, 55}, {130, 128, 122}, {122, 121, 130}, {131, 55, 129}, {55, 131, 53}, {53, 131, 132}, {129, 132, 131}, {46, 53, 132}, {129, 133, 132}, {129, 126, 133}, {46, 132, 134}, {133, 134, 132}, {126, 135, 133}, {126, 127, 135}, {136, 46, 134}, {46, 136, 39}, {137, 134, 133}, {136, 138, 39}, {39, 138, 38}, {134, 139, 136}, {138, 140, 38}, {140, 37, 38}, {141, 139, 134}, {134, 137, 141}, {136, 139, 142}, {143, 139, 141}, {142, 139, 143}, {144, 136, 142}, {144, 138, 136}, {142, 143, 145}, {144, 142, 145}, {138, 144, 146}, {146, 140, 138}, {147, 144, 145}, {146, 144, 148}, {147, 148, 144}, {143, 149, 145}, {145, 149, 147}, {149, 143, 150}, {141, 150, 143}, {147, 149, 151}, {150, 141, 152}, {137, 152, 141}, {149, 150, 153}, {149, 153, 151}, {154, 150, 152}, {137, 154, 152}, {150, 155, 153}, {154, 155, 150}, {156, 154, 137}, {155, 154, 157}, {156, 157, 154}, {156, 137, 158}, {158, 137, 133}, {133, 135, 158}, {156, 158, 159}, {158, 135, 159}, {159, 160, 156}, {159, 135, 160}, {156, 160, 157}, {135, 161, 160}, {161, 135, 127}, {162, 157, 160}, {160, 161, 163}, {162, 160, 163}, {161, 127, 164}, {125, 164, 127}, {164, 125, 128}, {161, 165, 163}, {163, 165, 162}, {166, 164, 128}, {128, 130, 166}, {164, 167, 161}, {166, 130, 168}, {168, 130, 121}, {164, 166, 169}, {169, 167, 164}, {166, 168, 170}, {166, 170, 169}, {171, 168, 121}, {171, 121, 114}, {168, 172, 170}, {172, 168, 171}, {170, 172, 173}, {173, 169, 170}, {174, 172, 171}, {172, 174, 173}, {114, 175, 171}, {175, 174, 171}, {114, 110, 175}, {110, 111, 175}, {175, 176, 174}, {175, 111, 177}, {175, 177, 176}, {177, 111, 178}, {174, 176, 179}, {173, 174, 179}, {180, 176, 177}, {180, 177, 178}, {179, 176, 181}, {181, 176, 180}, {173, 179, 182}, {179, 181, 183}, {179, 183, 182}, {173, 182, 184}, {173, 184, 169}, {182, 183, 185}, {182, 185, 184}, {184, 186, 169}, {169, 186, 167}, {185, 187, 184}, {186, 184, 187}, {167, 186, 188}, {167, 188, 161}, {161, 188, 165}, {189, 188, 186}, {189, 165, 188}, {190, 186, 187}, {190, 189, 186}, {191, 187, 185}, {190, 187, 191}, {189, 192, 165}, {193, 189, 190}, {193, 192, 189}, {192, 194, 165}, {162, 165, 194}, {195, 193, 190}, {196, 195, 190}, {196, 190, 191}, {195, 197, 193}, {196, 198, 195}, {197, 195, 198}, {199, 196, 191}, {197, 200, 193}, {196, 199, 201}, {198, 196, 201}, {202, 200, 197}, {198, 202, 197}, {200, 203, 193}, {193, 203, 192}, {201, 204, 198}, {192, 203, 205}, {206, 204, 201}, {205, 207, 192}, {194, 192, 207}, {204, 208, 198}, {206, 208, 204}, {208, 209, 198}, {198, 209, 202}, {201, 210, 206}, {199, 210, 201}, {199, 211, 210}, {199, 191, 211}, {210, 212, 206}, {213, 211, 191}, {211, 214, 210}, {212, 210, 214}, {215, 211, 213}, {214, 211, 215}, {191, 216, 213}, {191, 185, 216}, {213, 217, 215}, {213, 216, 217}, {216, 185, 218}, {185, 183, 218}, {219, 216, 218}, {217, 216, 219}, {218, 183, 220}, {218, 220, 219}, {220, 183, 181}, {221, 217, 219}, {220, 181, 222}, {180, 222, 181}, {219, 220, 223}, {223, 220, 222}, {222, 180, 224}, {224, 180, 178}, {225, 223, 222}, {222, 224, 225}, {226, 219, 223}, {226, 223, 225}, {221, 219, 226}, {225, 224, 227}, {227, 226, 225}, {178, 228, 224}, {228, 227, 224}, {111, 228, 178}, {228, 111, 112}, {112, 229, 228}, {229, 112, 106}, {230, 227, 228}, {230, 228, 229}, {231, 229, 106}, {106, 103, 231}, {230, 229, 232}, {231, 232, 229}, {233, 227, 230}, {232, 233, 230}, {231, 103, 234}, {102, 234, 103}, {231, 235, 232}, {235, 231, 234}, {236, 232, 235}, {235, 234, 236}, {237, 233, 232}, {237, 232, 236}, {238, 227, 233}, {238, 226, 227}, {239, 233, 237}, {239, 238, 233}, {240, 226, 238}, {239, 240, 238}, {240, 241, 226}, {241, 221, 226}, {242, 240, 239}, {221, 241, 243}, {243, 217, 221}, {217, 243, 215}, {240, 244, 241}, {244, 240, 242}, {241, 245, 243}, {241, 244, 245}, {215, 243, 246}, {245, 246, 243}, {214, 215, 246}, {214, 246, 247}, {247, 212, 214}, {246, 248, 247}, {246, 245, 248}, {249, 212, 247}, {247, 248, 249}, {245, 244, 250}, {251, 248, 245}, {245, 250, 251}, {244, 252, 250}, {244, 242, 252}, {253, 250, 252}, {251, 250, 253}, {252, 242, 254}, {252, 254, 253}, {255, 248, 251}, {248, 255, 249}, {251, 253, 256}, {255, 257, 249}, {255, 251, 258}, {251, 256, 258}, {259, 257, 255}, {255, 258, 259}, {249, 257, 260}, {257, 259, 260}, {249, 260, 212}, {259, 258, 261}, {212, 260, 262}, {212, 262, 206}, {260, 259, 263}, {259, 261, 263}, {264, 262, 260}, {264, 260, 263}, {206, 262, 265}, {265, 262, 264}, {265, 208, 206}, {264, 266, 265}, {267, 208, 265}, {265, 266, 267}, {264, 263, 268}, {268, 266, 264}, {269, 263, 261}, {270, 266, 268}, {263, 269, 271}, {263, 271, 268}, {261, 272, 269}, {258, 272, 261}, {258, 256, 272}, {273, 271, 269}, {269, 272, 273}, {268, 271, 274}, {275, 272, 256}, {274, 271, 276}, {273, 276, 271}, {275, 277, 272}, {273, 272, 277}, {256, 278, 275}, {278, 256, 253}, {254, 278, 253}, {278, 279, 275}, {278, 254, 280}, {278, 280, 279}, {281, 275, 279}, {281, 277, 275}, {279, 280, 282}, {283, 281, 279}, {279, 282, 283}, {280, 254, 284}, {280, 284, 282}, {254, 285, 284}, {242, 285, 254}, {242, 286, 285}, {286, 284, 285}, {239, 286, 242}, {287, 286, 239}, {287, 284, 286}, {287, 239, 237}, {284, 287, 288}, {282, 284, 288}, {289, 287, 237}, {236, 289, 237}, {287, 290, 288}, {290, 287, 289}, {282, 288, 291}, {288, 290, 291}, {292, 282, 291}, {283, 282, 292}, {290, 293, 291}, {294, 292, 291}, {294, 291, 293}, {295, 283, 292}, {295, 292, 294}, {293, 290, 296}, {289, 296, 290}, {293, 297, 294}, {297, 293, 296}, {298, 295, 294}, {299, 294, 297}, {298, 294, 299}, {296, 300, 297}, {300, 299, 297}, {301, 295, 298}, {295, 301, 283}, {298, 299, 302}, {301, 303, 283}, {303, 281, 283}, {301, 298, 304}, {304, 298, 302}, {305, 303, 301}, {305, 301, 304}, {303, 306, 281}, {277, 281, 306}, {305, 307, 303}, {306, 308, 277}, {277, 308, 273}, {306, 303, 309}, {307, 309, 303}, {310, 308, 306}, {309, 310, 306}, {308, 311, 273}, {311, 276, 273}, {310, 312, 308}, {308, 312, 311}, {311, 313, 276}, {276, 313, 274}, {312, 314, 311}, {311, 314, 313}, {315, 312, 310}, {314, 312, 315}, {309, 316, 310}, {310, 316, 315}, {317, 316, 309}, {307, 317, 309}, {315, 316, 318}, {317, 318, 316}, {319, 314, 315}, {320, 318, 317}, {321, 315, 318}, {321, 318, 320}, {315, 321, 319}, {320, 317, 322}, {322, 317, 307}, {313, 314, 323}, {323, 314, 319}, {274, 313, 323}, {324, 322, 307}, {324, 307, 305}, {325, 274, 323}, {274, 325, 268}, {325, 270, 268}, {326, 324, 305}, {305, 304, 326}, {327, 322, 324}, {327, 324, 326}, {328, 322, 327}, {329, 326, 304}, {304, 302, 329}, {299, 329, 302}, {327, 326, 330}, {327, 330, 328}, {331, 326, 329}, {330, 326, 331}, {332, 322, 328}, {332, 320, 322}, {328, 330, 333}, {333, 332, 328}, {332, 334, 320}, {320, 334, 321}, {332, 333, 335}, {335, 334, 332}, {336, 333, 330}, {335, 337, 334}, {333, 338, 335}, {338, 337, 335}, {333, 336, 339}, {333, 339, 338}, {340, 336, 330}, {331, 340, 330}, {336, 341, 339}, {331, 342, 340}, {331, 329, 342}, {336, 340, 343}, {343, 341, 336}, {340, 344, 343}, {345, 341, 343}, {343, 344, 345}, {8, 341, 345}, {8, 345, 67}, {345, 344, 67}, {71, 67, 344}, {346, 341, 8}, {341, 346, 339}, {346, 8, 12}, {75, 71, 344}, {347, 339, 346}, {346, 12, 347}, {347, 338, 339}, {347, 12, 348}, {348, 12, 14}, {338, 347, 349}, {349, 347, 348}, {348, 14, 349}, {338, 349, 337}, {25, 349, 14}, {337, 349, 350}, {350, 334, 337}, {25, 351, 349}, {351, 25, 29}, {350, 349, 352}, {352, 349, 351}, {334, 350, 353}, {352, 353, 350}, {351, 354, 352}, {354, 353, 352}, {355, 351, 29}, {351, 355, 354}, {29, 33, 355}, {354, 356, 353}, {356, 334, 353}, {354, 355, 356}, {334, 356, 321}, {355, 33, 357}, {37, 357, 33}, {140, 357, 37}, {356, 355, 358}, {357, 140, 359}, {355, 360, 358}, {357, 360, 355}, {356, 358, 361}, {358, 360, 361}, {321, 356, 362}, {362, 356, 361}, {362, 319, 321}, {362, 363, 319}, {363, 323, 319}, {362, 364, 363}, {363, 364, 323}, {361, 364, 362}, {323, 364, 325}, {365, 364, 361}, {325, 364, 365}, {360, 365, 361}, {365, 366, 325}, {366, 270, 325}, {367, 365, 360}, {357, 367, 360}, {357, 359, 367}, {367, 368, 365}, {365, 368, 366}, {369, 367, 359}, {367, 369, 368}, {370, 270, 366}, {270, 370, 266}, {370, 267, 266}, {368, 371, 366}, {366, 371, 370}, {369, 371, 368}, {370, 371, 267}, {369, 359, 372}, {359, 140, 372}, {372, 140, 146}, {146, 148, 372}, {373, 371, 369}, {372, 374, 369}, {373, 369, 374}, {148, 375, 372}, {372, 375, 374}, {376, 371, 373}, {371, 376, 267}, {377, 373, 374}, {375, 378, 374}, {378, 377, 374}, {378, 375, 148}, {373, 377, 379}, {378, 379, 377}, {373, 379, 376}, {148, 380, 378}, {148, 147, 380}, {380, 147, 151}, {380, 381, 378}, {380, 151, 382}, {380, 382, 381}, {383, 382, 151}, {383, 151, 153}, {382, 384, 381}, {382, 383, 385}, {384, 382, 385}, {383, 153, 386}, {383, 386, 385}, {381, 384, 387}, {378, 381, 387}, {388, 384, 385}, {385, 386, 388}, {387, 389, 378}, {378, 389, 379}, {384, 390, 387}, {384, 388, 390}, {391, 389, 387}, {390, 391, 387}, {389, 392, 379}, {391, 392, 389}, {379, 392, 393}, {379, 393, 376}, {394, 392, 391}, {376, 393, 395}, {376, 395, 267}, {393, 392, 396}, {396, 395, 393}, {392, 394, 396}, {395, 397, 267}, {395, 396, 397}, {208, 267, 397}, {208, 397, 209}, {397, 396, 398}, {209, 397, 398}, {394, 398, 396}, {399, 209, 398}, {399, 202, 209}, {400, 398, 394}, {400, 399, 398}, {401, 202, 399}, {400, 402, 399}, {399, 402, 401}, {202, 401, 403}, {202, 403, 200}, {402, 404, 401}, {405, 402, 400}, {402, 405, 404}, {406, 405, 400}, {394, 406, 400}, {405, 406, 407}, {408, 406, 394}, {407, 406, 408}, {409, 408, 394}, {391, 409, 394}, {409, 391, 390}, {405, 407, 410}, {405, 410, 404}, {390, 411, 409}, {411, 390, 388}, {412, 408, 409}, {411, 412, 409}, {411, 388, 413}, {413, 388, 386}, {413, 414, 411}, {386, 415, 413}, {414, 413, 415}, {411, 414, 416}, {411, 416, 412}, {417, 414, 415}, {414, 417, 416}, {418, 415, 386}, {418, 386, 153}, {418, 153, 155}, {418, 155, 419}, {418, 419, 415}, {157, 419, 155}, {415, 419, 420}, {420, 417, 415}, {419, 157, 421}, {157, 162, 421}, {421, 422, 419}, {162, 422, 421}, {420, 419, 422}, {162, 194, 422}, {420, 423, 417}, {424, 422, 194}, {422, 425, 420}, {420, 425, 423}, {422, 424, 426}, {426, 425, 422}, {194, 427, 424}, {194, 207, 427}, {424, 428, 426}, {424, 427, 428}, {426, 428, 429}, {426, 429, 425}, {430, 429, 428}, {425, 429, 430}, {431, 428, 427}, {428, 431, 430}, {427, 207, 432}, {207, 205, 432}, {432, 433, 427}, {427, 433, 431}, {434, 432, 205}, {432, 434, 433}, {205, 203, 434}, {203, 435, 434}, {203, 436, 435}, {436, 203, 200}, {435, 437, 434}, {437, 435, 436}, {437, 433, 434}, {438, 436, 200}, {438, 200, 403}, {436, 439, 437}, {439, 436, 438}, {433, 437, 440}, {441, 433, 440}, {431, 433, 441}, {440, 437, 442}, {440, 442, 441}, {437, 439, 442}, {443, 431, 441}, {444, 441, 442}, {443, 441, 444}, {442, 445, 444}, {439, 445, 442}, {446, 443, 444}, {446, 444, 445}, {443, 447, 431}, {447, 443, 446}, {430, 431, 447}, {448, 430, 447}, {430, 448, 425}, {449, 425, 448}, {425, 449, 423}, {448, 447, 450}, {449, 448, 450}, {450, 447, 451}, {447, 446, 451}, {452, 449, 450}, {423, 449, 452}, {450, 451, 453}, {450, 453, 452}, {454, 423, 452}, {417, 423, 454}, {454, 455, 417}, {452, 455, 454}, {416, 417, 455}, {452, 456, 455}, {456, 452, 453}, {455, 457, 416}, {455, 456, 457}, {412, 416, 457}, {456, 453, 458}, {457, 459, 412}, {456, 460, 457}, {457, 460, 459}, {460, 456, 458}, {408, 412, 459}, {458, 461, 460}, {461, 459, 460}, {453, 462, 458}, {451, 462, 453}, {461, 458, 463}, {458, 462, 463}, {451, 464, 462}, {462, 464, 463}, {451, 446, 464}, {463, 465, 461}, {465, 459, 461}, {466, 464, 446}, {466, 446, 445}, {463, 464, 467}, {464, 466, 467}, {463, 467, 468}, {465, 463, 468}, {469, 467, 466}, {469, 468, 467}, {466, 445, 470}, {470, 445, 439}, {469, 466, 471}, {471, 466, 470}, {468, 469, 472}, {471, 470, 473}, {473, 470, 439}, {474, 469, 471}, {472, 469, 474}, {468, 472, 475}, {465, 468, 475}, {476, 472, 474}, {476, 475, 472}, {465, 475, 477}, {459, 465, 477}, {459, 477, 408}, {477, 407, 408}, {475, 478, 477}, {477, 478, 407}, {475, 476, 478}, {410, 407, 478}, {478, 476, 479}, {478, 480, 410}, {479, 481, 478}, {478, 481, 480}, {479, 476, 482}, {480, 481, 483}, {482, 476, 484}, {484, 476, 474}, {480, 485, 410}, {480, 483, 485}, {410, 485, 486}, {486, 404, 410}, {483, 487, 485}, {485, 487, 486}, {483, 488, 487}, {489, 483, 481}, {483, 489, 488}, {489, 481, 479}, {490, 487, 488}, {490, 486, 487}, {489, 491, 488}, {491, 490, 488}, {479, 492, 489}, {492, 479, 482}, {489, 493, 491}, {492, 482, 494}, {482, 484, 494}, {492, 495, 489}, {489, 495, 493}, {492, 494, 496}, {492, 496, 495}, {493, 495, 497}, {491, 493, 497}, {495, 496, 498}, {497, 495, 499}, {495, 498, 499}, {491, 497, 500}, {497, 499, 500}, {501, 498, 496}, {494, 501, 496}, {499, 498, 502}, {501, 502, 498}, {499, 503, 500}, {503, 499, 502}, {504, 500, 503}, {500, 504, 491}, {502, 505, 503}, {502, 501, 505}, {503, 505, 504}, {491, 504, 506}, {491, 506, 490}, {506, 504, 507}, {490, 506, 507}, {507, 504, 505}, {508, 490, 507}, {486, 490, 508}, {505, 509, 507}, {507, 510, 508}, {507, 509, 510}, {486, 508, 511}, {510, 511, 508}, {505, 512, 509}, {505, 501, 512}, {501, 494, 512}, {510, 509, 513}, {509, 512, 513}, {512, 494, 513}, {510, 513, 511}, {513, 494, 514}, {513, 514, 511}, {494, 484, 514}, {511, 515, 486}, {511, 514, 515}, {515, 404, 486}, {514, 484, 516}, {514, 516, 515}, {516, 484, 474}, {474, 517, 516}, {517, 515, 516}, {471, 517, 474}, {517, 471, 473}, {518, 404, 515}, {517, 518, 515}, {518, 519, 404}, {404, 519, 401}, {401, 519, 403}, {520, 518, 517}, {520, 517, 473}, {519, 518, 521}, {518, 520, 521}, {519, 522, 403}, {403, 522, 438}, {519, 521, 523}, {519, 523, 522}, {521, 520, 524}, {521, 525, 523}, {521, 524, 525}, {522, 523, 526}, {526, 523, 525}, {438, 522, 527}, {522, 526, 527}, {527, 528, 438}, {528, 439, 438}, {473, 439, 528}, {528, 527, 529}, {529, 473, 528}, {526, 530, 527}, {473, 529, 531}, {520, 473, 531}, {532, 529, 527}, {530, 532, 527}, {532, 533, 529}, {531, 529, 533}, {530, 534, 532}, {534, 533, 532}, {531, 535, 520}, {535, 524, 520}, {533, 536, 531}, {531, 536, 535}, {537, 524, 535}, {524, 537, 525}, {535, 536, 538}, {538, 537, 535}, {539, 536, 533}, {536, 540, 538}, {536, 539, 540}, {541, 539, 533}, {539, 541, 540}, {534, 541, 533}, {540, 542, 538}, {541, 543, 540}, {542, 540, 543}, {544, 543, 541}, {544, 541, 534}, {543, 545, 542}, {544, 545, 543}, {538, 542, 546}, {537, 538, 546}, {546, 542, 547}, {545, 547, 542}, {546, 548, 537}, {547, 548, 546}, {537, 548, 549}, {525, 537, 549}, {548, 547, 550}, {550, 549, 548}, {547, 545, 550}, {525, 549, 551}, {551, 549, 550}, {552, 550, 545}, {551, 550, 552}, {545, 544, 552}, {553, 525, 551}, {552, 553, 551}, {525, 553, 526}, {552, 544, 554}, {544, 534, 554}, {555, 553, 552}, {555, 552, 554}, {553, 556, 526}, {553, 555, 556}, {554, 556, 555}, {554, 534, 556}, {526, 556, 530}, {556, 534, 530}, {557, 558, 75}, {344, 557, 75}, {76, 75, 558}, {557, 344, 559}, {558, 557, 559}, {559, 344, 340}, {342, 559, 340}, {560, 558, 559}, {342, 560, 559}, {76, 558, 560}, {561, 560, 342}, {561, 76, 560}, {562, 561, 342}, {562, 342, 329}, {561, 563, 76}, {563, 77, 76}, {564, 561, 562}, {564, 563, 561}, {562, 329, 565}, {329, 299, 565}, {299, 566, 565}, {300, 566, 299}, {567, 562, 565}, {567, 565, 566}, {568, 566, 300}, {567, 566, 568}, {569, 562, 567}, {562, 569, 564}, {567, 568, 570}, {567, 570, 569}, {300, 571, 568}, {300, 296, 571}, {570, 568, 572}, {568, 571, 572}, {573, 569, 570}, {570, 572, 573}, {574, 569, 573}, {569, 574, 564}, {573, 572, 575}, {575, 574, 573}, {564, 574, 576}, {575, 576, 574}, {564, 576, 563}, {575, 572, 577}, {572, 571, 577}, {296, 578, 571}, {578, 577, 571}, {296, 289, 578}, {578, 579, 577}, {578, 289, 579}, {575, 577, 580}, {289, 581, 579}, {289, 236, 581}, {581, 236, 234}, {581, 234, 102}, {582, 577, 579}, {579, 581, 582}, {102, 582, 581}, {582, 580, 577}, {102, 583, 582}, {583, 580, 582}, {101, 583, 102}, {575, 580, 584}, {583, 584, 580}, {576, 575, 584}, {585, 583, 101}, {585, 584, 583}, {584, 586, 576}, {586, 584, 585}, {587, 585, 101}, {587, 586, 585}, {94, 587, 101}, {586, 588, 576}, {586, 587, 588}, {576, 588, 563}, {563, 588, 77}, {589, 587, 94}, {588, 587, 589}, {588, 589, 77}, {94, 78, 589}, {589, 78, 77}}};
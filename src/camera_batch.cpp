@@ -0,0 +1,149 @@
+#include "camera_batch.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <glm/gtc/constants.hpp>
+#include <imgui.h>
+
+#include "profiler.hpp"
+#include "thread_pool.hpp"
+
+namespace ex2
+{
+
+namespace
+{
+
+//! Upper bound of the points drawn in a cell of the grid view
+constexpr size_t max_cell_points = 4096;
+
+/**
+ * Draw the vertices of one camera inside the square cell at \c min with side length \c extent.
+ */
+void draw_cell(ImDrawList* draw_list, ImVec2 min, float extent, std::span<glm::vec4 const> clip)
+{
+    ImVec2 max = ImVec2(min.x + extent, min.y + extent);
+    draw_list->AddRectFilled(min, max, IM_COL32(255, 255, 255, 255));
+    draw_list->PushClipRect(min, max, true);
+
+    size_t stride = std::max<size_t>(1, (clip.size() + max_cell_points - 1) / max_cell_points);
+    for (size_t i = 0; i < clip.size(); i += stride)
+    {
+        glm::vec4 const& p = clip[i];
+        if (p.w <= 0.f || std::abs(p.x) > p.w || std::abs(p.y) > p.w || std::abs(p.z) > p.w)
+            continue;
+
+        // NDC y points up, screen y down; nearer points are darker
+        glm::vec3 ndc   = glm::vec3(p) / p.w;
+        float     x     = min.x + (0.5f + 0.5f * ndc.x) * extent;
+        float     y     = min.y + (0.5f - 0.5f * ndc.y) * extent;
+        int       shade = static_cast<int>(40.f + 160.f * (0.5f + 0.5f * ndc.z));
+        draw_list->AddRectFilled(ImVec2(x, y), ImVec2(x + 1.5f, y + 1.5f), IM_COL32(shade, shade, shade, 255));
+    }
+
+    draw_list->PopClipRect();
+    draw_list->AddRect(min, max, IM_COL32(0, 0, 0, 255));
+}
+
+} // namespace
+
+void generate_camera_sweep(CameraParameters const& base, CameraBatchSettings const& settings, std::vector<CameraParameters>* parameters)
+{
+    size_t count = static_cast<size_t>(std::max(settings.count, 0));
+    parameters->assign(count, base);
+
+    for (size_t k = 0; k < count; k++)
+    {
+        CameraParameters& camera = (*parameters)[k];
+        camera.azimuth           = base.azimuth + glm::two_pi<float>() * static_cast<float>(k) / static_cast<float>(count);
+
+        if (settings.mixed_projections && k % 2 == 1)
+        {
+            camera.transformation_type = base.transformation_type == TransformationType::Orthographic ? TransformationType::Perspective
+                                                                                                       : TransformationType::Orthographic;
+        }
+    }
+}
+
+void CameraBatch::set_cameras(std::span<CameraParameters const> parameters)
+{
+    m_parameters.assign(parameters.begin(), parameters.end());
+    m_cameras.resize(parameters.size());
+    m_view_projection.resize(parameters.size());
+
+    for (size_t k = 0; k < parameters.size(); k++)
+    {
+        m_cameras[k].set_view(camera_view(camera_position(parameters[k].azimuth)));
+        m_cameras[k].set_projection(camera_projection(parameters[k]));
+        m_view_projection[k] = m_cameras[k].view_projection_matrix();
+    }
+}
+
+void CameraBatch::run(std::span<glm::vec3 const> positions)
+{
+    EX2_PROFILE_ZONE("Camera batch transform");
+
+    size_t camera_count = m_cameras.size();
+
+    // Buffers only ever grow, so steady-state frames do not touch the allocator
+    m_vertex_count = positions.size();
+    if (camera_count * m_vertex_count > m_clip.size())
+        m_clip.resize(camera_count * m_vertex_count);
+
+    glm::mat4 const* matrices     = m_view_projection.data();
+    glm::vec4*       clip         = m_clip.data();
+    size_t           vertex_count = m_vertex_count;
+
+    parallel_for(vertex_count, parallel_threshold, parallel_chunk_size, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            glm::vec4 p = glm::vec4(positions[i], 1.0f);
+            for (size_t k = 0; k < camera_count; k++)
+                clip[k * vertex_count + i] = matrices[k] * p;
+        }
+    });
+}
+
+bool gui_camera_batch(CameraBatchSettings* settings, CameraBatch const& batch)
+{
+    bool changed = false;
+
+    ImGui::Begin("Camera sweep");
+    changed |= ImGui::Checkbox("Camera sweep", &settings->enabled);
+    changed |= ImGui::SliderInt("Cameras", &settings->count, 1, 32);
+    changed |= ImGui::Checkbox("Mixed projections", &settings->mixed_projections);
+    ImGui::SliderInt("Columns", &settings->columns, 1, 8);
+
+    if (settings->enabled && batch.camera_count() > 0)
+    {
+        ImGui::Text("%zu cameras x %zu vertices", batch.camera_count(), batch.vertex_count());
+
+        ImDrawList* draw_list = ImGui::GetWindowDrawList();
+        ImVec2      origin    = ImGui::GetCursorScreenPos();
+        size_t      columns   = static_cast<size_t>(std::max(settings->columns, 1));
+        float       spacing   = 4.f;
+        float       cell      = std::max((ImGui::GetContentRegionAvail().x - spacing * static_cast<float>(columns - 1)) / static_cast<float>(columns), 16.f);
+
+        size_t rows = (batch.camera_count() + columns - 1) / columns;
+        for (size_t k = 0; k < batch.camera_count(); k++)
+        {
+            ImVec2 min = ImVec2(origin.x + static_cast<float>(k % columns) * (cell + spacing), origin.y + static_cast<float>(k / columns) * (cell + spacing));
+            draw_cell(draw_list, min, cell, batch.clip(k));
+
+            CameraParameters const& parameters = batch.parameters(k);
+            if (ImGui::IsMouseHoveringRect(min, ImVec2(min.x + cell, min.y + cell)))
+            {
+                ImGui::SetTooltip("Camera %zu: azimuth %.1f deg, %s", k, static_cast<double>(glm::degrees(parameters.azimuth)),
+                                  parameters.transformation_type == TransformationType::Orthographic ? "orthographic" : "perspective");
+            }
+        }
+
+        ImGui::Dummy(ImVec2(static_cast<float>(columns) * (cell + spacing), static_cast<float>(rows) * (cell + spacing)));
+    }
+    ImGui::End();
+
+    return changed;
+}
+
+} // namespace ex2
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "camera_math.hpp"
+#include "helper.hpp"
+
+namespace ex2
+{
+
+/**
+ * \brief Parameters of the camera sweep, controlled by \c gui_camera_batch(...).
+ */
+struct CameraBatchSettings
+{
+    bool enabled           = false;
+    int  count             = 8;     //!< Number of cameras
+    int  columns           = 4;     //!< Cells per row of the grid view
+    bool mixed_projections = false; //!< Alternate between the transformation type of the GUI and the other one
+};
+
+/**
+ * \brief Spread \c settings.count cameras evenly around the mesh, starting at the camera of the GUI.
+ *
+ * All cameras share the field of view, size and near and far distances of \c base.
+ *
+ * \param[in]  base       The camera parameters of the GUI
+ * \param[in]  settings   The camera count and whether the transformation types alternate
+ * \param[out] parameters The parameters of the cameras
+ */
+void generate_camera_sweep(CameraParameters const& base, CameraBatchSettings const& settings, std::vector<CameraParameters>* parameters);
+
+/**
+ * \brief Transforms one mesh to the clip spaces of many cameras in a single pass over its vertices.
+ *
+ * Transforming the mesh once per camera reads every vertex K times. Here every vertex is loaded once and multiplied by
+ * the view projection matrices of all K cameras, which are small enough to stay in the L1 cache, so the memory traffic
+ * per vertex is one read and K writes.
+ *
+ * The outputs are one clip space buffer per camera, which can be passed to renderers like \c cgtub::NDCRenderer. The
+ * buffers are reused from call to call and only ever grow. Meshes with at least \c parallel_threshold vertices are
+ * split into chunks and transformed on the default thread pool.
+ */
+class CameraBatch
+{
+public:
+    //! Meshes below this size are transformed serially on the calling thread
+    static constexpr size_t parallel_threshold = size_t(1) << 12;
+    //! Number of vertices transformed by a single task, for all cameras
+    static constexpr size_t parallel_chunk_size = size_t(1) << 10;
+
+    /**
+     * \brief Set the cameras, computing their matrices; the clip space buffers are not updated until \c run(...).
+     */
+    void set_cameras(std::span<CameraParameters const> parameters);
+
+    /**
+     * \brief Transform the mesh to the clip spaces of all cameras.
+     *
+     * \param[in] positions The vertex positions in world space
+     */
+    void run(std::span<glm::vec3 const> positions);
+
+    size_t camera_count() const { return m_cameras.size(); }
+    size_t vertex_count() const { return m_vertex_count; }
+
+    CameraParameters const& parameters(size_t camera) const { return m_parameters[camera]; }
+    Camera<float> const&    camera(size_t camera) const { return m_cameras[camera]; }
+
+    //! The positions in clip space of the given camera computed by the last call to \c run(...)
+    std::span<glm::vec4 const> clip(size_t camera) const { return {m_clip.data() + camera * m_vertex_count, m_vertex_count}; }
+
+private:
+    std::vector<CameraParameters> m_parameters;
+    std::vector<Camera<float>>    m_cameras;
+    std::vector<glm::mat4>        m_view_projection; // Contiguous, so the vertex loop reads them from one cache-resident array
+    std::vector<glm::vec4>        m_clip;            // The buffers of all cameras, one after the other
+    size_t                        m_vertex_count = 0;
+};
+
+/**
+ * \brief Show the sweep parameters and the mesh as seen by every camera of \c batch in a grid, in a GUI window.
+ *
+ * Each cell shows the vertices inside the view volume of its camera at their NDC positions, shaded by depth. Large
+ * meshes are thinned out to a fixed number of points per cell.
+ *
+ * \return true if a parameter was changed
+ */
+bool gui_camera_batch(CameraBatchSettings* settings, CameraBatch const& batch);
+
+} // namespace ex2
@@ -0,0 +1,355 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include <glm/glm.hpp>
+
+#include "frustum.hpp"
+
+namespace ex2
+{
+
+/**
+ * \brief The depth range a projection maps the view volume to.
+ */
+enum class DepthRange
+{
+    NegativeOneToOne = 0, //!< The OpenGL convention used by the canvases: the near plane maps to -1, the far plane to 1
+    ReversedZ             //!< The near plane maps to 1, the far plane to 0, which spreads the precision of a floating point depth buffer evenly
+};
+
+/**
+ * \brief A camera matrix together with its inverse, both computed in closed form from the same parameters.
+ */
+template <typename T>
+struct InvertibleMatrix
+{
+    glm::mat<4, 4, T> matrix  = glm::mat<4, 4, T>(1);
+    glm::mat<4, 4, T> inverse = glm::mat<4, 4, T>(1);
+};
+
+/**
+ * \brief A projection matrix, its inverse and the parameters needed to reconstruct its view volume.
+ */
+template <typename T>
+struct Projection : InvertibleMatrix<T>
+{
+    DepthRange depth_range  = DepthRange::NegativeOneToOne;
+    bool       perspective  = false;
+    bool       infinite_far = false;
+    T          znear        = T(0);
+    T          zfar         = T(0); //!< Infinity for projections without a far plane
+
+    //! The depth of the near plane in NDC
+    T near_depth() const { return depth_range == DepthRange::ReversedZ ? T(1) : T(-1); }
+
+    //! The depth of the far plane in NDC
+    T far_depth() const { return depth_range == DepthRange::ReversedZ ? T(0) : T(1); }
+};
+
+/**
+ * \brief Build the view matrix of a camera at \c eye looking at \c target.
+ *
+ * The inverse is the transposed rotation followed by the translation to \c eye.
+ *
+ * \param[in] eye    The position of the camera
+ * \param[in] target The point the camera looks at, different from \c eye
+ * \param[in] up     The up direction, not parallel to the viewing direction
+ */
+template <typename T>
+InvertibleMatrix<T> look_at(glm::vec<3, T> const& eye, glm::vec<3, T> const& target, glm::vec<3, T> const& up);
+
+/**
+ * \brief Build an orthographic projection of the box between the given planes of view space.
+ *
+ * \param[in] znear, zfar  The distances of the near and far plane in front of the camera
+ * \param[in] depth_range  The depth range of the view volume in NDC
+ */
+template <typename T>
+Projection<T> orthographic(T left, T right, T bottom, T top, T znear, T zfar, DepthRange depth_range = DepthRange::NegativeOneToOne);
+
+/**
+ * \brief Build a symmetric perspective projection.
+ *
+ * \param[in] fovy         The vertical field of view in radians
+ * \param[in] aspect       The width of the view volume divided by its height
+ * \param[in] znear, zfar  The distances of the near and far plane in front of the camera
+ * \param[in] depth_range  The depth range of the view volume in NDC
+ */
+template <typename T>
+Projection<T> perspective(T fovy, T aspect, T znear, T zfar, DepthRange depth_range = DepthRange::NegativeOneToOne);
+
+/**
+ * \brief Build a symmetric perspective projection without a far plane, the limit of \c perspective(...) for an infinite \c zfar.
+ */
+template <typename T>
+Projection<T> infinite_perspective(T fovy, T aspect, T znear, DepthRange depth_range = DepthRange::NegativeOneToOne);
+
+/**
+ * \brief A camera with its matrices, their inverses and its view volume, updated whenever the view or projection changes.
+ *
+ * The frustum corners are what \c compute_camera_geometry(...) draws and the planes are what the culling stages test
+ * against, so both are derived once per camera change instead of by every consumer. Nothing is inverted numerically:
+ * all inverses come from the closed forms of the builders.
+ *
+ * Without a far plane, the far corners are placed at \c infinite_far_scale times the near distance for visualization,
+ * and the far plane accepts every point.
+ */
+template <typename T>
+class Camera
+{
+public:
+    using Vec3   = glm::vec<3, T>;
+    using Vec4   = glm::vec<4, T>;
+    using Matrix = glm::mat<4, 4, T>;
+
+    static constexpr T infinite_far_scale = T(100);
+
+    void set_view(InvertibleMatrix<T> const& view);
+    void set_projection(Projection<T> const& projection);
+
+    Matrix const& view_matrix() const { return m_view.matrix; }
+    Matrix const& inverse_view_matrix() const { return m_view.inverse; }
+    Matrix const& projection_matrix() const { return m_projection.matrix; }
+    Matrix const& inverse_projection_matrix() const { return m_projection.inverse; }
+    Matrix const& view_projection_matrix() const { return m_view_projection; }
+
+    Projection<T> const& projection() const { return m_projection; }
+
+    Vec3 position() const { return Vec3(m_view.inverse[3]); }
+    Vec3 forward() const { return -Vec3(m_view.inverse[2]); }
+
+    //! The corners of the view volume, ordered like \c CameraGeometry::frustum_corners: near then far, counterclockwise from the bottom left
+    std::array<Vec3, 8> const& frustum_corners() const { return m_frustum_corners; }
+
+    //! The planes of the view volume, ordered and normalized like the planes of \c Frustum
+    std::array<Vec4, Frustum::plane_count> const& frustum_planes() const { return m_frustum_planes; }
+
+    //! The planes in single precision, for the culling stages
+    Frustum frustum() const;
+
+private:
+    void update();
+
+    InvertibleMatrix<T>                    m_view;
+    Projection<T>                          m_projection;
+    Matrix                                 m_view_projection = Matrix(1);
+    std::array<Vec3, 8>                    m_frustum_corners{};
+    std::array<Vec4, Frustum::plane_count> m_frustum_planes{};
+};
+
+template <typename T>
+InvertibleMatrix<T> look_at(glm::vec<3, T> const& eye, glm::vec<3, T> const& target, glm::vec<3, T> const& up)
+{
+    using Vec3 = glm::vec<3, T>;
+    using Vec4 = glm::vec<4, T>;
+
+    Vec3 forward   = glm::normalize(target - eye);
+    Vec3 right     = glm::normalize(glm::cross(forward, up));
+    Vec3 camera_up = glm::cross(right, forward);
+
+    InvertibleMatrix<T> result;
+    result.matrix[0] = Vec4(right.x, camera_up.x, -forward.x, T(0));
+    result.matrix[1] = Vec4(right.y, camera_up.y, -forward.y, T(0));
+    result.matrix[2] = Vec4(right.z, camera_up.z, -forward.z, T(0));
+    result.matrix[3] = Vec4(-glm::dot(right, eye), -glm::dot(camera_up, eye), glm::dot(forward, eye), T(1));
+
+    result.inverse[0] = Vec4(right, T(0));
+    result.inverse[1] = Vec4(camera_up, T(0));
+    result.inverse[2] = Vec4(-forward, T(0));
+    result.inverse[3] = Vec4(eye, T(1));
+    return result;
+}
+
+template <typename T>
+Projection<T> orthographic(T left, T right, T bottom, T top, T znear, T zfar, DepthRange depth_range)
+{
+    Projection<T> result;
+    result.depth_range = depth_range;
+    result.znear       = znear;
+    result.zfar        = zfar;
+
+    // Every axis is scaled and shifted independently, so the inverse undoes each axis on its own
+    result.matrix[0][0] = T(2) / (right - left);
+    result.matrix[1][1] = T(2) / (top - bottom);
+    result.matrix[3][0] = -(right + left) / (right - left);
+    result.matrix[3][1] = -(top + bottom) / (top - bottom);
+
+    result.inverse[0][0] = (right - left) / T(2);
+    result.inverse[1][1] = (top - bottom) / T(2);
+    result.inverse[3][0] = (right + left) / T(2);
+    result.inverse[3][1] = (top + bottom) / T(2);
+
+    if (depth_range == DepthRange::NegativeOneToOne)
+    {
+        result.matrix[2][2]  = T(-2) / (zfar - znear);
+        result.matrix[3][2]  = -(zfar + znear) / (zfar - znear);
+        result.inverse[2][2] = -(zfar - znear) / T(2);
+        result.inverse[3][2] = -(zfar + znear) / T(2);
+    }
+    else
+    {
+        result.matrix[2][2]  = T(1) / (zfar - znear);
+        result.matrix[3][2]  = zfar / (zfar - znear);
+        result.inverse[2][2] = zfar - znear;
+        result.inverse[3][2] = -zfar;
+    }
+    return result;
+}
+
+namespace detail
+{
+
+/**
+ * The perspective projection mapping view space depth z to clip space (a z + b, -z), with the inverse
+ *
+ *     | 1/sx  0    0    0  |
+ *     |  0   1/sy  0    0  |
+ *     |  0    0    0   -1  |
+ *     |  0    0   1/b  a/b |
+ *
+ * where \c inverse_b and \c a_over_b are passed in closed form.
+ */
+template <typename T>
+Projection<T> perspective_from_depth_mapping(T fovy, T aspect, T a, T b, T inverse_b, T a_over_b)
+{
+    T tan_half_fovy = std::tan(fovy / T(2));
+    T sy            = T(1) / tan_half_fovy;
+
+    Projection<T> result;
+    result.perspective  = true;
+    result.matrix[0][0] = sy / aspect;
+    result.matrix[1][1] = sy;
+    result.matrix[2][2] = a;
+    result.matrix[2][3] = T(-1);
+    result.matrix[3][2] = b;
+    result.matrix[3][3] = T(0);
+
+    result.inverse[0][0] = aspect * tan_half_fovy;
+    result.inverse[1][1] = tan_half_fovy;
+    result.inverse[2][2] = T(0);
+    result.inverse[2][3] = inverse_b;
+    result.inverse[3][2] = T(-1);
+    result.inverse[3][3] = a_over_b;
+    return result;
+}
+
+} // namespace detail
+
+template <typename T>
+Projection<T> perspective(T fovy, T aspect, T znear, T zfar, DepthRange depth_range)
+{
+    T n = znear;
+    T f = zfar;
+
+    Projection<T> result;
+    if (depth_range == DepthRange::NegativeOneToOne)
+        result = detail::perspective_from_depth_mapping(fovy, aspect, -(f + n) / (f - n), -(T(2) * f * n) / (f - n), -(f - n) / (T(2) * f * n), (f + n) / (T(2) * f * n));
+    else
+        result = detail::perspective_from_depth_mapping(fovy, aspect, n / (f - n), f * n / (f - n), (f - n) / (f * n), T(1) / f);
+
+    result.depth_range = depth_range;
+    result.znear       = znear;
+    result.zfar        = zfar;
+    return result;
+}
+
+template <typename T>
+Projection<T> infinite_perspective(T fovy, T aspect, T znear, DepthRange depth_range)
+{
+    T n = znear;
+
+    Projection<T> result;
+    if (depth_range == DepthRange::NegativeOneToOne)
+        result = detail::perspective_from_depth_mapping(fovy, aspect, T(-1), T(-2) * n, T(-1) / (T(2) * n), T(1) / (T(2) * n));
+    else
+        result = detail::perspective_from_depth_mapping(fovy, aspect, T(0), n, T(1) / n, T(0));
+
+    result.depth_range  = depth_range;
+    result.infinite_far = true;
+    result.znear        = znear;
+    result.zfar         = std::numeric_limits<T>::infinity();
+    return result;
+}
+
+template <typename T>
+void Camera<T>::set_view(InvertibleMatrix<T> const& view)
+{
+    m_view = view;
+    update();
+}
+
+template <typename T>
+void Camera<T>::set_projection(Projection<T> const& projection)
+{
+    m_projection = projection;
+    update();
+}
+
+template <typename T>
+void Camera<T>::update()
+{
+    m_view_projection = m_projection.matrix * m_view.matrix;
+
+    // The corners in view space, from the inverse projection; the far corners of an infinite frustum at a finite depth
+    T near_depth = m_projection.near_depth();
+    T far_depth  = m_projection.far_depth();
+    if (m_projection.infinite_far)
+    {
+        T distance = infinite_far_scale * m_projection.znear;
+        far_depth  = (m_projection.matrix[3][2] - distance * m_projection.matrix[2][2]) / distance;
+    }
+
+    T const corner_x[4] = {T(-1), T(1), T(1), T(-1)};
+    T const corner_y[4] = {T(-1), T(-1), T(1), T(1)};
+    for (size_t i = 0; i < 8; i++)
+    {
+        Vec4 ndc   = Vec4(corner_x[i % 4], corner_y[i % 4], i < 4 ? near_depth : far_depth, T(1));
+        Vec4 view  = m_projection.inverse * ndc;
+        Vec4 world = m_view.inverse * Vec4(Vec3(view) / view.w, T(1));
+
+        m_frustum_corners[i] = Vec3(world);
+    }
+
+    // A point is inside if -w <= x, y <= w and between the near and far depth, which are planes in terms of the rows
+    // of the view projection matrix (Gribb/Hartmann), see frustum_from_matrix(...)
+    Vec4 rows[4];
+    for (int r = 0; r < 4; r++)
+        rows[r] = Vec4(m_view_projection[0][r], m_view_projection[1][r], m_view_projection[2][r], m_view_projection[3][r]);
+
+    for (int axis = 0; axis < 2; axis++)
+    {
+        m_frustum_planes[2 * axis]     = rows[3] + rows[axis];
+        m_frustum_planes[2 * axis + 1] = rows[3] - rows[axis];
+    }
+    if (m_projection.depth_range == DepthRange::NegativeOneToOne)
+    {
+        m_frustum_planes[4] = rows[3] + rows[2];
+        m_frustum_planes[5] = rows[3] - rows[2];
+    }
+    else
+    {
+        m_frustum_planes[4] = rows[3] - rows[2];
+        m_frustum_planes[5] = rows[2];
+    }
+
+    for (Vec4& plane : m_frustum_planes)
+        plane /= glm::length(Vec3(plane));
+
+    // Without a far plane, the normal of the far plane vanishes
+    if (m_projection.infinite_far)
+        m_frustum_planes[5] = Vec4(T(0), T(0), T(0), T(1));
+}
+
+template <typename T>
+Frustum Camera<T>::frustum() const
+{
+    Frustum frustum;
+    for (unsigned int p = 0; p < Frustum::plane_count; p++)
+        frustum.planes[p] = glm::vec4(m_frustum_planes[p]);
+    return frustum;
+}
+
+} // namespace ex2
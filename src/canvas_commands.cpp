@@ -0,0 +1,144 @@
+#include "canvas_commands.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "helper.hpp"
+#include "profiler.hpp"
+
+namespace ex2
+{
+
+void CommandBuffer::render_mesh(std::span<glm::vec3 const> positions, std::span<glm::u32vec3 const> faces, glm::vec3 const& color,
+                                uint64_t positions_version, uint64_t faces_version)
+{
+    render_mesh(positions, faces, color, glm::mat4(1.f), positions_version, faces_version);
+}
+
+void CommandBuffer::render_mesh(std::span<glm::vec3 const> positions, std::span<glm::u32vec3 const> faces, glm::vec3 const& color,
+                                glm::mat4 const& transform, uint64_t positions_version, uint64_t faces_version)
+{
+    m_commands.push_back({positions, {}, faces, {}, color, transform, positions_version, faces_version, false});
+}
+
+void CommandBuffer::render_mesh(std::span<glm::vec4 const> positions, std::span<glm::u32vec3 const> faces, glm::vec3 const& color,
+                                uint64_t positions_version, uint64_t faces_version)
+{
+    m_commands.push_back({{}, positions, faces, {}, color, glm::mat4(1.f), positions_version, faces_version, false});
+}
+
+void CommandBuffer::render_lines(std::span<glm::vec3 const> positions, std::span<glm::vec3 const> colors,
+                                 uint64_t positions_version, uint64_t colors_version)
+{
+    m_commands.push_back({positions, {}, {}, colors, glm::vec3(0.f), glm::mat4(1.f), positions_version, colors_version, true});
+}
+
+void CommandBuffer::render_lines(std::span<glm::vec4 const> positions, std::span<glm::vec3 const> colors,
+                                 uint64_t positions_version, uint64_t colors_version)
+{
+    m_commands.push_back({{}, positions, {}, colors, glm::vec3(0.f), glm::mat4(1.f), positions_version, colors_version, true});
+}
+
+void CommandBuffer::upload(GeometryCache* cache)
+{
+    for (size_t i = 0; i < m_commands.size(); i++)
+    {
+        Command const& command = m_commands[i];
+
+        // A different kind of command at the same position gets a new entry
+        if (i == m_handles.size())
+            m_handles.push_back(command.lines ? cache->add_lines() : cache->add_mesh(command.color));
+        else if (cache->is_lines(m_handles[i]) != command.lines)
+            m_handles[i] = command.lines ? cache->add_lines() : cache->add_mesh(command.color);
+
+        GeometryCache::Handle handle = m_handles[i];
+        if (command.homogeneous_positions.empty())
+            cache->set_positions(handle, command.positions, command.positions_version);
+        else
+            cache->set_positions(handle, command.homogeneous_positions, command.positions_version);
+        cache->set_transform(handle, command.transform);
+
+        if (command.lines)
+            cache->set_line_colors(handle, command.colors, command.elements_version);
+        else
+        {
+            cache->set_faces(handle, command.faces, command.elements_version);
+            cache->set_color(handle, command.color);
+        }
+    }
+}
+
+void record_canvas(CanvasView view, FrameCache const& frame, CanvasScene const& scene, CommandBuffer* commands)
+{
+    commands->clear();
+
+    // The versions tell a geometry cache which data is unchanged since the last frame
+    FrameCache::Versions const& versions = frame.versions();
+
+    switch (view)
+    {
+    case CanvasView::World:
+    {
+        EX2_PROFILE_ZONE("Record world canvas");
+        glm::mat4 marker_transform = glm::translate(glm::mat4(1.f), frame.camera_origin());
+
+        commands->render_lines(scene.world_axes, scene.axes_colors, static_version, static_version);
+        commands->render_mesh(frame.world_mesh().positions, frame.world_mesh().indices, scene.mesh_color, versions.world_mesh, versions.world_mesh);
+        commands->render_mesh(scene.marker_positions, scene.marker_faces, scene.marker_color, marker_transform, static_version, static_version);
+        render_camera(*commands, frame.world_camera(), versions.world_camera);
+        break;
+    }
+    case CanvasView::View:
+    {
+        EX2_PROFILE_ZONE("Record view canvas");
+        commands->render_mesh(frame.view_mesh().positions, frame.view_mesh().indices, scene.mesh_color, versions.view_positions, versions.view_faces);
+        commands->render_lines(frame.axes().view(), scene.axes_colors, versions.axes, static_version);
+        render_camera(*commands, frame.view_camera(), versions.view_camera);
+        break;
+    }
+    case CanvasView::Ndc:
+    {
+        EX2_PROFILE_ZONE("Record NDC canvas");
+        commands->render_mesh(frame.clipped_mesh().ndc(), frame.clipped_mesh().indices(), scene.mesh_color, versions.clipped_mesh, versions.clipped_mesh);
+        commands->render_lines(scene.box_lines, scene.box_colors, static_version, static_version);
+        commands->render_lines(frame.axes().ndc(), scene.axes_colors, versions.axes, static_version);
+        break;
+    }
+    case CanvasView::Clip:
+    {
+        EX2_PROFILE_ZONE("Record clip canvas");
+        commands->render_mesh(frame.clipped_mesh().clip(), frame.clipped_mesh().indices(), scene.mesh_color, versions.clipped_mesh, versions.clipped_mesh);
+        commands->render_lines(frame.axes().clip(), scene.axes_colors, versions.axes, static_version);
+        break;
+    }
+    }
+}
+
+TaskGraph::TaskId schedule_canvas(CanvasView view, FrameCache const& frame, FrameCache::StageTasks const& stages,
+                                  CanvasScene const& scene, TaskGraph* graph, CommandBuffer* commands,
+                                  GeometryCache* geometry)
+{
+    auto record = [view, &frame, &scene, commands, geometry] {
+        record_canvas(view, frame, scene, commands);
+        if (geometry)
+        {
+            EX2_PROFILE_ZONE("Upload canvas geometry");
+            geometry->begin_frame();
+            commands->upload(geometry);
+        }
+    };
+
+    // The view space mesh feeds both the view canvas and, through the clipping stage, the NDC and clip canvases
+    switch (view)
+    {
+    case CanvasView::World:
+        return graph->add(record, {stages.world_camera, stages.mesh});
+    case CanvasView::View:
+        return graph->add(record, {stages.view_camera, stages.axes, stages.mesh});
+    case CanvasView::Ndc:
+    case CanvasView::Clip:
+        return graph->add(record, {stages.axes, stages.clipping});
+    }
+    return TaskGraph::none;
+}
+
+} // namespace ex2
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <cassert>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "frame_cache.hpp"
+#include "geometry_cache.hpp"
+#include "profiler.hpp"
+#include "task_graph.hpp"
+
+namespace ex2
+{
+
+/**
+ * \brief The draw calls of one canvas, recorded on any thread and replayed on the thread that owns the renderer.
+ *
+ * The commands reference the drawn positions, faces and colors instead of copying them, so the data must stay valid
+ * and unchanged until the commands are replayed.
+ *
+ * The commands can be replayed directly, or passed to a \c GeometryCache first and drawn from it, which tracks the data
+ * that changed since the previous frame and keeps transformed positions between frames. Every command gets its own mesh
+ * or line set in the cache, registered when a command is first recorded at its position in the buffer, and the versions
+ * passed with the data tell the cache which data is unchanged, see \c GeometryCache.
+ */
+class CommandBuffer
+{
+public:
+    void render_mesh(std::span<glm::vec3 const> positions, std::span<glm::u32vec3 const> faces, glm::vec3 const& color,
+                     uint64_t positions_version = unknown_version, uint64_t faces_version = unknown_version);
+    void render_mesh(std::span<glm::vec4 const> positions, std::span<glm::u32vec3 const> faces, glm::vec3 const& color,
+                     uint64_t positions_version = unknown_version, uint64_t faces_version = unknown_version);
+    void render_lines(std::span<glm::vec3 const> positions, std::span<glm::vec3 const> colors,
+                      uint64_t positions_version = unknown_version, uint64_t colors_version = unknown_version);
+    void render_lines(std::span<glm::vec4 const> positions, std::span<glm::vec3 const> colors,
+                      uint64_t positions_version = unknown_version, uint64_t colors_version = unknown_version);
+
+    /**
+     * \brief Draw a mesh whose positions are transformed by \c transform, so a moving mesh can keep static positions.
+     */
+    void render_mesh(std::span<glm::vec3 const> positions, std::span<glm::u32vec3 const> faces, glm::vec3 const& color,
+                     glm::mat4 const& transform, uint64_t positions_version, uint64_t faces_version);
+
+    /**
+     * \brief Remove all commands, but keep the meshes and line sets registered in the cache for the next frame.
+     */
+    void clear() { m_commands.clear(); }
+
+    size_t size() const { return m_commands.size(); }
+
+    /**
+     * \brief Issue the recorded calls to \c renderer in the order they were recorded.
+     *
+     * Renderers that only accept 3D or only homogeneous positions (\c cgtub::SimpleRenderer, \c cgtub::NDCRenderer)
+     * must only be used with commands recorded with that kind of positions.
+     */
+    template <typename Renderer>
+    void replay(Renderer& renderer) const;
+
+    /**
+     * \brief Bring the meshes and line sets of the commands in \c cache up to date, registering them on first use.
+     *
+     * A command buffer must always be uploaded to the same cache.
+     */
+    void upload(GeometryCache* cache);
+
+    /**
+     * \brief Draw the commands from the cache they were last uploaded to, in the order they were recorded.
+     */
+    template <typename Renderer>
+    void replay(GeometryCache const& cache, Renderer& renderer) const;
+
+private:
+    struct Command
+    {
+        std::span<glm::vec3 const>    positions;
+        std::span<glm::vec4 const>    homogeneous_positions;
+        std::span<glm::u32vec3 const> faces;
+        std::span<glm::vec3 const>    colors; // Per line, for lines
+        glm::vec3                     color             = glm::vec3(0.f);
+        glm::mat4                     transform         = glm::mat4(1.f);
+        uint64_t                      positions_version = unknown_version;
+        uint64_t                      elements_version  = unknown_version; // Of the faces or line colors
+        bool                          lines             = false;
+    };
+
+    std::vector<Command>               m_commands;
+    std::vector<GeometryCache::Handle> m_handles; // The cache entry of the command at each position
+};
+
+/**
+ * \brief The canvases of the window, each showing the scene in another space.
+ */
+enum class CanvasView
+{
+    World = 0, //!< The mesh, the world axes and the camera in world space
+    View,      //!< The mesh, the world axes and the camera in view space
+    Ndc,       //!< The clipped mesh and the world axes in NDC, inside the canonical view volume
+    Clip       //!< The clipped mesh and the world axes in clip space
+};
+
+/**
+ * \brief The data drawn in the canvases besides the data of the \c FrameCache, which has to outlive the recorded commands.
+ *
+ * The data is recorded as static, so it must not change while commands recorded from it are uploaded to a cache.
+ */
+struct CanvasScene
+{
+    std::span<glm::vec3 const>    world_axes;       //!< The line end points of the world axes in world space
+    std::span<glm::vec3 const>    axes_colors;      //!< One color per world axis
+    std::span<glm::vec3 const>    box_lines;        //!< The line end points of the canonical view volume
+    std::span<glm::vec3 const>    box_colors;       //!< One color per line of the canonical view volume
+    std::span<glm::vec3 const>    marker_positions; //!< The positions of the marker drawn at the camera location, around the origin
+    std::span<glm::u32vec3 const> marker_faces;     //!< The faces of the marker drawn at the camera location
+    glm::vec3                     mesh_color   = glm::vec3(0.75f);
+    glm::vec3                     marker_color = glm::vec3(1.f, 0.f, 1.f);
+};
+
+/**
+ * \brief Record the draw calls of a canvas, replacing the previous commands of \c commands.
+ *
+ * \param[in]  view     The canvas to record
+ * \param[in]  frame    The cache with the data of the current frame, which has to be up to date
+ * \param[in]  scene    The remaining data drawn in the canvases
+ * \param[out] commands The recorded draw calls
+ */
+void record_canvas(CanvasView view, FrameCache const& frame, CanvasScene const& scene, CommandBuffer* commands);
+
+/**
+ * \brief Add a task recording the draw calls of a canvas to \c graph, see \c record_canvas(...).
+ *
+ * The task depends only on the stages of the cache the canvas reads, e.g. the world canvas does not wait for the
+ * clipping stage, so the canvases are recorded concurrently with the stages they do not need. With a geometry cache,
+ * the task also starts a new frame of the cache and passes the recorded commands to it.
+ *
+ * \param[in]  view     The canvas to record
+ * \param[in]  frame    The cache with the data of the current frame
+ * \param[in]  stages   The tasks updating \c frame in the same graph, as returned by \c FrameCache::schedule_update(...)
+ * \param[in]  scene    The remaining data drawn in the canvases, which has to stay valid until the graph has run
+ * \param[out] graph    The graph the task is added to
+ * \param[out] commands The recorded draw calls, written when the graph runs
+ * \param[out] geometry The geometry cache of the canvas, or \c nullptr to replay the commands directly
+ *
+ * \return The id of the task
+ */
+TaskGraph::TaskId schedule_canvas(CanvasView view, FrameCache const& frame, FrameCache::StageTasks const& stages,
+                                  CanvasScene const& scene, TaskGraph* graph, CommandBuffer* commands,
+                                  GeometryCache* geometry = nullptr);
+
+template <typename Renderer>
+void CommandBuffer::replay(Renderer& renderer) const
+{
+    for (Command const& command : m_commands)
+    {
+        if (command.homogeneous_positions.empty())
+        {
+            if constexpr (requires { renderer.render_lines(command.positions, command.colors); })
+            {
+                std::vector<glm::vec3>     transformed;
+                std::span<glm::vec3 const> positions = command.positions;
+                if (command.transform != glm::mat4(1.f))
+                {
+                    transformed.reserve(positions.size());
+                    for (glm::vec3 const& position : positions)
+                        transformed.push_back(glm::vec3(command.transform * glm::vec4(position, 1.f)));
+                    positions = transformed;
+                }
+
+                if (command.lines)
+                {
+                    EX2_PROFILE_ZONE("Render lines");
+                    renderer.render_lines(positions, command.colors);
+                }
+                else
+                {
+                    EX2_PROFILE_ZONE("Render mesh");
+                    renderer.render_mesh(positions, command.faces, command.color);
+                }
+            }
+            else
+                assert(command.positions.empty() && "Renderer does not support 3D positions");
+        }
+        else
+        {
+            if constexpr (requires { renderer.render_lines(command.homogeneous_positions, command.colors); })
+            {
+                if (command.lines)
+                {
+                    EX2_PROFILE_ZONE("Render lines");
+                    renderer.render_lines(command.homogeneous_positions, command.colors);
+                }
+                else
+                {
+                    EX2_PROFILE_ZONE("Render mesh");
+                    renderer.render_mesh(command.homogeneous_positions, command.faces, command.color);
+                }
+            }
+            else
+                assert(false && "Renderer does not support homogeneous positions");
+        }
+    }
+}
+
+template <typename Renderer>
+void CommandBuffer::replay(GeometryCache const& cache, Renderer& renderer) const
+{
+    assert(m_handles.size() >= m_commands.size() && "Commands have not been uploaded");
+
+    for (size_t i = 0; i < m_commands.size(); i++)
+        cache.draw(m_handles[i], renderer);
+}
+
+} // namespace ex2
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <charconv>
+#include <iostream>
+#include <string_view>
+#include <system_error>
+
+namespace ex2
+{
+
+/**
+ * \brief Parse \c text, the value of the command line option \c name, as an integer in [min, max].
+ *
+ * The whole value has to be a number, so trailing characters, signs of unsigned types and out-of-range values are
+ * rejected instead of being truncated or wrapped around like by \c std::atoi or \c std::strtoul.
+ *
+ * \param[in]  name  The option, for the error message
+ * \param[in]  text  The value given on the command line
+ * \param[in]  min   The smallest accepted value
+ * \param[in]  max   The largest accepted value
+ * \param[out] value The parsed value
+ *
+ * \return false, after printing the accepted range, if \c text is not an integer in the range
+ */
+template <typename T>
+bool parse_option_value(char const* name, char const* text, T min, T max, T* value)
+{
+    std::string_view token  = text;
+    T                parsed = T(0);
+    auto             result = std::from_chars(token.data(), token.data() + token.size(), parsed);
+    if (result.ec == std::errc() && result.ptr == token.data() + token.size() && parsed >= min && parsed <= max)
+    {
+        *value = parsed;
+        return true;
+    }
+
+    std::cerr << "Invalid value '" << text << "' for " << name << ", expected an integer from " << min << " to " << max << std::endl;
+    return false;
+}
+
+} // namespace ex2
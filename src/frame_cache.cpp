@@ -0,0 +1,410 @@
+#include "frame_cache.hpp"
+
+#include <atomic>
+
+#include <imgui.h>
+
+#include "profiler.hpp"
+
+namespace ex2
+{
+
+namespace
+{
+
+// Shared by all caches, so data of different caches never has the same version
+std::atomic<uint64_t> last_version{static_version};
+
+uint64_t next_version()
+{
+    return last_version.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+template <typename T>
+bool same_data(std::span<T const> a, std::span<T const> b)
+{
+    return a.data() == b.data() && a.size() == b.size();
+}
+
+} // namespace
+
+FrameCache::FrameCache(MeshView mesh, std::span<glm::vec3 const> axes_positions)
+    : m_mesh_view(mesh),
+      m_axes_positions(axes_positions)
+{
+}
+
+void FrameCache::set_mesh(MeshView mesh)
+{
+    bool positions_changed = !same_data(mesh.positions, m_mesh_view.positions);
+    bool indices_changed   = !same_data(mesh.indices, m_mesh_view.indices);
+
+    m_mesh_view = mesh;
+    if (positions_changed)
+        m_dirty |= StageAll;
+    else if (indices_changed)
+        m_dirty |= StageClipping | StageInstances;
+}
+
+void FrameCache::set_clip_options(ClipOptions const& options)
+{
+    if (options == m_clip_options)
+        return;
+
+    if (options.cull_back_faces != m_clip_options.cull_back_faces)
+        m_dirty |= StageCulling;
+
+    m_clip_options = options;
+    m_dirty |= StageClipping;
+}
+
+void FrameCache::set_meshlets(MeshletMesh const* meshlets)
+{
+    m_meshlets = meshlets;
+    m_dirty |= StageCulling;
+}
+
+void FrameCache::set_cluster_culling(bool enabled)
+{
+    if (enabled == m_cluster_culling)
+        return;
+
+    m_cluster_culling = enabled;
+    m_dirty |= StageCulling;
+}
+
+void FrameCache::set_instances(std::span<glm::mat4 const> models)
+{
+    m_instance_models = models;
+    m_dirty |= StageAll;
+}
+
+void FrameCache::set_instance_culling(bool enabled)
+{
+    if (enabled == m_instance_culling)
+        return;
+
+    m_instance_culling = enabled;
+    m_dirty |= StageCulling;
+}
+
+void FrameCache::set_lod_chain(LodChain const* chain)
+{
+    m_lod_chain = chain;
+    m_dirty |= StageCulling;
+}
+
+void FrameCache::set_lod_settings(LodSelector::Settings const& settings)
+{
+    if (settings == m_lod.settings())
+        return;
+
+    m_lod.set_settings(settings);
+    m_dirty |= StageCulling;
+}
+
+void FrameCache::set_viewport(glm::vec2 const& size)
+{
+    if (size == m_viewport)
+        return;
+
+    m_viewport = size;
+    m_dirty |= StageCulling;
+}
+
+void FrameCache::set_options(FrameCacheOptions const& options)
+{
+    set_clip_options(options.clip);
+    set_cluster_culling(options.cluster_culling);
+    set_lod_settings(options.lod);
+}
+
+size_t FrameCache::lod_level() const
+{
+    return m_lod_chain ? m_lod.level() : 0;
+}
+
+bool FrameCache::is_culling_clusters() const
+{
+    return m_cluster_culling && m_meshlets != nullptr && !m_meshlets->meshlets.empty() && lod_level() == 0;
+}
+
+MeshView FrameCache::submitted_mesh() const
+{
+    if (is_culling_clusters())
+        return m_culler.mesh();
+    return m_lod_chain ? m_lod_chain->level(m_lod.level()) : m_mesh_view;
+}
+
+MeshView FrameCache::world_mesh() const
+{
+    return instanced() ? m_instances.world() : m_mesh_view;
+}
+
+MeshView FrameCache::view_mesh() const
+{
+    if (instanced())
+        return {m_instances.view(), m_instances.indices()};
+    return {m_mesh.view(), submitted_mesh().indices};
+}
+
+void FrameCache::invalidate()
+{
+    m_dirty = StageAll;
+}
+
+void FrameCache::update(CameraParameters const& parameters, GuiChanges changes)
+{
+    EX2_PROFILE_ZONE("Frame cache update");
+
+    TaskGraph graph;
+    schedule_update(parameters, changes, &graph);
+    graph.run();
+}
+
+FrameCache::StageTasks FrameCache::schedule_update(CameraParameters const& parameters, GuiChanges changes, TaskGraph* graph)
+{
+    m_counters.frames++;
+
+    if (has_gui_changed_parameter(changes, GuiParameter::Azimuth))
+        m_dirty |= StageCamera;
+
+    if (has_gui_changed_parameter(changes, GuiParameter::TransformationType) ||
+        has_gui_changed_parameter(changes, GuiParameter::Size) ||
+        has_gui_changed_parameter(changes, GuiParameter::Fov) ||
+        has_gui_changed_parameter(changes, GuiParameter::Near) ||
+        has_gui_changed_parameter(changes, GuiParameter::Far))
+        m_dirty |= StageProjection | StageCulling | StageClipping;
+
+    StageTasks tasks;
+    if (m_dirty == 0)
+    {
+        m_counters.idle_frames++;
+        return tasks;
+    }
+
+    unsigned int dirty            = m_dirty;
+    bool         view_dirty       = dirty & StageView;
+    bool         projection_dirty = dirty & StageProjection;
+
+    // The matrices are cheap and read by all other stages, so they are computed right away
+    if (view_dirty)
+    {
+        EX2_PROFILE_ZONE("View matrix");
+        m_camera_origin = camera_position(parameters.azimuth);
+        m_camera.set_view(camera_view(m_camera_origin));
+        m_counters.view_updates++;
+    }
+
+    if (projection_dirty)
+    {
+        EX2_PROFILE_ZONE("Projection matrix");
+        Projection<float> projection = camera_projection(parameters);
+        m_camera.set_projection(projection);
+        m_view_space_camera.set_projection(projection);
+        m_counters.projection_updates++;
+    }
+
+    // The counters of the small stages are updated here, so concurrent tasks never write the same counter
+
+    // The world space camera depends on both matrices, the view space camera only on the projection
+    if (view_dirty || projection_dirty)
+    {
+        m_counters.camera_geometry_updates++;
+        tasks.world_camera = graph->add([this] {
+            EX2_PROFILE_ZONE("World camera geometry");
+            compute_camera_geometry(m_camera, &m_world_camera);
+            m_versions.world_camera = next_version();
+        });
+    }
+    if (projection_dirty)
+    {
+        m_counters.camera_geometry_updates++;
+        tasks.view_camera = graph->add([this] {
+            EX2_PROFILE_ZONE("View camera geometry");
+            compute_camera_geometry(m_view_space_camera, &m_view_camera);
+            m_versions.view_camera = next_version();
+        });
+    }
+
+    if (view_dirty)
+    {
+        m_counters.transformed_vertices += m_axes_positions.size();
+        m_counters.projected_vertices += m_axes_positions.size();
+        tasks.axes = graph->add([this] {
+            EX2_PROFILE_ZONE("Axes transform");
+            m_axes.run(m_axes_positions, m_camera.view_matrix(), m_camera.projection_matrix());
+            m_versions.axes = next_version();
+        });
+    }
+    else if (projection_dirty)
+    {
+        m_counters.projected_vertices += m_axes_positions.size();
+        tasks.axes = graph->add([this] {
+            EX2_PROFILE_ZONE("Axes reprojection");
+            m_axes.reproject(m_camera.projection_matrix());
+            m_versions.axes = next_version();
+        });
+    }
+
+    tasks.mesh     = graph->add([this, dirty] { update_mesh(dirty); }, {}, true);
+    tasks.clipping = graph->add([this, dirty] {
+        if (!m_submission_changed && !(dirty & (StageClipping | StageInstances)))
+            return;
+
+        EX2_PROFILE_ZONE("Triangle clipping");
+        if (instanced())
+            m_clipper.run(m_instances.clip(), m_instances.ndc(), m_instances.indices(), m_clip_options);
+        else
+            m_clipper.run(m_mesh.clip(), m_mesh.ndc(), submitted_mesh().indices, m_clip_options);
+        m_counters.clipping_updates++;
+        m_versions.clipped_mesh = next_version();
+    }, {tasks.mesh});
+
+    m_dirty = 0;
+    return tasks;
+}
+
+void FrameCache::update_mesh(unsigned int dirty)
+{
+    bool view_dirty       = dirty & StageView;
+    bool projection_dirty = dirty & StageProjection;
+
+    // A new submission has to be transformed completely, otherwise a projection change only reprojects the view space
+    // positions. Instanced meshes are culled per instance, so their submission changes with every culling update.
+    bool culling_dirty      = dirty & StageCulling;
+    bool submission_changed = false;
+    if (instanced())
+    {
+        if (dirty & StageInstances)
+        {
+            EX2_PROFILE_ZONE("Instance world transform");
+            m_instances.set_mesh(m_mesh_view);
+            m_instances.set_instances(m_instance_models);
+            m_counters.transformed_vertices += m_instances.world().positions.size();
+            m_versions.world_mesh = next_version();
+        }
+        if (view_dirty || projection_dirty || culling_dirty)
+        {
+            EX2_PROFILE_ZONE("Instance transform");
+            m_instances.run(m_camera, m_instance_culling);
+            m_counters.culling_updates++;
+            m_counters.transformed_vertices += m_instances.view().size();
+            m_counters.projected_vertices += m_instances.view().size();
+            m_versions.view_positions = m_versions.view_faces = next_version();
+        }
+        submission_changed = culling_dirty;
+    }
+    else
+    {
+        if (m_lod_chain && (view_dirty || projection_dirty || culling_dirty))
+        {
+            EX2_PROFILE_ZONE("LOD selection");
+            size_t previous = m_lod.level();
+            float  radius   = projected_sphere_radius(m_lod_chain->center(), m_lod_chain->radius(), m_camera.view_matrix(), m_camera.projection_matrix(), m_viewport);
+            if (m_lod.select(*m_lod_chain, radius) != previous)
+            {
+                submission_changed = true;
+                m_counters.lod_changes++;
+            }
+        }
+
+        if (culling_dirty && is_culling_clusters())
+        {
+            EX2_PROFILE_ZONE("Meshlet culling");
+            m_culler.run(*m_meshlets, m_mesh_view.positions, m_camera, m_clip_options.cull_back_faces);
+            m_counters.culling_updates++;
+            submission_changed = true;
+        }
+
+        // Switching between the culled mesh, a level of detail and the full mesh changes the submission as well
+        MeshView submitted = submitted_mesh();
+        if (!same_data(submitted.positions, m_submitted.positions) || !same_data(submitted.indices, m_submitted.indices))
+            submission_changed = true;
+        m_submitted = submitted;
+
+        if (view_dirty || submission_changed)
+        {
+            EX2_PROFILE_ZONE("Mesh transform");
+            m_mesh.run(submitted.positions, m_camera.view_matrix(), m_camera.projection_matrix());
+            m_counters.transformed_vertices += submitted.positions.size();
+            m_counters.projected_vertices += submitted.positions.size();
+            m_versions.view_positions = next_version();
+        }
+        else if (projection_dirty)
+        {
+            EX2_PROFILE_ZONE("Mesh reprojection");
+            m_mesh.reproject(m_camera.projection_matrix());
+            m_counters.projected_vertices += submitted.positions.size();
+        }
+    }
+
+    // The mesh itself only changes with the instances stage
+    if (!instanced() && (dirty & StageInstances))
+        m_versions.world_mesh = next_version();
+    if (!instanced() && (submission_changed || (dirty & StageInstances)))
+        m_versions.view_faces = next_version();
+
+    m_submission_changed = submission_changed;
+}
+
+void gui_frame_cache(FrameCache* cache)
+{
+    FrameCacheOptions options = cache->options();
+    gui_frame_cache(*cache, &options);
+    cache->set_options(options);
+}
+
+void gui_frame_cache(FrameCache const& cache, FrameCacheOptions* options)
+{
+    FrameCache::Counters const&   counters = cache.counters();
+    MeshletCuller::Stats const&   culling  = cache.culled_mesh().stats();
+    TriangleClipper::Stats const& stats    = cache.clipped_mesh().stats();
+
+    ImGui::Begin("Frame cache");
+
+    ImGui::Checkbox("Cull clusters", &options->cluster_culling);
+    ImGui::Checkbox("Clip triangles", &options->clip.enabled);
+    ImGui::Checkbox("Cull back faces", &options->clip.cull_back_faces);
+
+    if (cache.instanced())
+    {
+        InstanceBatch::Stats const& instances = cache.instances().stats();
+        ImGui::Text("Instances: %zu visible, %zu outside the frustum", instances.visible, instances.culled);
+        if (instances.dropped > 0)
+            ImGui::Text("%zu instances dropped, over the budget of %zu vertices", instances.dropped, InstanceBatch::max_instanced_vertices);
+    }
+    else if (options->cluster_culling)
+    {
+        ImGui::Text("Meshlets: %zu visible, %zu outside the frustum, %zu back-facing (%zu BVH nodes visited)",
+                    culling.visible_meshlets, culling.frustum_culled, culling.cone_culled, culling.visited_nodes);
+    }
+    if (LodChain const* chain = cache.lod_chain())
+    {
+        LodSelector const& lod = cache.lod();
+
+        ImGui::Checkbox("Automatic LOD", &options->lod.enabled);
+        ImGui::SliderFloat("Pixels per triangle", &options->lod.pixels_per_triangle, 1.f, 64.f);
+        ImGui::SliderFloat("LOD hysteresis", &options->lod.hysteresis, 0.f, 1.f);
+
+        ImGui::Text("LOD: level %zu of %zu (%zu triangles), projected radius %.0f px",
+                    lod.level(), chain->level_count() - 1, chain->level(lod.level()).indices.size(), lod.projected_radius());
+    }
+    ImGui::Text("Submitted: %zu vertices, %zu triangles", cache.view_mesh().positions.size(), cache.view_mesh().indices.size());
+    ImGui::Text("Triangles: %zu accepted, %zu rejected, %zu clipped, %zu culled -> %zu submitted",
+                stats.accepted, stats.rejected, stats.clipped, stats.culled, stats.emitted);
+    ImGui::Separator();
+
+    ImGui::Text("Frames: %llu (idle: %llu)", static_cast<unsigned long long>(counters.frames), static_cast<unsigned long long>(counters.idle_frames));
+    ImGui::Text("View updates: %llu", static_cast<unsigned long long>(counters.view_updates));
+    ImGui::Text("Projection updates: %llu", static_cast<unsigned long long>(counters.projection_updates));
+    ImGui::Text("Culling updates: %llu", static_cast<unsigned long long>(counters.culling_updates));
+    ImGui::Text("Clipping updates: %llu", static_cast<unsigned long long>(counters.clipping_updates));
+    ImGui::Text("Camera geometry updates: %llu", static_cast<unsigned long long>(counters.camera_geometry_updates));
+    ImGui::Text("LOD changes: %llu", static_cast<unsigned long long>(counters.lod_changes));
+    ImGui::Text("Transformed vertices: %llu", static_cast<unsigned long long>(counters.transformed_vertices));
+    ImGui::Text("Projected vertices: %llu", static_cast<unsigned long long>(counters.projected_vertices));
+    ImGui::End();
+}
+
+} // namespace ex2
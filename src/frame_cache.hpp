@@ -0,0 +1,302 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "geometry_cache.hpp"
+#include "helper.hpp"
+#include "instancing.hpp"
+#include "lod.hpp"
+#include "mesh_loader.hpp"
+#include "meshlet.hpp"
+#include "task_graph.hpp"
+#include "transform_pipeline.hpp"
+#include "triangle_clipper.hpp"
+
+namespace ex2
+{
+
+/**
+ * \brief The options of a \c FrameCache that the user can change in the GUI.
+ */
+struct FrameCacheOptions
+{
+    ClipOptions           clip;
+    bool                  cluster_culling = false; //!< Off by default, see \c FrameCache::set_cluster_culling(...)
+    LodSelector::Settings lod;
+
+    bool operator==(FrameCacheOptions const&) const = default;
+};
+
+/**
+ * \brief Caches everything derived from the camera parameters and recomputes only what a GUI change invalidates.
+ *
+ * The derived data is organized in four stages:
+ *  - view: the camera position, the view matrix and the view space vertices
+ *  - projection: the projection matrix and the clip space/NDC vertices
+ *  - culling: the meshlets of the mesh inside the view frustum, if cluster culling is enabled
+ *  - clipping: the mesh triangles clipped to the view volume
+ *
+ * An azimuth change invalidates all stages, all other parameters invalidate the projection, culling and clipping stages.
+ * Changing only the mesh triangles or the clip options invalidates only the clipping stage (and the culling stage if
+ * back-face culling is toggled).
+ *
+ * With cluster culling, only the geometry of the visible meshlets is transformed, so every culling update transforms
+ * the submitted mesh from scratch.
+ *
+ * With a level of detail chain, the level is selected by the projected size of the mesh in the viewport of the
+ * projected canvases with every view or projection update, and a new level is submitted like a culling update.
+ * Cluster culling only applies to the full mesh at level 0.
+ *
+ * If instances are set, the mesh is drawn once per instance instead. The instances in world space are only recomputed
+ * when the mesh or the instances change, the camera outputs of the visible instances are recomputed with every view,
+ * projection or culling update.
+ * The camera visualizations used by \c render_camera(...) are recomputed whenever one of the matrices they depend on changes.
+ *
+ * The stages run as tasks of a \c TaskGraph: the camera visualizations and the axes are computed concurrently, while the
+ * mesh stages run after each other with the whole thread pool. Callers can add their own tasks that read the results
+ * to the same graph with \c schedule_update(...).
+ *
+ * The cache does not own the input positions; the spans passed to it must stay valid while it is in use.
+ */
+class FrameCache
+{
+public:
+    /**
+     * \brief Counters of the work done by \c update(...), accumulated since construction.
+     */
+    struct Counters
+    {
+        uint64_t frames                  = 0; //!< Calls to update(...)
+        uint64_t idle_frames             = 0; //!< Calls to update(...) that found nothing to recompute
+        uint64_t view_updates            = 0; //!< Times the view stage was recomputed
+        uint64_t projection_updates      = 0; //!< Times the projection stage was recomputed
+        uint64_t culling_updates         = 0; //!< Times the culling stage was recomputed
+        uint64_t clipping_updates        = 0; //!< Times the clipping stage was recomputed
+        uint64_t camera_geometry_updates = 0; //!< Times a camera visualization was recomputed
+        uint64_t lod_changes             = 0; //!< Times a different level of detail was selected
+        uint64_t transformed_vertices    = 0; //!< Vertices transformed to view space
+        uint64_t projected_vertices      = 0; //!< Vertices transformed to clip space and NDC
+    };
+
+    /**
+     * \brief Versions of the cached data for \c GeometryCache: a new number, unique across all caches, whenever the
+     * data changes, or \c unknown_version before the first update.
+     */
+    struct Versions
+    {
+        uint64_t world_mesh     = unknown_version; //!< world_mesh()
+        uint64_t view_positions = unknown_version; //!< The positions of view_mesh()
+        uint64_t view_faces     = unknown_version; //!< The faces of view_mesh()
+        uint64_t clipped_mesh   = unknown_version; //!< All data of clipped_mesh()
+        uint64_t axes           = unknown_version; //!< All data of axes()
+        uint64_t world_camera   = unknown_version; //!< world_camera()
+        uint64_t view_camera    = unknown_version; //!< view_camera()
+    };
+
+    /**
+     * \brief The tasks added by \c schedule_update(...) that compute the data of each stage, or \c TaskGraph::none if
+     * the data is still up to date.
+     */
+    struct StageTasks
+    {
+        TaskGraph::TaskId world_camera = TaskGraph::none; //!< world_camera()
+        TaskGraph::TaskId view_camera  = TaskGraph::none; //!< view_camera()
+        TaskGraph::TaskId axes         = TaskGraph::none; //!< axes()
+        TaskGraph::TaskId mesh         = TaskGraph::none; //!< world_mesh(), view_mesh(), culled_mesh() and instances()
+        TaskGraph::TaskId clipping     = TaskGraph::none; //!< clipped_mesh()
+    };
+
+    /**
+     * \param[in] mesh           The mesh shown in all canvases
+     * \param[in] axes_positions The line end points of the world coordinate axes
+     */
+    FrameCache(MeshView mesh, std::span<glm::vec3 const> axes_positions);
+
+    /**
+     * \brief Bring all cached data up to date with the given parameters.
+     *
+     * \param[in] parameters The current camera parameters
+     * \param[in] changes    The parameters changed since the last call, as returned by \c gui(...)
+     */
+    void update(CameraParameters const& parameters, GuiChanges changes);
+
+    /**
+     * \brief Add the tasks bringing the cached data up to date to \c graph instead of running them.
+     *
+     * The matrices are updated right away. The tasks reference the cache, which must not be changed or updated again
+     * until the graph has run.
+     *
+     * \param[in]  parameters The current camera parameters
+     * \param[in]  changes    The parameters changed since the last call, as returned by \c gui(...)
+     * \param[out] graph      The graph the tasks are added to
+     *
+     * \return The tasks computing the data of each stage, for tasks reading it to depend on
+     */
+    StageTasks schedule_update(CameraParameters const& parameters, GuiChanges changes, TaskGraph* graph);
+
+    /**
+     * \brief Replace the mesh, invalidating the stages that depend on the parts that changed.
+     */
+    void set_mesh(MeshView mesh);
+
+    /**
+     * \brief Change the options of the clipping stage, invalidating it if they differ from the current ones.
+     */
+    void set_clip_options(ClipOptions const& options);
+
+    ClipOptions const& clip_options() const { return m_clip_options; }
+
+    /**
+     * \brief Set the meshlets used for cluster culling, or \c nullptr to transform the whole mesh.
+     *
+     * The meshlets must have been built from the current mesh and stay valid while they are set.
+     */
+    void set_meshlets(MeshletMesh const* meshlets);
+
+    /**
+     * \brief Enable or disable culling the meshlets against the view frustum. Disabled by default.
+     *
+     * The visible meshlets change with every camera change, so the mesh is then transformed completely even when only
+     * the projection changed, instead of reprojecting the view space positions. That only pays off for large meshes
+     * of which most meshlets are outside the frustum.
+     */
+    void set_cluster_culling(bool enabled);
+
+    bool cluster_culling() const { return m_cluster_culling; }
+
+    /**
+     * \brief Draw the mesh once per model matrix instead of once, or once again if \c models is empty.
+     *
+     * The model matrices must stay valid while they are set.
+     */
+    void set_instances(std::span<glm::mat4 const> models);
+
+    /**
+     * \brief Enable or disable culling the instances against the view frustum.
+     */
+    void set_instance_culling(bool enabled);
+
+    bool instanced() const { return !m_instance_models.empty(); }
+
+    /**
+     * \brief Set the levels of detail of the mesh, or \c nullptr to always submit the full mesh.
+     *
+     * The chain must have been built from the current mesh and stay valid while it is set.
+     */
+    void set_lod_chain(LodChain const* chain);
+
+    /**
+     * \brief Change how the level of detail is selected.
+     */
+    void set_lod_settings(LodSelector::Settings const& settings);
+
+    /**
+     * \brief Set the size in pixels of the viewport the projected mesh is shown in, used to select the level of detail.
+     */
+    void set_viewport(glm::vec2 const& size);
+
+    LodChain const*    lod_chain() const { return m_lod_chain; }
+    LodSelector const& lod() const { return m_lod; }
+
+    /**
+     * \brief Change the clip options, cluster culling and level of detail settings at once, see the individual setters.
+     */
+    void              set_options(FrameCacheOptions const& options);
+    FrameCacheOptions options() const { return {m_clip_options, m_cluster_culling, m_lod.settings()}; }
+
+    /**
+     * \brief Force a full recomputation in the next call to \c update(...).
+     */
+    void invalidate();
+
+    glm::vec3 const& camera_origin() const { return m_camera_origin; }
+    glm::mat4 const& view_matrix() const { return m_camera.view_matrix(); }
+    glm::mat4 const& projection_matrix() const { return m_camera.projection_matrix(); }
+
+    //! The camera with its inverse matrices and view volume
+    Camera<float> const& camera() const { return m_camera; }
+
+    //! The camera visualized in world space
+    CameraGeometry const& world_camera() const { return m_world_camera; }
+    //! The camera visualized in view space (with identity view matrix)
+    CameraGeometry const& view_camera() const { return m_view_camera; }
+
+    //! The mesh, or all instances of it, in world space
+    MeshView                   world_mesh() const;
+    //! The mesh in view space: the visible meshlets with cluster culling, the visible instances with instancing
+    MeshView                   view_mesh() const;
+    MeshletCuller const&       culled_mesh() const { return m_culler; }
+    InstanceBatch const&       instances() const { return m_instances; }
+    //! The mesh triangles clipped to the view volume, with their clip space and NDC vertices
+    TriangleClipper const&     clipped_mesh() const { return m_clipper; }
+    TransformPipeline const&   axes() const { return m_axes; }
+
+    Counters const& counters() const { return m_counters; }
+    Versions const& versions() const { return m_versions; }
+
+private:
+    enum Stage : unsigned int
+    {
+        StageView       = 1 << 0,
+        StageProjection = 1 << 1,
+        StageCulling    = 1 << 2,
+        StageClipping   = 1 << 3,
+        StageInstances  = 1 << 4,
+        StageCamera     = StageView | StageProjection | StageCulling | StageClipping,
+        StageAll        = StageCamera | StageInstances
+    };
+
+    bool     is_culling_clusters() const;
+    size_t   lod_level() const;
+    MeshView submitted_mesh() const;
+    void     update_mesh(unsigned int dirty);
+
+    MeshView                   m_mesh_view;
+    std::span<glm::vec3 const> m_axes_positions;
+    std::span<glm::mat4 const> m_instance_models;
+
+    unsigned int m_dirty              = StageAll;
+    bool         m_submission_changed = false; // Set by update_mesh(...) if the submitted geometry changed
+    MeshView     m_submitted;                  // The geometry submitted by the last call to update_mesh(...)
+
+    glm::vec3     m_camera_origin = glm::vec3(0.f);
+    Camera<float> m_camera;
+    Camera<float> m_view_space_camera; // The same projection with the identity as view matrix
+
+    CameraGeometry m_world_camera;
+    CameraGeometry m_view_camera;
+
+    LodChain const*    m_lod_chain        = nullptr;
+    LodSelector        m_lod;
+    glm::vec2          m_viewport         = glm::vec2(0.f);
+    MeshletMesh const* m_meshlets         = nullptr;
+    bool               m_cluster_culling  = false;
+    bool               m_instance_culling = true;
+    MeshletCuller      m_culler;
+    InstanceBatch      m_instances;
+    ClipOptions        m_clip_options;
+    TriangleClipper    m_clipper;
+    TransformPipeline  m_mesh;
+    TransformPipeline  m_axes;
+
+    Counters m_counters;
+    Versions m_versions;
+};
+
+/**
+ * \brief Show the counters, culling and clipping statistics of a \c FrameCache in a GUI window and let the user change
+ * its culling and clip options.
+ */
+void gui_frame_cache(FrameCache* cache);
+
+/**
+ * \brief Show the statistics of a \c FrameCache like \c gui_frame_cache(FrameCache*), but let the user change a copy of
+ * its options, for caches that are updated elsewhere (see \c FramePipeline).
+ */
+void gui_frame_cache(FrameCache const& cache, FrameCacheOptions* options);
+
+} // namespace ex2
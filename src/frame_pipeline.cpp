@@ -0,0 +1,187 @@
+#include "frame_pipeline.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+#include "profiler.hpp"
+
+namespace ex2
+{
+
+void apply_frame_settings(FrameSettings const& settings, FrameSettings* applied, FrameCache* cache)
+{
+    // These setters compare with the current value themselves
+    cache->set_mesh(settings.mesh);
+    cache->set_viewport(settings.viewport);
+    cache->set_options(settings.options);
+    cache->set_instance_culling(settings.instance_culling);
+
+    if (settings.meshlets != applied->meshlets)
+        cache->set_meshlets(settings.meshlets);
+    if (settings.lod_chain != applied->lod_chain)
+        cache->set_lod_chain(settings.lod_chain);
+    if (settings.instances_version != applied->instances_version ||
+        settings.instances.data() != applied->instances.data() ||
+        settings.instances.size() != applied->instances.size())
+        cache->set_instances(settings.instances);
+
+    *applied = settings;
+}
+
+FramePipeline::FramePipeline(size_t depth, bool bounded_latency, MeshView mesh, std::span<glm::vec3 const> axes_positions)
+    : m_pending_changes(std::clamp(depth, min_depth, max_depth), 0),
+      m_bounded_latency(bounded_latency)
+{
+    m_slots.resize(m_pending_changes.size());
+    for (std::unique_ptr<Slot>& slot : m_slots)
+    {
+        slot               = std::make_unique<Slot>();
+        slot->cache        = std::make_unique<FrameCache>(mesh, axes_positions);
+        slot->applied.mesh = mesh;
+    }
+
+    m_worker = std::thread(&FramePipeline::worker_main, this);
+}
+
+FramePipeline::~FramePipeline()
+{
+    m_stop.store(true, std::memory_order_release);
+    m_queued_frames.fetch_add(1, std::memory_order_release);
+    m_queued_frames.notify_one();
+    m_worker.join();
+}
+
+void FramePipeline::submit(CameraParameters const& parameters, GuiChanges changes, FrameSettings const& settings)
+{
+    EX2_PROFILE_ZONE("Pipeline submit");
+
+    // The slot was last used by the frame `depth` frames ago, so the display has to move past that frame first
+    Slot& target = slot(m_next_frame);
+    if (target.state.load(std::memory_order_acquire) != Free)
+        display(m_next_frame - depth() + 1);
+
+    // Every cache has to see all changes since its own last update, not only those of the last frame
+    for (GuiChanges& pending : m_pending_changes)
+        pending |= changes;
+
+    GuiChanges& pending = m_pending_changes[m_next_frame % depth()];
+    target.parameters   = parameters;
+    target.changes      = pending;
+    target.settings     = settings;
+    pending             = 0;
+
+    target.state.store(Queued, std::memory_order_release);
+    m_next_frame++;
+    m_stats.submitted++;
+
+    m_queued_frames.store(m_next_frame, std::memory_order_release);
+    m_queued_frames.notify_one();
+}
+
+FrameCache const& FramePipeline::acquire()
+{
+    assert(m_next_frame > 0);
+
+    EX2_PROFILE_ZONE("Pipeline acquire");
+
+    uint64_t newest = m_next_frame - 1;
+    if (m_bounded_latency)
+    {
+        // Show the previous frame, or the first one until there is a previous frame
+        uint64_t target = newest > 0 ? newest - 1 : 0;
+        if (m_displayed_frame == no_frame || m_displayed_frame < target)
+            display(target);
+    }
+    else
+    {
+        // Frames are computed in order, so the newest completed frame is found by searching backwards
+        uint64_t oldest = m_displayed_frame == no_frame ? m_first_held : m_displayed_frame + 1;
+        for (uint64_t frame = newest + 1; frame-- > oldest;)
+        {
+            if (slot(frame).state.load(std::memory_order_acquire) == Ready)
+            {
+                display(frame);
+                break;
+            }
+        }
+
+        if (m_displayed_frame == no_frame)
+            display(m_first_held);
+    }
+
+    return *slot(m_displayed_frame).cache;
+}
+
+FrameCache const* FramePipeline::displayed() const
+{
+    if (m_displayed_frame == no_frame)
+        return nullptr;
+    return m_slots[m_displayed_frame % m_slots.size()]->cache.get();
+}
+
+void FramePipeline::wait_idle()
+{
+    if (m_next_frame > 0)
+        wait_until_computed(slot(m_next_frame - 1));
+}
+
+void FramePipeline::wait_until_computed(Slot& slot)
+{
+    uint32_t state = slot.state.load(std::memory_order_acquire);
+    if (state != Queued && state != Computing)
+        return;
+
+    EX2_PROFILE_ZONE("Pipeline wait");
+    m_stats.waits++;
+    while (state == Queued || state == Computing)
+    {
+        slot.state.wait(state, std::memory_order_acquire);
+        state = slot.state.load(std::memory_order_acquire);
+    }
+}
+
+void FramePipeline::display(uint64_t frame)
+{
+    Slot& target = slot(frame);
+    wait_until_computed(target);
+
+    // Release the previously displayed frame and the completed frames that are skipped
+    for (uint64_t held = m_first_held; held < frame; held++)
+    {
+        if (held != m_displayed_frame)
+            m_stats.skipped++;
+        slot(held).state.store(Free, std::memory_order_relaxed);
+    }
+
+    target.state.store(Displayed, std::memory_order_relaxed);
+    m_displayed_frame = frame;
+    m_first_held      = frame;
+    m_stats.displayed++;
+}
+
+void FramePipeline::worker_main()
+{
+    for (uint64_t frame = 0;; frame++)
+    {
+        uint64_t queued = m_queued_frames.load(std::memory_order_acquire);
+        while (queued == frame && !m_stop.load(std::memory_order_acquire))
+        {
+            m_queued_frames.wait(queued, std::memory_order_acquire);
+            queued = m_queued_frames.load(std::memory_order_acquire);
+        }
+        if (m_stop.load(std::memory_order_acquire))
+            return;
+
+        Slot& current = slot(frame);
+        current.state.store(Computing, std::memory_order_relaxed);
+        {
+            EX2_PROFILE_ZONE("Pipelined frame");
+            apply_frame_settings(current.settings, &current.applied, current.cache.get());
+            current.cache->update(current.parameters, current.changes);
+        }
+        current.state.store(Ready, std::memory_order_release);
+        current.state.notify_all();
+    }
+}
+
+} // namespace ex2
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "frame_cache.hpp"
+
+namespace ex2
+{
+
+/**
+ * \brief Everything besides the camera parameters that a \c FrameCache is configured with, captured once per frame.
+ *
+ * The default settings are those of a newly constructed cache.
+ */
+struct FrameSettings
+{
+    MeshView                   mesh;
+    MeshletMesh const*         meshlets  = nullptr;
+    LodChain const*            lod_chain = nullptr;
+    glm::vec2                  viewport  = glm::vec2(0.f);
+    FrameCacheOptions          options;
+    std::span<glm::mat4 const> instances;
+    uint64_t                   instances_version = 0; //!< Incremented by the caller whenever the instance matrices change
+    bool                       instance_culling  = true;
+};
+
+/**
+ * \brief Apply the settings that differ from \c applied to \c cache, then remember them in \c applied.
+ *
+ * Only the setters of changed settings are called, so the cache only invalidates the stages that depend on them.
+ */
+void apply_frame_settings(FrameSettings const& settings, FrameSettings* applied, FrameCache* cache);
+
+/**
+ * \brief Updates frame caches on a worker thread, so the main thread can submit one frame while the next is computed.
+ *
+ * The pipeline owns \c depth frame caches that are used in turn. The main thread submits the camera parameters and
+ * settings of a frame with \c submit(...), which the worker thread applies to the next cache before updating it, and
+ * then renders the cache returned by \c acquire() while the worker computes the following frames.
+ *
+ * The caches are handed back and forth without locks: every cache has an atomic state that is only advanced by the
+ * thread currently owning the cache, with release stores and acquire loads, and a thread that has to wait for the
+ * other one blocks on the atomic. The GUI changes of frames computed by another cache are accumulated, so every cache
+ * still only recomputes the stages invalidated since its own last update.
+ *
+ * With bounded latency, \c acquire() returns the frame submitted just before the last one, so frames are shown exactly
+ * one frame late and the main thread waits for the worker if it is slower. Otherwise \c acquire() returns the newest
+ * completed frame without waiting, and frames are skipped if the worker falls behind by up to `depth - 1` frames.
+ *
+ * The data referenced by the settings (mesh, meshlets, instances) is read by the worker thread until the frames
+ * referencing it have been computed, see \c wait_idle().
+ */
+class FramePipeline
+{
+public:
+    static constexpr size_t min_depth = 2;
+    static constexpr size_t max_depth = 3;
+
+    struct Stats
+    {
+        uint64_t submitted = 0; //!< Frames passed to submit(...)
+        uint64_t displayed = 0; //!< Frames returned by acquire()
+        uint64_t skipped   = 0; //!< Completed frames never returned because a newer one was completed first
+        uint64_t waits     = 0; //!< Times the main thread had to wait for the worker thread
+    };
+
+    /**
+     * \param[in] depth           The number of frame caches, 2 for double or 3 for triple buffering (clamped to this range)
+     * \param[in] bounded_latency Always show the frame submitted before the last one instead of the newest completed one
+     * \param[in] mesh            The mesh passed to the frame caches, see \c FrameCache
+     * \param[in] axes_positions  The line end points of the world coordinate axes
+     */
+    FramePipeline(size_t depth, bool bounded_latency, MeshView mesh, std::span<glm::vec3 const> axes_positions);
+    ~FramePipeline();
+
+    FramePipeline(FramePipeline const&)            = delete;
+    FramePipeline& operator=(FramePipeline const&) = delete;
+
+    /**
+     * \brief Queue a frame for the worker thread; blocks only if all caches are in use.
+     *
+     * \param[in] parameters The camera parameters of the frame
+     * \param[in] changes    The parameters changed since the previous frame, as returned by \c gui(...)
+     * \param[in] settings   The settings of the frame, which are copied
+     */
+    void submit(CameraParameters const& parameters, GuiChanges changes, FrameSettings const& settings);
+
+    /**
+     * \brief The cache to render this frame; it stays valid and unchanged until the next call to \c submit(...) or \c acquire().
+     *
+     * Must be called after \c submit(...) at least once.
+     */
+    FrameCache const& acquire();
+
+    /**
+     * \brief The cache returned by the last call to \c acquire(), or \c nullptr before the first call.
+     */
+    FrameCache const* displayed() const;
+
+    /**
+     * \brief Wait until the worker thread has computed all submitted frames, e.g. before changing data they reference.
+     */
+    void wait_idle();
+
+    size_t       depth() const { return m_slots.size(); }
+    bool         bounded_latency() const { return m_bounded_latency; }
+    Stats const& stats() const { return m_stats; }
+
+private:
+    enum SlotState : uint32_t
+    {
+        Free = 0,  //!< Owned by the main thread, which can write the next frame into it
+        Queued,    //!< Owned by the worker thread, not started yet
+        Computing, //!< Owned by the worker thread
+        Ready,     //!< Owned by the main thread, computed but not displayed
+        Displayed  //!< Owned by the main thread, currently rendered
+    };
+
+    struct Slot
+    {
+        std::unique_ptr<FrameCache> cache;
+        FrameSettings               applied;
+        CameraParameters            parameters;
+        GuiChanges                  changes = 0;
+        FrameSettings               settings;
+        std::atomic<uint32_t>       state{Free};
+    };
+
+    static constexpr uint64_t no_frame = ~uint64_t(0);
+
+    Slot& slot(uint64_t frame) { return *m_slots[frame % m_slots.size()]; }
+
+    void wait_until_computed(Slot& slot);
+    void display(uint64_t frame);
+    void worker_main();
+
+    std::vector<std::unique_ptr<Slot>> m_slots;
+    std::vector<GuiChanges>            m_pending_changes; // Changes not yet seen by the cache of each slot
+    bool                               m_bounded_latency;
+
+    // Main thread only
+    uint64_t m_next_frame      = 0;        // Number of frames submitted
+    uint64_t m_displayed_frame = no_frame; // Frame currently displayed
+    uint64_t m_first_held      = 0;        // Oldest frame whose slot has not been freed yet
+    Stats    m_stats;
+
+    std::atomic<uint64_t> m_queued_frames{0}; // Frames handed to the worker thread
+    std::atomic<bool>     m_stop{false};
+    std::thread           m_worker;
+};
+
+} // namespace ex2
@@ -0,0 +1,65 @@
+#include "frustum.hpp"
+
+namespace ex2
+{
+
+Frustum frustum_from_matrix(glm::mat4 const& view_projection)
+{
+    // A point is inside the view volume if -w <= x, y, z <= w in clip space, i.e. w + x >= 0, w - x >= 0, ...
+    // Written in terms of the rows of the matrix, each inequality is a plane in the input space (Gribb/Hartmann)
+    glm::vec4 rows[4];
+    for (int r = 0; r < 4; r++)
+        rows[r] = glm::vec4(view_projection[0][r], view_projection[1][r], view_projection[2][r], view_projection[3][r]);
+
+    Frustum frustum;
+    for (unsigned int axis = 0; axis < 3; axis++)
+    {
+        frustum.planes[2 * axis]     = rows[3] + rows[axis];
+        frustum.planes[2 * axis + 1] = rows[3] - rows[axis];
+    }
+
+    for (glm::vec4& plane : frustum.planes)
+        plane /= glm::length(glm::vec3(plane));
+
+    return frustum;
+}
+
+bool frustum_intersects_sphere(Frustum const& frustum, glm::vec3 const& center, float radius, uint32_t plane_mask)
+{
+    for (unsigned int p = 0; p < Frustum::plane_count; p++)
+    {
+        if ((plane_mask & (1u << p)) == 0)
+            continue;
+
+        glm::vec4 const& plane = frustum.planes[p];
+        if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+            return false;
+    }
+    return true;
+}
+
+bool frustum_intersects_aabb(Frustum const& frustum, glm::vec3 const& aabb_min, glm::vec3 const& aabb_max, uint32_t* plane_mask)
+{
+    glm::vec3 center = 0.5f * (aabb_max + aabb_min);
+    glm::vec3 extent = 0.5f * (aabb_max - aabb_min);
+
+    for (unsigned int p = 0; p < Frustum::plane_count; p++)
+    {
+        if ((*plane_mask & (1u << p)) == 0)
+            continue;
+
+        // Signed distance of the center and the largest distance of a corner from the center along the plane normal
+        glm::vec4 const& plane    = frustum.planes[p];
+        glm::vec3        normal   = glm::vec3(plane);
+        float            distance = glm::dot(normal, center) + plane.w;
+        float            radius   = glm::dot(extent, glm::abs(normal));
+
+        if (distance < -radius)
+            return false;
+        if (distance >= radius)
+            *plane_mask &= ~(1u << p);
+    }
+    return true;
+}
+
+} // namespace ex2
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+namespace ex2
+{
+
+/**
+ * \brief The six planes bounding the view volume of a camera, in the space the camera matrix is applied to.
+ *
+ * The planes are ordered left, right, bottom, top, near, far, the same order as the clip planes of \c TriangleClipper.
+ * Each plane is stored as (normal, offset) with the normal pointing into the view volume and normalized, so
+ * `dot(plane, vec4(p, 1))` is the signed distance of a point \c p from the plane.
+ */
+struct Frustum
+{
+    static constexpr unsigned int plane_count = 6;
+    static constexpr uint32_t     all_planes  = (1u << plane_count) - 1;
+
+    glm::vec4 planes[plane_count];
+};
+
+/**
+ * \brief Extract the frustum planes of a camera.
+ *
+ * The frustum is the same one that \c render_camera(...) draws: passing `projection * view` gives the planes in world
+ * space, passing only the projection matrix gives them in view space.
+ *
+ * \param[in] view_projection The matrix transforming points to clip space
+ */
+Frustum frustum_from_matrix(glm::mat4 const& view_projection);
+
+/**
+ * \brief Test a bounding sphere against the planes of a frustum selected by \c plane_mask.
+ *
+ * \return true if the sphere is at least partially inside all selected planes
+ */
+bool frustum_intersects_sphere(Frustum const& frustum, glm::vec3 const& center, float radius, uint32_t plane_mask = Frustum::all_planes);
+
+/**
+ * \brief Test an axis-aligned bounding box against the planes of a frustum selected by \c plane_mask.
+ *
+ * Planes that fully contain the box are removed from \c plane_mask, so the children of a bounding volume hierarchy node
+ * only need to be tested against the remaining planes.
+ *
+ * \param[in]     frustum    The frustum to test against
+ * \param[in]     aabb_min   The minimum corner of the box
+ * \param[in]     aabb_max   The maximum corner of the box
+ * \param[in,out] plane_mask The planes to test; planes fully containing the box are cleared
+ *
+ * \return false if the box is entirely outside one of the selected planes, true otherwise
+ */
+bool frustum_intersects_aabb(Frustum const& frustum, glm::vec3 const& aabb_min, glm::vec3 const& aabb_max, uint32_t* plane_mask);
+
+} // namespace ex2
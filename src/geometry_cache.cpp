@@ -0,0 +1,161 @@
+#include "geometry_cache.hpp"
+
+#include <imgui.h>
+
+namespace ex2
+{
+
+GeometryCache::Stats& GeometryCache::Stats::operator+=(Stats const& other)
+{
+    changed_vertex_bytes += other.changed_vertex_bytes;
+    changed_index_bytes += other.changed_index_bytes;
+    changed_transform_bytes += other.changed_transform_bytes;
+    unchanged_bytes += other.unchanged_bytes;
+    skipped_updates += other.skipped_updates;
+    transformed_vertices += other.transformed_vertices;
+    return *this;
+}
+
+GeometryCache::Handle GeometryCache::add_mesh(glm::vec3 const& color)
+{
+    m_entries.emplace_back();
+    m_entries.back().color = color;
+    return static_cast<Handle>(m_entries.size() - 1);
+}
+
+GeometryCache::Handle GeometryCache::add_lines()
+{
+    m_entries.emplace_back();
+    m_entries.back().lines = true;
+    return static_cast<Handle>(m_entries.size() - 1);
+}
+
+bool GeometryCache::is_current(uint64_t* previous_version, uint64_t version, size_t bytes, uint64_t* changed_bytes)
+{
+    if (version != unknown_version && version == *previous_version)
+    {
+        m_frame_stats.skipped_updates++;
+        m_frame_stats.unchanged_bytes += bytes;
+        return true;
+    }
+
+    *previous_version = version;
+    *changed_bytes += bytes;
+    return false;
+}
+
+void GeometryCache::set_positions(Handle handle, std::span<glm::vec3 const> positions, uint64_t version)
+{
+    // Positions of the other kind count as changed, and the view is always replaced, since unchanged data may have moved
+    Entry& entry = m_entries[handle];
+    if (!entry.homogeneous_positions.empty())
+        entry.positions_version = unknown_version;
+
+    entry.positions             = positions;
+    entry.homogeneous_positions = {};
+    if (!is_current(&entry.positions_version, version, positions.size_bytes(), &m_frame_stats.changed_vertex_bytes))
+        update_transformed(entry);
+}
+
+void GeometryCache::set_positions(Handle handle, std::span<glm::vec4 const> positions, uint64_t version)
+{
+    Entry& entry = m_entries[handle];
+    if (!entry.positions.empty())
+        entry.positions_version = unknown_version;
+
+    entry.positions             = {};
+    entry.homogeneous_positions = positions;
+    entry.transformed.clear();
+    is_current(&entry.positions_version, version, positions.size_bytes(), &m_frame_stats.changed_vertex_bytes);
+}
+
+void GeometryCache::set_faces(Handle handle, std::span<glm::u32vec3 const> faces, uint64_t version)
+{
+    Entry& entry = m_entries[handle];
+    entry.faces  = faces;
+    is_current(&entry.elements_version, version, faces.size_bytes(), &m_frame_stats.changed_index_bytes);
+}
+
+void GeometryCache::set_line_colors(Handle handle, std::span<glm::vec3 const> colors, uint64_t version)
+{
+    Entry& entry = m_entries[handle];
+    entry.colors = colors;
+    is_current(&entry.elements_version, version, colors.size_bytes(), &m_frame_stats.changed_index_bytes);
+}
+
+void GeometryCache::set_color(Handle handle, glm::vec3 const& color)
+{
+    m_entries[handle].color = color;
+}
+
+void GeometryCache::set_transform(Handle handle, glm::mat4 const& transform)
+{
+    Entry& entry = m_entries[handle];
+    if (transform == entry.transform)
+        return;
+
+    entry.transform = transform;
+    m_frame_stats.changed_transform_bytes += sizeof(glm::mat4);
+    update_transformed(entry);
+}
+
+void GeometryCache::update_transformed(Entry& entry)
+{
+    // Stands in for the vertex shader of a renderer with retained buffers
+    if (entry.transform == glm::mat4(1.f))
+    {
+        entry.transformed.clear();
+        return;
+    }
+
+    entry.transformed.resize(entry.positions.size());
+    for (size_t i = 0; i < entry.positions.size(); i++)
+        entry.transformed[i] = glm::vec3(entry.transform * glm::vec4(entry.positions[i], 1.f));
+    m_frame_stats.transformed_vertices += entry.positions.size();
+}
+
+void GeometryCache::begin_frame()
+{
+    m_total_stats += m_frame_stats;
+    m_frame_stats = Stats();
+}
+
+size_t GeometryCache::transformed_bytes() const
+{
+    size_t bytes = 0;
+    for (Entry const& entry : m_entries)
+        bytes += entry.transformed.size() * sizeof(glm::vec3);
+    return bytes;
+}
+
+void gui_geometry_caches(std::span<GeometryCache const> caches)
+{
+    GeometryCache::Stats frame;
+    GeometryCache::Stats total;
+    size_t               transformed = 0;
+    size_t               entries     = 0;
+    for (GeometryCache const& cache : caches)
+    {
+        frame += cache.frame_stats();
+        total += cache.total_stats();
+        transformed += cache.transformed_bytes();
+        entries += cache.size();
+    }
+    total += frame;
+
+    // The renderers receive all data in every frame, so the changed data is only what retained GPU buffers would need
+    ImGui::Begin("Geometry cache");
+    ImGui::Text("%zu meshes and line sets, %.1f KiB of positions transformed on the CPU", entries, static_cast<double>(transformed) / 1024.);
+    ImGui::Text("Changed this frame: %.1f KiB (%llu B transforms, %llu vertices transformed)", static_cast<double>(frame.changed_bytes()) / 1024.,
+                static_cast<unsigned long long>(frame.changed_transform_bytes), static_cast<unsigned long long>(frame.transformed_vertices));
+    ImGui::Text("  vertices: %.1f KiB, indices and colors: %.1f KiB", static_cast<double>(frame.changed_vertex_bytes) / 1024.,
+                static_cast<double>(frame.changed_index_bytes) / 1024.);
+    ImGui::Text("  unchanged: %.1f KiB in %llu updates", static_cast<double>(frame.unchanged_bytes) / 1024.,
+                static_cast<unsigned long long>(frame.skipped_updates));
+    ImGui::TextDisabled("The renderers upload all data in every frame; retained buffers would only need the changed data");
+    ImGui::Separator();
+    ImGui::Text("Changed in total: %.1f MiB", static_cast<double>(total.changed_bytes()) / (1024. * 1024.));
+    ImGui::End();
+}
+
+} // namespace ex2
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "profiler.hpp"
+
+namespace ex2
+{
+
+//! Version of data that may have changed in any way, which always counts as changed
+inline constexpr uint64_t unknown_version = ~uint64_t(0);
+
+//! Version of data that never changes, which only counts as changed when it is first drawn
+inline constexpr uint64_t static_version = 0;
+
+/**
+ * \brief Tracks which meshes and line sets drawn by a renderer changed since the previous frame, by their versions.
+ *
+ * Meshes and line sets are registered once and identified by a handle. Every frame, the caller passes views of the
+ * current data of each one together with a version, and \c draw(...) later draws from these views, so the data must
+ * stay valid until then. Data with the same version as in the previous frame is unchanged; all other data counts as
+ * changed. The counters in \c Stats tell how much data a renderer with retained GPU buffers would have to upload.
+ *
+ * The renderers of this project take whole spans and keep no buffers between frames, so they still receive all data in
+ * every frame and nothing is saved on the upload itself. What is saved is the transform: positions can be kept in
+ * object space with a transform, which is applied on the CPU only when the transform or the positions change, instead
+ * of in every frame like \c CommandBuffer::replay(...) does.
+ *
+ * A cache is not thread-safe, but different caches can be updated concurrently.
+ */
+class GeometryCache
+{
+public:
+    using Handle = uint32_t;
+
+    /**
+     * \brief Counters of a frame or of all frames.
+     */
+    struct Stats
+    {
+        uint64_t changed_vertex_bytes    = 0; //!< Positions with a new version
+        uint64_t changed_index_bytes     = 0; //!< Faces and line colors with a new version
+        uint64_t changed_transform_bytes = 0; //!< Transforms that changed
+        uint64_t unchanged_bytes         = 0; //!< Data with the same version as in the previous frame
+        uint64_t skipped_updates         = 0; //!< Updates with the same version as in the previous frame
+        uint64_t transformed_vertices    = 0; //!< Positions transformed on the CPU
+
+        uint64_t changed_bytes() const { return changed_vertex_bytes + changed_index_bytes + changed_transform_bytes; }
+
+        Stats& operator+=(Stats const& other);
+    };
+
+    /**
+     * \brief Register a mesh drawn in a single color.
+     */
+    Handle add_mesh(glm::vec3 const& color);
+
+    /**
+     * \brief Register a set of lines with one color per line.
+     */
+    Handle add_lines();
+
+    bool is_lines(Handle handle) const { return m_entries[handle].lines; }
+
+    /**
+     * \brief Update the positions of a mesh or line set.
+     *
+     * Passing 3D positions drops the homogeneous ones and vice versa.
+     *
+     * \param[in] handle    The mesh or line set
+     * \param[in] positions The current positions, which have to stay valid until they are drawn
+     * \param[in] version   The version of the positions, see \c unknown_version and \c static_version
+     */
+    void set_positions(Handle handle, std::span<glm::vec3 const> positions, uint64_t version);
+    void set_positions(Handle handle, std::span<glm::vec4 const> positions, uint64_t version);
+
+    /**
+     * \brief Update the faces of a mesh.
+     */
+    void set_faces(Handle handle, std::span<glm::u32vec3 const> faces, uint64_t version);
+
+    /**
+     * \brief Update the colors of a line set, one per line.
+     */
+    void set_line_colors(Handle handle, std::span<glm::vec3 const> colors, uint64_t version);
+
+    /**
+     * \brief Change the color of a mesh.
+     */
+    void set_color(Handle handle, glm::vec3 const& color);
+
+    /**
+     * \brief Transform the 3D positions of a mesh or line set, e.g. to move it without changing its positions.
+     */
+    void set_transform(Handle handle, glm::mat4 const& transform);
+
+    /**
+     * \brief Start counting the changes of a new frame.
+     */
+    void begin_frame();
+
+    Stats const& frame_stats() const { return m_frame_stats; }
+    Stats const& total_stats() const { return m_total_stats; }
+
+    size_t size() const { return m_entries.size(); }
+
+    //! Bytes of the positions kept transformed on the CPU
+    size_t transformed_bytes() const;
+
+    /**
+     * \brief Draw a mesh or line set with \c renderer from the data last passed to the cache.
+     *
+     * The renderer has to accept the kind of positions last passed to \c set_positions(...).
+     */
+    template <typename Renderer>
+    void draw(Handle handle, Renderer& renderer) const;
+
+private:
+    struct Entry
+    {
+        std::span<glm::vec3 const>    positions;
+        std::span<glm::vec4 const>    homogeneous_positions;
+        std::vector<glm::vec3>        transformed; // The 3D positions with the transform applied, unless it is the identity
+        std::span<glm::u32vec3 const> faces;
+        std::span<glm::vec3 const>    colors;
+        glm::mat4                     transform = glm::mat4(1.f);
+        glm::vec3                     color     = glm::vec3(0.f);
+        bool                          lines     = false;
+
+        uint64_t positions_version = unknown_version;
+        uint64_t elements_version  = unknown_version; // Of the faces or the line colors
+    };
+
+    bool is_current(uint64_t* previous_version, uint64_t version, size_t bytes, uint64_t* changed_bytes);
+    void update_transformed(Entry& entry);
+
+    std::vector<Entry> m_entries;
+    Stats              m_frame_stats;
+    Stats              m_total_stats;
+};
+
+/**
+ * \brief Show the change statistics of a set of geometry caches, e.g. those of all canvases, in a GUI window.
+ */
+void gui_geometry_caches(std::span<GeometryCache const> caches);
+
+template <typename Renderer>
+void GeometryCache::draw(Handle handle, Renderer& renderer) const
+{
+    Entry const& entry = m_entries[handle];
+
+    if (!entry.homogeneous_positions.empty())
+    {
+        if constexpr (requires { renderer.render_lines(entry.homogeneous_positions, entry.colors); })
+        {
+            if (entry.lines)
+            {
+                EX2_PROFILE_ZONE("Render lines");
+                renderer.render_lines(entry.homogeneous_positions, entry.colors);
+            }
+            else
+            {
+                EX2_PROFILE_ZONE("Render mesh");
+                renderer.render_mesh(entry.homogeneous_positions, entry.faces, entry.color);
+            }
+        }
+        else
+            assert(false && "Renderer does not support homogeneous positions");
+        return;
+    }
+
+    std::span<glm::vec3 const> positions = entry.transform == glm::mat4(1.f) ? entry.positions : std::span<glm::vec3 const>(entry.transformed);
+    if constexpr (requires { renderer.render_lines(positions, entry.colors); })
+    {
+        if (entry.lines)
+        {
+            EX2_PROFILE_ZONE("Render lines");
+            renderer.render_lines(positions, entry.colors);
+        }
+        else
+        {
+            EX2_PROFILE_ZONE("Render mesh");
+            renderer.render_mesh(positions, entry.faces, entry.color);
+        }
+    }
+    else
+        assert(positions.empty() && "Renderer does not support 3D positions");
+}
+
+} // namespace ex2
@@ -0,0 +1,244 @@
+#include "headless.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cgtub/primitives.hpp>
+
+#include "canvas_commands.hpp"
+#include "command_line.hpp"
+#include "frame_cache.hpp"
+#include "helper.hpp"
+#include "lod.hpp"
+#include "mesh_loader.hpp"
+#include "mesh_optimizer.hpp"
+#include "meshlet.hpp"
+#include "software_rasterizer.hpp"
+#include "thread_pool.hpp"
+
+namespace ex2
+{
+
+namespace
+{
+
+//! Largest width and height of the image, which keeps the pixel count within 32 bits
+constexpr int max_image_extent = 16384;
+
+struct HeadlessOptions
+{
+    std::string output;
+    std::string mesh;
+    int         width       = 1600;
+    int         height      = 400;
+    int         threads     = -1;
+    float       azimuth     = 0.f;
+    bool        perspective = false;
+};
+
+bool parse_options(int argc, char** argv, HeadlessOptions* options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+
+        if (std::strcmp(argv[i], "--render") == 0 && has_value)
+            options->output = argv[++i];
+        else if (std::strcmp(argv[i], "--width") == 0 && has_value)
+        {
+            if (!parse_option_value("--width", argv[++i], 1, max_image_extent, &options->width))
+                return false;
+        }
+        else if (std::strcmp(argv[i], "--height") == 0 && has_value)
+        {
+            if (!parse_option_value("--height", argv[++i], 1, max_image_extent, &options->height))
+                return false;
+        }
+        else if (std::strcmp(argv[i], "--mesh") == 0 && has_value)
+            options->mesh = argv[++i];
+        else if (std::strcmp(argv[i], "--azimuth") == 0 && has_value)
+            options->azimuth = std::strtof(argv[++i], nullptr);
+        else if (std::strcmp(argv[i], "--perspective") == 0)
+            options->perspective = true;
+        else if (std::strcmp(argv[i], "--threads") == 0 && has_value)
+        {
+            unsigned int threads = 0;
+            if (!parse_option_value("--threads", argv[++i], 0u, max_worker_count, &threads))
+                return false;
+            options->threads = static_cast<int>(threads);
+        }
+        else
+        {
+            std::cerr << "Unknown or incomplete option: " << argv[i] << std::endl;
+            return false;
+        }
+    }
+
+    return !options->output.empty() && options->width > 0 && options->height > 0;
+}
+
+/**
+ * A perspective camera looking down at the origin from the given distance.
+ */
+Camera<float> overview_camera(float distance)
+{
+    CameraParameters parameters;
+    parameters.fov                 = 45.f;
+    parameters.znear               = 0.1f;
+    parameters.zfar                = 4.f * distance;
+    parameters.transformation_type = TransformationType::Perspective;
+
+    Camera<float> camera;
+    camera.set_view(camera_view(distance * camera_position(glm::radians(35.f))));
+    camera.set_projection(camera_projection(parameters));
+    return camera;
+}
+
+} // namespace
+
+bool headless_render_requested(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--render") == 0)
+            return true;
+    }
+    return false;
+}
+
+int run_headless_render(int argc, char** argv)
+{
+    HeadlessOptions options;
+    if (!parse_options(argc, argv, &options))
+    {
+        std::cerr << "Usage: " << argv[0] << " --render FILE.(png|ppm) [--width W] [--height H] [--mesh FILE] [--azimuth A] [--perspective] [--threads N]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (options.threads >= 0)
+        configure_default_thread_pool(static_cast<unsigned int>(options.threads));
+
+    // The bunny is embedded in optimized order, loaded meshes are optimized like the window does for converted meshes
+    Mesh mesh;
+    if (options.mesh.empty())
+        create_bunny_geometry(&mesh.positions, &mesh.indices);
+    else
+    {
+        if (!load_mesh(options.mesh, &mesh))
+            return EXIT_FAILURE;
+        optimize_mesh(&mesh.positions, mesh.indices);
+    }
+
+    std::vector<glm::vec3>    sphere_vertices;
+    std::vector<glm::u32vec3> sphere_indices;
+    cgtub::create_sphere_geometry(0.03f, &sphere_vertices, &sphere_indices);
+
+    glm::vec3 const coordinate_axes_start_end[] = {{0, 0, 0}, {1, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 1}};
+    glm::vec3 const coordinate_axes_color[]     = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+
+    glm::vec3 const view_box[] = {
+        {-1, -1, -1}, {1, -1, -1}, {-1, 1, -1}, {1, 1, -1}, {-1, -1, 1}, {1, -1, 1}, {-1, 1, 1}, {1, 1, 1}};
+    glm::vec3 const box_lines[] = {
+        view_box[0], view_box[1], view_box[1], view_box[3], view_box[3], view_box[2], view_box[2], view_box[0],
+        view_box[4], view_box[5], view_box[5], view_box[7], view_box[7], view_box[6], view_box[6], view_box[4],
+        view_box[0], view_box[4], view_box[1], view_box[5], view_box[2], view_box[6], view_box[3], view_box[7]};
+    std::vector<glm::vec3> const box_colors(12, glm::vec3(0.f));
+
+    glm::vec3 const mesh_color(0.75f);
+
+    CameraParameters parameters;
+    parameters.azimuth             = options.azimuth;
+    parameters.transformation_type = options.perspective ? TransformationType::Perspective : TransformationType::Orthographic;
+
+    // The topology and bounding sphere of the bunny are known at compile time
+    MeshletMesh meshlets;
+    LodChain    lod_chain;
+    if (options.mesh.empty())
+    {
+        PreprocessedMeshView const bunny = bunny_preprocessed();
+        build_meshlets(mesh.view(), &meshlets, &bunny.topology);
+        lod_chain.build(mesh.view(), bunny.center, bunny.radius);
+    }
+    else
+    {
+        build_meshlets(mesh.view(), &meshlets);
+        lod_chain.build(mesh.view());
+    }
+
+    // The canvases are laid out as in the window, side by side with the same share of the image each
+    glm::vec4 const canvas_viewports[] = {
+        {0.00f, 0.f, 0.248f, 1.f},
+        {0.25f, 0.f, 0.248f, 1.f},
+        {0.50f, 0.f, 0.248f, 1.f},
+        {0.75f, 0.f, 0.25f, 1.f},
+    };
+
+    FrameCache frame_cache(mesh.view(), coordinate_axes_start_end);
+    frame_cache.set_meshlets(&meshlets);
+    frame_cache.set_lod_chain(&lod_chain);
+    frame_cache.set_viewport(glm::vec2(canvas_viewports[3].z * static_cast<float>(options.width), static_cast<float>(options.height)));
+
+    CanvasScene scene;
+    scene.world_axes       = coordinate_axes_start_end;
+    scene.axes_colors      = coordinate_axes_color;
+    scene.box_lines        = box_lines;
+    scene.box_colors       = box_colors;
+    scene.marker_positions = sphere_vertices;
+    scene.marker_faces     = sphere_indices;
+    scene.mesh_color       = mesh_color;
+
+    // The canvases are recorded just like in the window, while the frame cache is updated
+    CanvasView const canvas_views[] = {CanvasView::World, CanvasView::View, CanvasView::Ndc, CanvasView::Clip};
+    CommandBuffer    canvas_commands[4];
+    TaskGraph        graph;
+
+    FrameCache::StageTasks stages = frame_cache.schedule_update(parameters, 0, &graph);
+    for (size_t i = 0; i < 4; i++)
+        schedule_canvas(canvas_views[i], frame_cache, stages, scene, &graph, &canvas_commands[i]);
+    graph.run();
+
+    Framebuffer      framebuffer(options.width, options.height);
+    SoftwareRenderer renderer_left(&framebuffer, canvas_viewports[0]);
+    SoftwareRenderer renderer_middle_view(&framebuffer, canvas_viewports[1]);
+    SoftwareRenderer renderer_middle_clip(&framebuffer, canvas_viewports[2]);
+    SoftwareRenderer renderer_right(&framebuffer, canvas_viewports[3]);
+
+    // The world and view canvases show the camera and its view volume, the NDC canvas the canonical view volume
+    Camera<float> overview = overview_camera(3.5f);
+    renderer_left.set_camera(overview);
+    renderer_middle_view.set_camera(overview);
+    renderer_middle_clip.set_camera(overview_camera(5.5f));
+
+    auto start = std::chrono::steady_clock::now();
+
+    renderer_left.clear(glm::vec3(1.f));
+    canvas_commands[0].replay(renderer_left);
+
+    renderer_middle_view.clear(glm::vec3(1.f));
+    canvas_commands[1].replay(renderer_middle_view);
+
+    renderer_middle_clip.clear(glm::vec3(1.f));
+    canvas_commands[2].replay(renderer_middle_clip);
+
+    renderer_right.clear(glm::vec3(1.f));
+    canvas_commands[3].replay(renderer_right);
+
+    auto end = std::chrono::steady_clock::now();
+
+    if (!write_image(framebuffer, options.output))
+        return EXIT_FAILURE;
+
+    size_t rasterized = 0;
+    for (SoftwareRenderer const* renderer : {&renderer_left, &renderer_middle_view, &renderer_middle_clip, &renderer_right})
+        rasterized += renderer->stats().rasterized_triangles;
+
+    std::cout << options.output << ": " << options.width << "x" << options.height << ", " << rasterized << " triangles rasterized in "
+              << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+} // namespace ex2
@@ -0,0 +1,31 @@
+#pragma once
+
+namespace ex2
+{
+
+/**
+ * \brief Check if a headless rendering was requested on the command line (`--render`).
+ */
+bool headless_render_requested(int argc, char** argv);
+
+/**
+ * \brief Render one frame of the four canvases with \c SoftwareRenderer and write it to an image, without a window.
+ *
+ * The canvases are laid out as in the window and show the same data, computed by a \c FrameCache for the default
+ * camera parameters. The world, view and NDC canvases are seen from fixed overview cameras instead of the interactive
+ * cameras of the window.
+ *
+ * Options:
+ *  - `--render FILE`   Write the image to FILE, as PNG or PPM depending on its extension
+ *  - `--width W`       Width of the image (default: 1600)
+ *  - `--height H`      Height of the image (default: 400)
+ *  - `--mesh FILE`     Use the mesh in FILE instead of the bunny (see \c load_mesh(...))
+ *  - `--azimuth A`     Azimuth of the camera in radians (default: 0)
+ *  - `--perspective`   Use the perspective instead of the orthographic transformation
+ *  - `--threads N`     Use N worker threads in addition to the main thread (default: hardware threads - 1)
+ *
+ * \return The exit code of the program
+ */
+int run_headless_render(int argc, char** argv);
+
+} // namespace ex2
@@ -1,16 +1,76 @@
 #include "helper.hpp"
 
+#include <algorithm>
+#include <cmath>
+
+#include <glm/gtc/constants.hpp>
 #include <imgui.h>
 
 #include "bunny.hpp"
+#include "canvas_commands.hpp"
+#include "geometry_cache.hpp"
+#include "mesh_loader.hpp"
+#include "software_rasterizer.hpp"
 
 namespace ex2
 {
 
-void render_camera(cgtub::SimpleRenderer& renderer, glm::mat4 const& view_matrix, glm::mat4 const& projection_matrix)
+namespace
+{
+
+glm::vec3 const camera_axes_colors[] = {
+    glm::vec3(1, 0, 0),
+    glm::vec3(0, 1, 0),
+    glm::vec3(0, 0, 1),
+};
+
+glm::vec3 const frustum_line_colors[12] = {
+    glm::vec3(0.f), glm::vec3(0.f), glm::vec3(0.f), glm::vec3(0.f),
+    glm::vec3(0.f), glm::vec3(0.f), glm::vec3(0.f), glm::vec3(0.f),
+    glm::vec3(0.f), glm::vec3(0.f), glm::vec3(0.f), glm::vec3(0.f)};
+
+glm::vec3 const near_line_colors[4] = {
+    glm::vec3(0.75f),
+    glm::vec3(0.75f),
+    glm::vec3(0.75f),
+    glm::vec3(0.75f),
+};
+
+// The extra arguments are passed on to every render_lines call, e.g. the versions of a command buffer
+template <typename Renderer, typename... Extra>
+void render_camera_geometry(Renderer& renderer, CameraGeometry const& geometry, Extra... extra)
+{
+    // Render the camera coordinate system
+    renderer.render_lines(geometry.axes_lines, camera_axes_colors, extra...);
+
+    if (geometry.has_frustum)
+    {
+        // Render the view volume
+        renderer.render_lines(geometry.frustum_lines, frustum_line_colors, extra...);
+
+        if (geometry.is_perspective)
+        {
+            renderer.render_lines(geometry.near_lines, near_line_colors, extra...);
+        }
+    }
+}
+
+// Evaluated once by the compiler and stored with the program, so it costs nothing at startup
+constexpr auto bunny_data = preprocess_mesh(bunny_positions, bunny_indices);
+
+constexpr float bunny_extent = std::max({bunny_data.aabb_max.x - bunny_data.aabb_min.x,
+                                         bunny_data.aabb_max.y - bunny_data.aabb_min.y,
+                                         bunny_data.aabb_max.z - bunny_data.aabb_min.z});
+static_assert(bunny_extent > normalized_mesh_extent - 0.005f && bunny_extent < normalized_mesh_extent + 0.005f,
+              "Loaded meshes are normalized to the extent of the bunny");
+
+/**
+ * The lines of the camera coordinate system, given the inverse of the view matrix.
+ */
+void set_camera_axes(glm::mat4 const& inv_view_matrix, CameraGeometry* geometry)
 {
     // Define geometry for the camera coordinate system
-    glm::vec3 lines[] = {
+    glm::vec3 const lines[] = {
         glm::vec3(0, 0, 0),
         glm::vec3(1, 0, 0),
         glm::vec3(0, 0, 0),
@@ -19,118 +79,140 @@ void render_camera(cgtub::SimpleRenderer& renderer, glm::mat4 const& view_matrix
         glm::vec3(0, 0, 1),
     };
 
-    static glm::vec3 colors[] = {
-        glm::vec3(1, 0, 0),
-        glm::vec3(0, 1, 0),
-        glm::vec3(0, 0, 1),
-    };
+    for (size_t i = 0; i < 6; i++)
+    {
+        geometry->axes_lines[i] = inv_view_matrix * glm::vec4(0.25f * lines[i], 1.f);
+    }
+}
 
-    glm::mat4 inv_view_matrix       = glm::inverse(view_matrix);
-    glm::mat4 inv_projection_matrix = glm::inverse(projection_matrix);
+/**
+ * All lines of a camera with a view volume, given the inverse of the view matrix and the corners of the view volume.
+ */
+void set_camera_lines(glm::mat4 const& inv_view_matrix, glm::vec3 const* frustum, bool is_perspective, CameraGeometry* geometry)
+{
+    set_camera_axes(inv_view_matrix, geometry);
+    std::copy(frustum, frustum + 8, geometry->frustum_corners);
 
-    // Render the camera coordinate system
-    for (glm::vec3& point : lines)
+    size_t idx = 0;
+    for (size_t i = 0; i < 4; i++)
     {
-        point = inv_view_matrix * glm::vec4(0.25f * point, 1.f);
+        geometry->frustum_lines[idx++] = frustum[i];
+        geometry->frustum_lines[idx++] = frustum[(i + 1) % 4];
+
+        geometry->frustum_lines[idx++] = frustum[4 + i];
+        geometry->frustum_lines[idx++] = frustum[4 + ((i + 1) % 4)];
+
+        geometry->frustum_lines[idx++] = frustum[i];
+        geometry->frustum_lines[idx++] = frustum[i + 4];
     }
-    renderer.render_lines(lines, colors);
 
-    bool is_identity = projection_matrix == glm::mat4(1);
-    if (!is_identity)
+    // The lines connecting to the near plane only exist for a perspective transformation
+    geometry->is_perspective = is_perspective;
+    if (geometry->is_perspective)
     {
-        // Render the view volume
-        glm::vec3 frustum[8] = {
-            glm::vec3(-1, -1, -1),
-            glm::vec3(1, -1, -1),
-            glm::vec3(1, 1, -1),
-            glm::vec3(-1, 1, -1),
-            glm::vec3(-1, -1, 1),
-            glm::vec3(1, -1, 1),
-            glm::vec3(1, 1, 1),
-            glm::vec3(-1, 1, 1)};
-
-        for (glm::vec3& point : frustum)
-        {
-            glm::vec4 hpoint = inv_view_matrix * inv_projection_matrix * glm::vec4(point, 1.f);
-            point            = hpoint / hpoint.w;
-        }
-
-        glm::vec3 frustum_line_points[24];
-        size_t    idx = 0;
+        glm::vec3 cameraLocation = inv_view_matrix * glm::vec4(0, 0, 0, 1);
         for (size_t i = 0; i < 4; i++)
         {
-            frustum_line_points[idx++] = frustum[i];
-            frustum_line_points[idx++] = frustum[(i + 1) % 4];
+            geometry->near_lines[2 * i]     = cameraLocation;
+            geometry->near_lines[2 * i + 1] = frustum[i];
+        }
+    }
+}
 
-            frustum_line_points[idx++] = frustum[4 + i];
-            frustum_line_points[idx++] = frustum[4 + ((i + 1) % 4)];
+} // namespace
 
-            frustum_line_points[idx++] = frustum[i];
-            frustum_line_points[idx++] = frustum[i + 4];
-        }
+void compute_camera_geometry(glm::mat4 const& view_matrix, glm::mat4 const& projection_matrix, CameraGeometry* geometry)
+{
+    glm::mat4 inv_view_matrix       = glm::inverse(view_matrix);
+    glm::mat4 inv_projection_matrix = glm::inverse(projection_matrix);
 
-        glm::vec3 frustum_line_colors[12];
-        for (glm::vec3& c : frustum_line_colors)
-        {
-            c = glm::vec3(0.f);
-        }
+    bool is_identity      = projection_matrix == glm::mat4(1);
+    geometry->has_frustum = !is_identity;
+    if (is_identity)
+    {
+        set_camera_axes(inv_view_matrix, geometry);
+        return;
+    }
 
-        renderer.render_lines(frustum_line_points, frustum_line_colors);
+    // The view volume
+    glm::vec3 frustum[8] = {
+        glm::vec3(-1, -1, -1),
+        glm::vec3(1, -1, -1),
+        glm::vec3(1, 1, -1),
+        glm::vec3(-1, 1, -1),
+        glm::vec3(-1, -1, 1),
+        glm::vec3(1, -1, 1),
+        glm::vec3(1, 1, 1),
+        glm::vec3(-1, 1, 1),
+    };
 
-        // Render the lines connecting to the near plane only for a perspective transformation
-        bool is_perspective_transformation = (projection_matrix[0][3] != 0) ||
-                                             (projection_matrix[1][3] != 0) ||
-                                             (projection_matrix[2][3] != 0);
-        if (is_perspective_transformation)
-        {
-            glm::vec3 cameraLocation      = inv_view_matrix * glm::vec4(0, 0, 0, 1);
-            glm::vec3 near_line_points[8] = {
-                cameraLocation,
-                frustum[0],
-                cameraLocation,
-                frustum[1],
-                cameraLocation,
-                frustum[2],
-                cameraLocation,
-                frustum[3],
-            };
-
-            glm::vec3 near_line_colors[4] = {
-                glm::vec3(0.75f),
-                glm::vec3(0.75f),
-                glm::vec3(0.75f),
-                glm::vec3(0.75f),
-            };
-
-            renderer.render_lines(near_line_points, near_line_colors);
-        }
+    glm::mat4 inv_view_projection_matrix = inv_view_matrix * inv_projection_matrix;
+    for (size_t i = 0; i < 8; i++)
+    {
+        glm::vec4 hpoint = inv_view_projection_matrix * glm::vec4(frustum[i], 1.f);
+        frustum[i]       = hpoint / hpoint.w;
     }
+
+    bool is_perspective = (projection_matrix[0][3] != 0) ||
+                          (projection_matrix[1][3] != 0) ||
+                          (projection_matrix[2][3] != 0);
+    set_camera_lines(inv_view_matrix, frustum, is_perspective, geometry);
+}
+
+void compute_camera_geometry(Camera<float> const& camera, CameraGeometry* geometry)
+{
+    geometry->has_frustum = true;
+    set_camera_lines(camera.inverse_view_matrix(), camera.frustum_corners().data(), camera.projection().perspective, geometry);
+}
+
+void render_camera(cgtub::SimpleRenderer& renderer, CameraGeometry const& geometry)
+{
+    render_camera_geometry(renderer, geometry);
+}
+
+void render_camera(SoftwareRenderer& renderer, CameraGeometry const& geometry)
+{
+    render_camera_geometry(renderer, geometry);
+}
+
+void render_camera(CommandBuffer& commands, CameraGeometry const& geometry, uint64_t version)
+{
+    render_camera_geometry(commands, geometry, version, static_version);
+}
+
+void render_camera(cgtub::SimpleRenderer& renderer, glm::mat4 const& view_matrix, glm::mat4 const& projection_matrix)
+{
+    CameraGeometry geometry;
+    compute_camera_geometry(view_matrix, projection_matrix, &geometry);
+    render_camera(renderer, geometry);
 }
 
 GuiChanges gui(float* azimuth, float* fov, float* size, float* znear, float* zfar, TransformationType* transformation_type)
 {
     GuiChanges changes{0};
 
+    auto mark_changed = [&changes](GuiParameter parameter) { changes |= 1 << static_cast<unsigned int>(parameter); };
+
     ImGui::Begin("Exercise 2");
 
     if (ImGui::SliderFloat("Azimuth", azimuth, -glm::two_pi<float>(), glm::two_pi<float>()))
-        changes |= 0b000001;
+        mark_changed(GuiParameter::Azimuth);
 
     if (ImGui::Combo("Transformation", reinterpret_cast<int*>(transformation_type), "Orthographic\0Perspective\0"))
-        changes |= 0b000010;
+        mark_changed(GuiParameter::TransformationType);
 
     if (*transformation_type == TransformationType::Orthographic)
     {
         if (ImGui::SliderFloat("Size", size, .1f, 2.f))
-            changes |= 0b000100;
+            mark_changed(GuiParameter::Size);
     }
     else if (ImGui::SliderFloat("FOV", fov, 5.f, 80.f))
-        changes |= 0b001000;
+        mark_changed(GuiParameter::Fov);
 
     if (ImGui::SliderFloat("Near", znear, 0.1f, *zfar))
-        changes |= 0b010000;
+        mark_changed(GuiParameter::Near);
     if (ImGui::SliderFloat("Far", zfar, *znear, 20.f))
-        changes |= 0b100000;
+        mark_changed(GuiParameter::Far);
 
     ImGuiIO& io = ImGui::GetIO();
     ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
@@ -146,6 +228,43 @@ bool has_gui_changed_parameter(GuiChanges gui_changes, unsigned int parameter_in
     return static_cast<bool>(gui_changes & (1 << parameter_index));
 }
 
+bool has_gui_changed_parameter(GuiChanges gui_changes, GuiParameter parameter)
+{
+    return has_gui_changed_parameter(gui_changes, static_cast<unsigned int>(parameter));
+}
+
+glm::vec3 camera_position(float azimuth)
+{
+    return glm::vec3(
+        std::sin(azimuth) * std::sin(glm::quarter_pi<float>()),
+        std::cos(glm::quarter_pi<float>()),
+        std::cos(azimuth) * std::sin(glm::quarter_pi<float>()));
+}
+
+CameraParameters sweep_camera_parameters(size_t iteration, size_t iterations)
+{
+    float t = static_cast<float>(iteration) / static_cast<float>(iterations);
+
+    CameraParameters parameters;
+    parameters.azimuth             = glm::mix(-glm::two_pi<float>(), glm::two_pi<float>(), t);
+    parameters.fov                 = glm::mix(5.f, 80.f, t);
+    parameters.size                = glm::mix(.1f, 2.f, t);
+    parameters.znear               = glm::mix(0.1f, 1.f, t);
+    parameters.zfar                = glm::mix(20.f, 1.5f, t);
+    parameters.transformation_type = (iteration % 2 == 0) ? TransformationType::Orthographic : TransformationType::Perspective;
+    return parameters;
+}
+
+glm::mat4 look_at_matrix(glm::vec3 const& camera_origin)
+{
+    return camera_view(camera_origin).matrix;
+}
+
+glm::mat4 projection_matrix(CameraParameters const& parameters)
+{
+    return camera_projection(parameters).matrix;
+}
+
 void create_bunny_geometry(std::vector<glm::vec3>* positions, std::vector<glm::u32vec3>* indices)
 {
     positions->resize(bunny_positions.size());
@@ -155,4 +274,15 @@ void create_bunny_geometry(std::vector<glm::vec3>* positions, std::vector<glm::u
     std::copy(bunny_indices.begin(), bunny_indices.end(), indices->begin());
 }
 
+void create_bunny_geometry(std::span<glm::vec3 const>* positions, std::span<glm::u32vec3 const>* indices)
+{
+    *positions = bunny_positions;
+    *indices   = bunny_indices;
+}
+
+PreprocessedMeshView bunny_preprocessed()
+{
+    return bunny_data.view();
+}
+
 } // namespace ex2
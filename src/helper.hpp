@@ -5,9 +5,15 @@
 
 #include <cgtub/simple_renderer.hpp>
 
+#include "camera_math.hpp"
+#include "mesh_preprocess.hpp"
+
 namespace ex2
 {
 
+class CommandBuffer;
+class SoftwareRenderer;
+
 enum class TransformationType
 {
     Orthographic = 0,
@@ -16,6 +22,50 @@ enum class TransformationType
 
 using GuiChanges = int;
 
+/**
+ * \brief Parameters of the GUI, named by their bit index in \c GuiChanges.
+ *
+ * The bit indices follow the order in which the GUI displays the parameters.
+ */
+enum class GuiParameter : unsigned int
+{
+    Azimuth = 0,
+    TransformationType,
+    Size,
+    Fov,
+    Near,
+    Far
+};
+
+/**
+ * \brief All parameters controlled by the GUI that determine the camera.
+ */
+struct CameraParameters
+{
+    float              azimuth             = 0.f;
+    float              fov                 = 60.f;
+    float              size                = 0.8f;
+    float              znear               = 0.35f;
+    float              zfar                = 1.60f;
+    TransformationType transformation_type = TransformationType::Orthographic;
+};
+
+/**
+ * \brief Lines visualizing a camera, as rendered by \c render_camera(...).
+ *
+ * Computing the lines from bare matrices requires inverting them, so callers that render the same camera over several
+ * frames can compute them once with \c compute_camera_geometry(...) and reuse them, or compute them from a \c Camera.
+ */
+struct CameraGeometry
+{
+    glm::vec3 axes_lines[6];
+    glm::vec3 frustum_corners[8];
+    glm::vec3 frustum_lines[24];
+    glm::vec3 near_lines[8];
+    bool      has_frustum    = false;
+    bool      is_perspective = false;
+};
+
 /**
  * \brief Update the Graphical User Interface (GUI) and retrieve new values for the parameters.
  *
@@ -52,6 +102,59 @@ GuiChanges gui(float* azimuth, float* fov, float* size, float* znear, float* zfa
  */
 bool has_gui_changed_parameter(GuiChanges changes, unsigned int parameter_index);
 
+/**
+ * \brief Query if an interaction with the GUI has changed the given parameter.
+ *
+ * \param[in] changes   The \c GuiChanges returned by a call to \c gui(...)
+ * \param[in] parameter The parameter to query for changes
+ */
+bool has_gui_changed_parameter(GuiChanges changes, GuiParameter parameter);
+
+/**
+ * \brief Position of the camera orbiting the origin at the given azimuth.
+ *
+ * \param[in] azimuth The azimuth angle in radians
+ */
+glm::vec3 camera_position(float azimuth);
+
+/**
+ * \brief Camera parameters of frame \c iteration of a sweep over \c iterations frames.
+ *
+ * Each parameter covers the range of its GUI slider over the sweep, and the frames alternate between the orthographic
+ * and the perspective transformation.
+ */
+CameraParameters sweep_camera_parameters(size_t iteration, size_t iterations);
+
+/**
+ * \brief Build the view matrix of a camera at \c camera_origin looking at the world origin, with +y as up direction.
+ *
+ * \param[in] camera_origin The position of the camera in world space
+ */
+glm::mat4 look_at_matrix(glm::vec3 const& camera_origin);
+
+/**
+ * \brief Build the view matrix of \c look_at_matrix(...) together with its inverse.
+ *
+ * \param[in] camera_origin The position of the camera in world space
+ */
+template <typename T = float>
+InvertibleMatrix<T> camera_view(glm::vec<3, T> const& camera_origin);
+
+/**
+ * \brief Build the orthographic or perspective projection matrix for the given parameters.
+ *
+ * \param[in] parameters The camera parameters; \c size is only used for the orthographic and \c fov only for the perspective transformation
+ */
+glm::mat4 projection_matrix(CameraParameters const& parameters);
+
+/**
+ * \brief Build the projection matrix of \c projection_matrix(...) together with its inverse.
+ *
+ * \param[in] parameters The camera parameters; \c size is only used for the orthographic and \c fov only for the perspective transformation
+ */
+template <typename T = float>
+Projection<T> camera_projection(CameraParameters const& parameters);
+
 /**
  * \brief Render a visualization of the camera defined by a view matrix and a projection matrix.
  *
@@ -61,12 +164,91 @@ bool has_gui_changed_parameter(GuiChanges changes, unsigned int parameter_index)
  */
 void render_camera(cgtub::SimpleRenderer& renderer, glm::mat4 const& view_matrix, glm::mat4 const& projection_matrix);
 
+/**
+ * \brief Render a camera visualization computed beforehand by \c compute_camera_geometry(...).
+ *
+ * \param[in] renderer The renderer which will be used
+ * \param[in] geometry The lines of the camera visualization
+ */
+void render_camera(cgtub::SimpleRenderer& renderer, CameraGeometry const& geometry);
+
+/**
+ * \brief Render a camera visualization computed beforehand by \c compute_camera_geometry(...) on the CPU.
+ *
+ * \param[in] renderer The software renderer which will be used
+ * \param[in] geometry The lines of the camera visualization
+ */
+void render_camera(SoftwareRenderer& renderer, CameraGeometry const& geometry);
+
+/**
+ * \brief Record the draw calls of a camera visualization computed beforehand by \c compute_camera_geometry(...).
+ *
+ * \param[out] commands The command buffer the lines are recorded to
+ * \param[in]  geometry The lines of the camera visualization, which have to stay valid until the commands are replayed
+ * \param[in]  version  The version of the lines for a \c GeometryCache, see \c FrameCache::Versions
+ */
+void render_camera(CommandBuffer& commands, CameraGeometry const& geometry, uint64_t version);
+
+/**
+ * \brief Compute the lines visualizing the camera defined by a view matrix and a projection matrix.
+ *
+ * \param[in]  view_matrix       The view matrix determining the position and orientation of the camera
+ * \param[in]  projection_matrix The projection matrix of the camera
+ * \param[out] geometry          The lines of the camera visualization
+ */
+void compute_camera_geometry(glm::mat4 const& view_matrix, glm::mat4 const& projection_matrix, CameraGeometry* geometry);
+
+/**
+ * \brief Compute the lines visualizing a camera from its cached inverses and frustum corners, without inverting any matrix.
+ *
+ * \param[in]  camera   The camera
+ * \param[out] geometry The lines of the camera visualization
+ */
+void compute_camera_geometry(Camera<float> const& camera, CameraGeometry* geometry);
+
 /**
  * \brief Generates the geometry of the stanford bunny scaled to a unit bounding box, filling in vertex positions and indices.
  *
+ * The vertices and triangles are embedded in the order of \c optimize_mesh(...), so they need no optimization at runtime.
+ *
  * \param[in, out] positions A pointer to a vector of glm::vec3 that will be filled with the bunny's vertex positions.
  * \param[in, out] indices   A pointer to a vector of glm::u32vec3 that will be filled with the indices of the bunny's triangular faces.
  */
 void create_bunny_geometry(std::vector<glm::vec3>* positions, std::vector<glm::u32vec3>* indices);
 
+/**
+ * \brief Returns the geometry of the stanford bunny like \c create_bunny_geometry(...), but as views of the embedded
+ * arrays, without copying them.
+ *
+ * \param[out] positions The bunny's vertex positions
+ * \param[out] indices   The indices of the bunny's triangular faces
+ */
+void create_bunny_geometry(std::span<glm::vec3 const>* positions, std::span<glm::u32vec3 const>* indices);
+
+/**
+ * \brief The bounds and topology of the bunny returned by \c create_bunny_geometry(...), computed at compile time by
+ * \c preprocess_mesh(...).
+ */
+PreprocessedMeshView bunny_preprocessed();
+
+template <typename T>
+InvertibleMatrix<T> camera_view(glm::vec<3, T> const& camera_origin)
+{
+    return look_at(camera_origin, glm::vec<3, T>(0), glm::vec<3, T>(0, 1, 0));
+}
+
+template <typename T>
+Projection<T> camera_projection(CameraParameters const& parameters)
+{
+    T n = static_cast<T>(parameters.znear);
+    T f = static_cast<T>(parameters.zfar);
+
+    if (parameters.transformation_type == TransformationType::Orthographic)
+    {
+        T half_size = static_cast<T>(parameters.size) / T(2);
+        return orthographic(-half_size, half_size, -half_size, half_size, n, f);
+    }
+    return perspective(glm::radians(static_cast<T>(parameters.fov)), T(1), n, f);
+}
+
 } // namespace ex2
\ No newline at end of file
@@ -0,0 +1,239 @@
+#include "instancing.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <imgui.h>
+
+#include "frustum.hpp"
+#include "thread_pool.hpp"
+#include "transform_pipeline.hpp"
+
+namespace ex2
+{
+
+void generate_instance_models(InstanceSettings const& settings, std::vector<glm::mat4>* models)
+{
+    size_t count = static_cast<size_t>(std::max(settings.count, 0));
+    models->resize(count);
+    if (count == 0)
+        return;
+
+    // Each instance gets a cell of the layout and is scaled to 90% of the cell size
+    float half_extent = 0.5f * settings.extent;
+    switch (settings.layout)
+    {
+    case InstanceLayout::Grid:
+    {
+        size_t side  = static_cast<size_t>(std::ceil(std::cbrt(static_cast<double>(count))));
+        float  cell  = settings.extent / static_cast<float>(side);
+        float  scale = 0.9f * cell / normalized_mesh_extent;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            glm::vec3 index    = glm::vec3(static_cast<float>(i % side), static_cast<float>(i / (side * side)), static_cast<float>((i / side) % side));
+            glm::vec3 position = (index + 0.5f) * cell - half_extent;
+            (*models)[i]       = glm::scale(glm::translate(glm::mat4(1.f), position), glm::vec3(scale));
+        }
+        break;
+    }
+    case InstanceLayout::Spiral:
+    {
+        // Vogel's sunflower spiral places the instances with uniform density on a disc
+        float cell  = settings.extent * std::sqrt(glm::pi<float>() / static_cast<float>(count)) / 2.f;
+        float scale = 0.9f * cell / normalized_mesh_extent;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            float     radius   = (half_extent - 0.5f * cell) * std::sqrt((static_cast<float>(i) + 0.5f) / static_cast<float>(count));
+            float     angle    = static_cast<float>(i) * glm::pi<float>() * (3.f - std::sqrt(5.f));
+            glm::vec3 position = glm::vec3(radius * std::cos(angle), 0.f, radius * std::sin(angle));
+            (*models)[i]       = glm::rotate(glm::scale(glm::translate(glm::mat4(1.f), position), glm::vec3(scale)), -angle, glm::vec3(0, 1, 0));
+        }
+        break;
+    }
+    case InstanceLayout::Random:
+    {
+        // Fixed seed, so changing the count keeps the existing instances in place
+        std::mt19937                          generator(42);
+        std::uniform_real_distribution<float> unit(0.f, 1.f);
+
+        float cell  = settings.extent / std::cbrt(static_cast<float>(count));
+        float scale = 0.9f * cell / normalized_mesh_extent;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            glm::vec3 position = glm::vec3(unit(generator), unit(generator), unit(generator)) * (settings.extent - cell) - (half_extent - 0.5f * cell);
+            float     angle    = unit(generator) * glm::two_pi<float>();
+            (*models)[i]       = glm::rotate(glm::scale(glm::translate(glm::mat4(1.f), position), glm::vec3(scale)), angle, glm::vec3(0, 1, 0));
+        }
+        break;
+    }
+    }
+}
+
+bool gui_instance_settings(InstanceSettings* settings)
+{
+    bool changed = false;
+
+    ImGui::Begin("Instances");
+    changed |= ImGui::Checkbox("Instanced scene", &settings->enabled);
+    changed |= ImGui::SliderInt("Count", &settings->count, 1, 16384);
+
+    int layout = static_cast<int>(settings->layout);
+    changed |= ImGui::Combo("Layout", &layout, "Grid\0Spiral\0Random\0");
+    settings->layout = static_cast<InstanceLayout>(layout);
+
+    changed |= ImGui::SliderFloat("Extent", &settings->extent, .5f, 10.f);
+    changed |= ImGui::Checkbox("Cull instances", &settings->cull);
+    ImGui::End();
+
+    return changed;
+}
+
+void InstanceBatch::set_mesh(MeshView mesh)
+{
+    m_mesh = mesh;
+    m_indices.clear();
+
+    glm::vec3 aabb_min = glm::vec3(INFINITY);
+    glm::vec3 aabb_max = glm::vec3(-INFINITY);
+    for (glm::vec3 const& p : mesh.positions)
+    {
+        aabb_min = glm::min(aabb_min, p);
+        aabb_max = glm::max(aabb_max, p);
+    }
+
+    m_bounds_center = mesh.positions.empty() ? glm::vec3(0.f) : 0.5f * (aabb_min + aabb_max);
+    m_bounds_radius = 0.f;
+    for (glm::vec3 const& p : mesh.positions)
+        m_bounds_radius = std::max(m_bounds_radius, glm::length(p - m_bounds_center));
+}
+
+size_t InstanceBatch::max_instances(size_t vertex_count)
+{
+    static_assert(max_instanced_vertices <= UINT32_MAX, "Vertex offsets of the shared index buffer must fit into 32 bits");
+    return vertex_count > 0 ? std::max<size_t>(1, max_instanced_vertices / vertex_count) : SIZE_MAX;
+}
+
+void InstanceBatch::set_instances(std::span<glm::mat4 const> all_models)
+{
+    size_t vertex_count   = m_mesh.positions.size();
+    size_t triangle_count = m_mesh.indices.size();
+
+    std::span<glm::mat4 const> models = all_models.first(std::min(all_models.size(), max_instances(vertex_count)));
+    m_models                          = models;
+    m_stats.dropped                   = all_models.size() - models.size();
+
+    // The index buffer is shared by all outputs and only grows with the instance count
+    size_t indexed_instances = triangle_count > 0 ? m_indices.size() / triangle_count : 0;
+    if (models.size() > indexed_instances)
+    {
+        m_indices.resize(models.size() * triangle_count);
+        for (size_t i = indexed_instances; i < models.size(); i++)
+        {
+            // Below max_instanced_vertices, so the offset fits into the indices
+            glm::u32vec3 offset = glm::u32vec3(static_cast<uint32_t>(i * vertex_count));
+            for (size_t t = 0; t < triangle_count; t++)
+                m_indices[i * triangle_count + t] = m_mesh.indices[t] + offset;
+        }
+    }
+
+    m_world.resize(models.size() * vertex_count);
+    if (vertex_count == 0)
+        return;
+
+    size_t     threshold = std::max<size_t>(1, TransformPipeline::parallel_threshold / vertex_count);
+    size_t     chunk     = std::max<size_t>(1, TransformPipeline::parallel_chunk_size / vertex_count);
+    glm::vec3* world     = m_world.data();
+
+    parallel_for(models.size(), threshold, chunk, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            glm::mat4 const& model = models[i];
+            glm::vec3*       out   = world + i * vertex_count;
+            for (size_t v = 0; v < vertex_count; v++)
+                out[v] = glm::vec3(model * glm::vec4(m_mesh.positions[v], 1.0f));
+        }
+    });
+}
+
+void InstanceBatch::run(Camera<float> const& camera, bool cull)
+{
+    m_visible.clear();
+
+    Frustum          frustum           = camera.frustum();
+    glm::mat4 const& view_matrix       = camera.view_matrix();
+    glm::mat4 const& projection_matrix = camera.projection_matrix();
+    for (size_t i = 0; i < m_models.size(); i++)
+    {
+        if (cull)
+        {
+            // The bounding sphere grows with the largest scale of the model matrix
+            glm::mat4 const& model  = m_models[i];
+            glm::vec3        center = glm::vec3(model * glm::vec4(m_bounds_center, 1.0f));
+            float            scale  = std::max({glm::length(glm::vec3(model[0])), glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))});
+
+            if (!frustum_intersects_sphere(frustum, center, scale * m_bounds_radius))
+                continue;
+        }
+        m_visible.push_back(static_cast<uint32_t>(i));
+    }
+
+    m_stats.instances = m_models.size();
+    m_stats.visible   = m_visible.size();
+    m_stats.culled    = m_stats.instances - m_stats.visible;
+
+    // Compose the matrices of all visible instances up front, so the vertex loop only reads them
+    m_model_view.resize(m_visible.size());
+    m_model_view_projection.resize(m_visible.size());
+    for (size_t k = 0; k < m_visible.size(); k++)
+    {
+        m_model_view[k]            = view_matrix * m_models[m_visible[k]];
+        m_model_view_projection[k] = projection_matrix * m_model_view[k];
+    }
+
+    // Buffers only ever grow, so camera changes that change the number of visible instances do not allocate
+    size_t vertex_count = m_mesh.positions.size();
+    m_output_size       = m_visible.size() * vertex_count;
+    if (m_output_size > m_view.size())
+    {
+        m_view.resize(m_output_size);
+        m_clip.resize(m_output_size);
+        m_ndc.resize(m_output_size);
+    }
+    if (m_output_size == 0)
+        return;
+
+    size_t threshold = std::max<size_t>(1, TransformPipeline::parallel_threshold / vertex_count);
+    size_t chunk     = std::max<size_t>(1, TransformPipeline::parallel_chunk_size / vertex_count);
+
+    parallel_for(m_visible.size(), threshold, chunk, [&](size_t begin, size_t end) {
+        for (size_t k = begin; k < end; k++)
+        {
+            glm::mat4 const& model_view            = m_model_view[k];
+            glm::mat4 const& model_view_projection = m_model_view_projection[k];
+
+            size_t base = k * vertex_count;
+            for (size_t v = 0; v < vertex_count; v++)
+            {
+                glm::vec4 position = glm::vec4(m_mesh.positions[v], 1.0f);
+                glm::vec4 p        = model_view_projection * position;
+
+                m_view[base + v] = glm::vec3(model_view * position);
+                m_clip[base + v] = p;
+                m_ndc[base + v]  = (p.w != 0.0f) ? glm::vec3(p) / p.w : glm::vec3(p);
+            }
+        }
+    });
+}
+
+std::span<glm::u32vec3 const> InstanceBatch::indices(size_t instance_count) const
+{
+    return std::span(m_indices).first(std::min(m_indices.size(), instance_count * m_mesh.indices.size()));
+}
+
+} // namespace ex2
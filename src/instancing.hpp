@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "camera_math.hpp"
+#include "mesh_loader.hpp"
+
+namespace ex2
+{
+
+enum class InstanceLayout
+{
+    Grid = 0, //!< Regular 3D grid
+    Spiral,   //!< Sunflower spiral in the xz-plane
+    Random    //!< Random positions and rotations around the y-axis
+};
+
+/**
+ * \brief Parameters of the instanced scene, controlled by \c gui_instance_settings(...).
+ */
+struct InstanceSettings
+{
+    bool           enabled = false;
+    int            count   = 1000;
+    InstanceLayout layout  = InstanceLayout::Grid;
+    float          extent  = 2.f;  //!< Size of the cube (or disc) containing all instances
+    bool           cull    = true; //!< Cull instances outside the view frustum
+};
+
+/**
+ * \brief Place \c settings.count instances of a normalized mesh according to \c settings.layout.
+ *
+ * The instances are scaled down so they do not overlap and all of them fit into a cube with side length
+ * \c settings.extent centered at the origin.
+ *
+ * \param[in]  settings The instance count, layout and extent
+ * \param[out] models   The model matrices of the instances
+ */
+void generate_instance_models(InstanceSettings const& settings, std::vector<glm::mat4>* models);
+
+/**
+ * \brief Show the instancing parameters in a GUI window.
+ *
+ * \return true if a parameter was changed
+ */
+bool gui_instance_settings(InstanceSettings* settings);
+
+/**
+ * \brief Transforms many instances of one mesh, given by a contiguous array of model matrices.
+ *
+ * The outputs are flat vertex buffers that hold one copy of the mesh per instance, so instanced scenes can be passed to
+ * renderers without instancing support. The copies share one index buffer with the triangles of the first n
+ * instances, which serves both the world space output (all instances) and the camera outputs (visible instances).
+ *
+ * The world space output depends on the model matrices only and is computed by \c set_instances(...). The camera outputs
+ * are computed by \c run(...), which culls the instances against the view frustum by the bounding sphere of the mesh,
+ * composes the model-view and model-view-projection matrices of the visible instances in one batch and then transforms
+ * the mesh with them. All buffers are reused from call to call.
+ */
+class InstanceBatch
+{
+public:
+    struct Stats
+    {
+        size_t instances = 0;
+        size_t visible   = 0;
+        size_t culled    = 0;
+        size_t dropped   = 0; //!< Instances beyond \c max_instances(...), which are not drawn
+    };
+
+    /**
+     * \brief Budget of vertices over all instances.
+     *
+     * Every instanced vertex takes 52 bytes in the world, view, clip and NDC buffers, so the buffers stay below 1 GB. The
+     * budget is also below \c UINT32_MAX, so the vertex offsets of the shared index buffer cannot wrap around.
+     */
+    static constexpr size_t max_instanced_vertices = size_t(1) << 24;
+
+    /**
+     * \brief Number of instances of a mesh with \c vertex_count vertices that fit into \c max_instanced_vertices, at least one.
+     */
+    static size_t max_instances(size_t vertex_count);
+
+    /**
+     * \brief Set the shared mesh; the data must stay valid while it is in use.
+     */
+    void set_mesh(MeshView mesh);
+
+    /**
+     * \brief Set the model matrices of the instances and transform all instances to world space.
+     *
+     * Only the first \c max_instances(...) models are used, the others are counted in \c Stats::dropped. The model
+     * matrices must stay valid until the next call.
+     */
+    void set_instances(std::span<glm::mat4 const> models);
+
+    /**
+     * \brief Cull the instances and transform the visible ones to view space, clip space and NDC.
+     *
+     * \param[in] camera The camera, whose cached frustum planes are used for culling
+     * \param[in] cull   Cull instances outside the view frustum; if false all instances are visible
+     */
+    void run(Camera<float> const& camera, bool cull);
+
+    //! All instances in world space
+    MeshView world() const { return {m_world, indices(m_models.size())}; }
+
+    std::span<glm::vec3 const>    view() const { return {m_view.data(), m_output_size}; }
+    std::span<glm::vec4 const>    clip() const { return {m_clip.data(), m_output_size}; }
+    std::span<glm::vec3 const>    ndc() const { return {m_ndc.data(), m_output_size}; }
+    //! The triangles of the visible instances in \c view(), \c clip() and \c ndc()
+    std::span<glm::u32vec3 const> indices() const { return indices(m_stats.visible); }
+
+    Stats const& stats() const { return m_stats; }
+
+private:
+    std::span<glm::u32vec3 const> indices(size_t instance_count) const;
+
+    MeshView                   m_mesh;
+    glm::vec3                  m_bounds_center = glm::vec3(0.f);
+    float                      m_bounds_radius = 0.f;
+    std::span<glm::mat4 const> m_models;
+
+    std::vector<glm::vec3>    m_world;
+    std::vector<glm::u32vec3> m_indices;
+
+    std::vector<uint32_t>  m_visible;
+    std::vector<glm::mat4> m_model_view;
+    std::vector<glm::mat4> m_model_view_projection;
+    std::vector<glm::vec3> m_view;
+    std::vector<glm::vec4> m_clip;
+    std::vector<glm::vec3> m_ndc;
+    size_t                 m_output_size = 0;
+
+    Stats m_stats;
+};
+
+} // namespace ex2
@@ -0,0 +1,396 @@
+#include "lod.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+#include <glm/gtc/constants.hpp>
+
+#include "mesh_optimizer.hpp"
+
+namespace ex2
+{
+
+namespace
+{
+
+constexpr double border_weight   = 10.0; //!< Weight of the planes keeping open borders in place
+constexpr double min_flip_cosine = 0.0;  //!< Collapses turning a triangle normal by 90 degrees or more are rejected
+
+/**
+ * Symmetric 4x4 matrix of the quadric error metric, storing the upper triangle.
+ */
+struct Quadric
+{
+    double xx = 0, xy = 0, xz = 0, xw = 0, yy = 0, yz = 0, yw = 0, zz = 0, zw = 0, ww = 0;
+
+    /**
+     * The squared distance to the plane `dot(normal, p) + d = 0` times \c weight; \c normal has unit length.
+     */
+    static Quadric plane(glm::dvec3 const& normal, double d, double weight)
+    {
+        Quadric q;
+        q.xx = weight * normal.x * normal.x;
+        q.xy = weight * normal.x * normal.y;
+        q.xz = weight * normal.x * normal.z;
+        q.xw = weight * normal.x * d;
+        q.yy = weight * normal.y * normal.y;
+        q.yz = weight * normal.y * normal.z;
+        q.yw = weight * normal.y * d;
+        q.zz = weight * normal.z * normal.z;
+        q.zw = weight * normal.z * d;
+        q.ww = weight * d * d;
+        return q;
+    }
+
+    Quadric& operator+=(Quadric const& o)
+    {
+        xx += o.xx, xy += o.xy, xz += o.xz, xw += o.xw, yy += o.yy;
+        yz += o.yz, yw += o.yw, zz += o.zz, zw += o.zw, ww += o.ww;
+        return *this;
+    }
+
+    double error(glm::dvec3 const& p) const
+    {
+        return xx * p.x * p.x + 2 * xy * p.x * p.y + 2 * xz * p.x * p.z + 2 * xw * p.x +
+               yy * p.y * p.y + 2 * yz * p.y * p.z + 2 * yw * p.y +
+               zz * p.z * p.z + 2 * zw * p.z + ww;
+    }
+};
+
+Quadric operator+(Quadric a, Quadric const& b)
+{
+    return a += b;
+}
+
+/**
+ * A candidate collapse moving vertex \c from onto vertex \c to, valid as long as both vertices have the same version.
+ */
+struct Collapse
+{
+    double   error;
+    uint32_t from;
+    uint32_t to;
+    uint32_t from_version;
+    uint32_t to_version;
+
+    bool operator>(Collapse const& o) const { return error > o.error; }
+};
+
+class Simplifier
+{
+public:
+    explicit Simplifier(MeshView mesh)
+        : m_positions(mesh.positions),
+          m_triangles(mesh.indices.begin(), mesh.indices.end()),
+          m_removed(mesh.indices.size(), false),
+          m_quadrics(mesh.positions.size()),
+          m_vertex_triangles(mesh.positions.size()),
+          m_version(mesh.positions.size(), 0),
+          m_collapsed(mesh.positions.size(), false),
+          m_live_triangles(mesh.indices.size())
+    {
+        for (size_t t = 0; t < m_triangles.size(); t++)
+        {
+            glm::u32vec3 const& triangle = m_triangles[t];
+            for (int k = 0; k < 3; k++)
+                m_vertex_triangles[triangle[k]].push_back(static_cast<uint32_t>(t));
+
+            // Weighting by area keeps large triangles in place more than small ones
+            glm::dvec3 a      = position(triangle[0]);
+            glm::dvec3 normal = glm::cross(position(triangle[1]) - a, position(triangle[2]) - a);
+            double     length = glm::length(normal);
+            if (length == 0.0)
+                continue;
+
+            normal /= length;
+            Quadric q = Quadric::plane(normal, -glm::dot(normal, a), 0.5 * length);
+            for (int k = 0; k < 3; k++)
+                m_quadrics[triangle[k]] += q;
+        }
+
+        add_border_planes();
+
+        for (auto const& [a, b] : edges())
+            push(a, b);
+    }
+
+    void run(size_t target_triangles)
+    {
+        while (m_live_triangles > target_triangles && !m_queue.empty())
+        {
+            Collapse collapse = m_queue.top();
+            m_queue.pop();
+
+            if (m_collapsed[collapse.from] || m_collapsed[collapse.to] ||
+                m_version[collapse.from] != collapse.from_version || m_version[collapse.to] != collapse.to_version)
+                continue;
+
+            if (!flips(collapse.from, collapse.to))
+                apply(collapse.from, collapse.to);
+        }
+    }
+
+    void extract(Mesh* mesh) const
+    {
+        mesh->positions.assign(m_positions.begin(), m_positions.end());
+        mesh->indices.clear();
+        mesh->indices.reserve(m_live_triangles);
+        for (size_t t = 0; t < m_triangles.size(); t++)
+        {
+            if (!m_removed[t])
+                mesh->indices.push_back(m_triangles[t]);
+        }
+    }
+
+private:
+    glm::dvec3 position(uint32_t vertex) const { return glm::dvec3(m_positions[vertex]); }
+
+    std::vector<std::pair<uint32_t, uint32_t>> edges() const
+    {
+        std::vector<std::pair<uint32_t, uint32_t>> result;
+        result.reserve(3 * m_triangles.size());
+        for (glm::u32vec3 const& triangle : m_triangles)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                uint32_t a = triangle[k];
+                uint32_t b = triangle[(k + 1) % 3];
+                result.emplace_back(std::min(a, b), std::max(a, b));
+            }
+        }
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+    }
+
+    /**
+     * Edges used by a single triangle get a plane through the edge, perpendicular to the triangle.
+     */
+    void add_border_planes()
+    {
+        std::vector<std::pair<uint32_t, uint32_t>> directed;
+        directed.reserve(3 * m_triangles.size());
+        for (glm::u32vec3 const& triangle : m_triangles)
+        {
+            for (int k = 0; k < 3; k++)
+                directed.emplace_back(triangle[k], triangle[(k + 1) % 3]);
+        }
+        std::vector<std::pair<uint32_t, uint32_t>> sorted = directed;
+        std::sort(sorted.begin(), sorted.end());
+
+        for (size_t e = 0; e < directed.size(); e++)
+        {
+            auto [a, b] = directed[e];
+            if (std::binary_search(sorted.begin(), sorted.end(), std::make_pair(b, a)))
+                continue;
+
+            glm::u32vec3 const& triangle = m_triangles[e / 3];
+            glm::dvec3          pa       = position(a);
+            glm::dvec3          edge     = position(b) - pa;
+            glm::dvec3          normal   = glm::cross(position(triangle[1]) - position(triangle[0]), position(triangle[2]) - position(triangle[0]));
+            glm::dvec3          border   = glm::cross(edge, normal);
+            double              length   = glm::length(border);
+            if (length == 0.0)
+                continue;
+
+            border /= length;
+            Quadric q = Quadric::plane(border, -glm::dot(border, pa), border_weight * glm::dot(edge, edge));
+            m_quadrics[a] += q;
+            m_quadrics[b] += q;
+        }
+    }
+
+    /**
+     * Queue the cheaper direction of collapsing the edge between a and b.
+     */
+    void push(uint32_t a, uint32_t b)
+    {
+        Quadric q       = m_quadrics[a] + m_quadrics[b];
+        double  error_a = q.error(position(a));
+        double  error_b = q.error(position(b));
+
+        if (error_b <= error_a)
+            m_queue.push({error_b, a, b, m_version[a], m_version[b]});
+        else
+            m_queue.push({error_a, b, a, m_version[b], m_version[a]});
+    }
+
+    /**
+     * Check if moving \c from onto \c to flips or degenerates one of the triangles that remain.
+     */
+    bool flips(uint32_t from, uint32_t to) const
+    {
+        for (uint32_t t : m_vertex_triangles[from])
+        {
+            glm::u32vec3 const& triangle = m_triangles[t];
+            if (m_removed[t] || triangle[0] == to || triangle[1] == to || triangle[2] == to)
+                continue;
+
+            glm::dvec3 before[3];
+            glm::dvec3 after[3];
+            for (int k = 0; k < 3; k++)
+            {
+                before[k] = position(triangle[k]);
+                after[k]  = triangle[k] == from ? position(to) : before[k];
+            }
+
+            glm::dvec3 normal_before = glm::cross(before[1] - before[0], before[2] - before[0]);
+            glm::dvec3 normal_after  = glm::cross(after[1] - after[0], after[2] - after[0]);
+            double     lengths       = glm::length(normal_before) * glm::length(normal_after);
+            if (lengths == 0.0 || glm::dot(normal_before, normal_after) <= min_flip_cosine * lengths)
+                return true;
+        }
+        return false;
+    }
+
+    void apply(uint32_t from, uint32_t to)
+    {
+        for (uint32_t t : m_vertex_triangles[from])
+        {
+            if (m_removed[t])
+                continue;
+
+            glm::u32vec3& triangle = m_triangles[t];
+            if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+            {
+                m_removed[t] = true;
+                m_live_triangles--;
+                continue;
+            }
+
+            for (int k = 0; k < 3; k++)
+            {
+                if (triangle[k] == from)
+                    triangle[k] = to;
+            }
+            m_vertex_triangles[to].push_back(t);
+        }
+
+        m_collapsed[from] = true;
+        m_quadrics[to] += m_quadrics[from];
+        m_version[to]++;
+        m_vertex_triangles[from].clear();
+
+        // Requeue all edges of the merged vertex with the combined quadric; the old entries are outdated by the version
+        std::erase_if(m_vertex_triangles[to], [&](uint32_t t) { return m_removed[t]; });
+        m_neighbors.clear();
+        for (uint32_t t : m_vertex_triangles[to])
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                if (m_triangles[t][k] != to)
+                    m_neighbors.push_back(m_triangles[t][k]);
+            }
+        }
+        std::sort(m_neighbors.begin(), m_neighbors.end());
+        m_neighbors.erase(std::unique(m_neighbors.begin(), m_neighbors.end()), m_neighbors.end());
+        for (uint32_t neighbor : m_neighbors)
+            push(to, neighbor);
+    }
+
+    std::span<glm::vec3 const>         m_positions;
+    std::vector<glm::u32vec3>          m_triangles;
+    std::vector<bool>                  m_removed;
+    std::vector<Quadric>               m_quadrics;
+    std::vector<std::vector<uint32_t>> m_vertex_triangles;
+    std::vector<uint32_t>              m_version;
+    std::vector<bool>                  m_collapsed;
+    std::vector<uint32_t>              m_neighbors;
+    size_t                             m_live_triangles;
+
+    std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> m_queue;
+};
+
+} // namespace
+
+void simplify_mesh(MeshView mesh, size_t target_triangles, Mesh* simplified)
+{
+    Simplifier simplifier(mesh);
+    simplifier.run(target_triangles);
+    simplifier.extract(simplified);
+
+    optimize_vertex_cache(simplified->indices, simplified->positions.size());
+    optimize_vertex_fetch(&simplified->positions, simplified->indices);
+}
+
+void LodChain::build(MeshView mesh, std::span<float const> ratios)
+{
+    glm::vec3 lower = glm::vec3(INFINITY);
+    glm::vec3 upper = glm::vec3(-INFINITY);
+    for (glm::vec3 const& p : mesh.positions)
+    {
+        lower = glm::min(lower, p);
+        upper = glm::max(upper, p);
+    }
+    glm::vec3 center = mesh.positions.empty() ? glm::vec3(0.f) : 0.5f * (lower + upper);
+    float     radius = 0.f;
+    for (glm::vec3 const& p : mesh.positions)
+        radius = std::max(radius, glm::length(p - center));
+
+    build(mesh, center, radius, ratios);
+}
+
+void LodChain::build(MeshView mesh, glm::vec3 const& center, float radius, std::span<float const> ratios)
+{
+    m_mesh   = mesh;
+    m_center = center;
+    m_radius = radius;
+    m_levels.clear();
+
+    for (float ratio : ratios)
+    {
+        if (ratio >= 1.f)
+            continue;
+
+        size_t target = static_cast<size_t>(ratio * static_cast<float>(mesh.indices.size()));
+        Mesh   level;
+        simplify_mesh(this->level(m_levels.size()), target, &level);
+
+        // Levels that could not be simplified further add nothing
+        if (level.indices.size() >= this->level(m_levels.size()).indices.size())
+            break;
+        m_levels.push_back(std::move(level));
+    }
+}
+
+float projected_sphere_radius(glm::vec3 const& center, float radius, glm::mat4 const& view_matrix, glm::mat4 const& projection_matrix, glm::vec2 const& viewport)
+{
+    // w is the distance along the view direction for perspective and 1 for orthographic projections
+    glm::vec4 view = view_matrix * glm::vec4(center, 1.0f);
+    float     w    = glm::dot(glm::vec4(projection_matrix[0][3], projection_matrix[1][3], projection_matrix[2][3], projection_matrix[3][3]), view);
+    if (w <= radius * std::abs(projection_matrix[2][3]))
+        return INFINITY;
+
+    float scale = std::max(std::abs(projection_matrix[0][0]) * viewport.x, std::abs(projection_matrix[1][1]) * viewport.y);
+    return 0.5f * radius * scale / w;
+}
+
+size_t LodSelector::select(LodChain const& chain, float projected_radius)
+{
+    m_projected_radius = projected_radius;
+    m_level            = std::min(m_level, chain.level_count() - 1);
+    if (!m_settings.enabled)
+        return m_level = 0;
+
+    float pixels   = glm::pi<float>() * projected_radius * projected_radius;
+    float required = pixels / m_settings.pixels_per_triangle;
+
+    // The coarsest level with at least the given number of triangles, or the full mesh if no level has enough
+    auto coarsest_with = [&](float triangles) {
+        size_t level = chain.level_count() - 1;
+        while (level > 0 && static_cast<float>(chain.level(level).indices.size()) < triangles)
+            level--;
+        return level;
+    };
+
+    // Refining happens as soon as the current level is too coarse, coarsening only with a margin
+    if (static_cast<float>(chain.level(m_level).indices.size()) < required)
+        m_level = coarsest_with(required);
+    else
+        m_level = std::max(m_level, coarsest_with(required * (1.f + m_settings.hysteresis)));
+
+    return m_level;
+}
+
+} // namespace ex2
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "mesh_loader.hpp"
+
+namespace ex2
+{
+
+/**
+ * \brief Triangle ratios of the levels built by default: the full mesh, then 50%, 25% and 10% of its triangles.
+ */
+constexpr float default_lod_ratios[] = {1.f, .5f, .25f, .1f};
+
+/**
+ * \brief Simplify a mesh to at most \c target_triangles triangles with the quadric error metric of Garland and Heckbert.
+ *
+ * Edges are collapsed in the order of the error their collapse introduces, measured by the sum of the squared distances
+ * to the planes of the triangles merged into a vertex. Collapses move one vertex onto the other, so the simplified mesh
+ * only contains vertices of the input, and are rejected if they would flip a triangle. Open borders are kept in place
+ * by additional planes perpendicular to the border triangles.
+ *
+ * The result is optimized for the vertex cache and vertex fetch; it can have more triangles than requested if no
+ * further edge can be collapsed without flipping a triangle.
+ *
+ * \param[in]  mesh             The mesh to simplify
+ * \param[in]  target_triangles The triangle count to reach
+ * \param[out] simplified       The simplified mesh
+ */
+void simplify_mesh(MeshView mesh, size_t target_triangles, Mesh* simplified);
+
+/**
+ * \brief Levels of detail of a mesh, from the full mesh at level 0 to the coarsest level.
+ *
+ * Every level is simplified from the previous one. The full mesh is not copied, so it has to stay valid while the
+ * chain is in use.
+ */
+class LodChain
+{
+public:
+    /**
+     * \brief Build the levels with the given ratios of the triangle count of \c mesh.
+     *
+     * \param[in] mesh   The full mesh, used as level 0
+     * \param[in] ratios The triangle ratio of each level after level 0, in decreasing order; a first ratio of 1 is skipped
+     */
+    void build(MeshView mesh, std::span<float const> ratios = default_lod_ratios);
+
+    /**
+     * \brief Build the levels like \c build(MeshView, std::span<float const>), but with a bounding sphere of \c mesh
+     * computed beforehand, e.g. by \c preprocess_mesh(...) at compile time.
+     */
+    void build(MeshView mesh, glm::vec3 const& center, float radius, std::span<float const> ratios = default_lod_ratios);
+
+    size_t   level_count() const { return m_levels.size() + 1; }
+    MeshView level(size_t index) const { return index == 0 ? m_mesh : m_levels[index - 1].view(); }
+
+    //! Center of the bounding sphere of the full mesh
+    glm::vec3 const& center() const { return m_center; }
+    //! Radius of the bounding sphere of the full mesh
+    float            radius() const { return m_radius; }
+
+private:
+    MeshView          m_mesh;
+    std::vector<Mesh> m_levels;
+    glm::vec3         m_center = glm::vec3(0.f);
+    float             m_radius = 0.f;
+};
+
+/**
+ * \brief Radius in pixels of a sphere projected into a viewport.
+ *
+ * \param[in] center            The center of the sphere in world space
+ * \param[in] radius            The radius of the sphere
+ * \param[in] view_matrix       The view matrix of the camera
+ * \param[in] projection_matrix The orthographic or perspective projection matrix of the camera
+ * \param[in] viewport          The size of the viewport in pixels
+ *
+ * \return The projected radius, or infinity if the camera is inside the sphere
+ */
+float projected_sphere_radius(glm::vec3 const& center, float radius, glm::mat4 const& view_matrix, glm::mat4 const& projection_matrix, glm::vec2 const& viewport);
+
+/**
+ * \brief Selects the level of detail of a mesh in one viewport by its projected size.
+ *
+ * The selected level is the coarsest one with at least one triangle per \c pixels_per_triangle pixels covered by the
+ * projected bounding sphere. To avoid popping back and forth when the size is close to the boundary between two levels,
+ * a coarser level is only selected once it has \c hysteresis more triangles than required.
+ */
+class LodSelector
+{
+public:
+    struct Settings
+    {
+        bool  enabled             = true;
+        float pixels_per_triangle = 8.f;
+        float hysteresis          = .2f;
+
+        bool operator==(Settings const&) const = default;
+    };
+
+    /**
+     * \brief Select the level for the given projected radius of the bounding sphere.
+     *
+     * \return The selected level, which is kept until the next call
+     */
+    size_t select(LodChain const& chain, float projected_radius);
+
+    void            set_settings(Settings const& settings) { m_settings = settings; }
+    Settings const& settings() const { return m_settings; }
+
+    size_t level() const { return m_level; }
+    float  projected_radius() const { return m_projected_radius; }
+
+private:
+    Settings m_settings;
+    size_t   m_level            = 0;
+    float    m_projected_radius = 0.f;
+};
+
+} // namespace ex2
@@ -1,9 +1,17 @@
 #include <array>
+#include <charconv>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <memory>
 #include <queue>
 #include <span>
+#include <string>
+#include <string_view>
+#include <thread>
 
 #define GLFW_INCLUDE_NONE
 
@@ -26,10 +34,146 @@
 #include <cgtub/primitives.hpp>
 #include <cgtub/simple_renderer.hpp>
 
+#include "benchmark.hpp"
+#include "camera_batch.hpp"
+#include "command_line.hpp"
+#include "canvas_commands.hpp"
+#include "frame_cache.hpp"
+#include "frame_pipeline.hpp"
+#include "geometry_cache.hpp"
+#include "headless.hpp"
 #include "helper.hpp"
+#include "instancing.hpp"
+#include "lod.hpp"
+#include "mesh_loader.hpp"
+#include "mesh_stream.hpp"
+#include "mesh_optimizer.hpp"
+#include "meshlet.hpp"
+#include "profiler.hpp"
+#include "self_test.hpp"
+#include "session_trace.hpp"
+#include "task_graph.hpp"
+#include "thread_pool.hpp"
+
+namespace
+{
+
+/**
+ * Return the value following the command line option \c name, or nullptr if the option is not given.
+ */
+char const* find_option_value(int argc, char** argv, char const* name, int value_index = 0)
+{
+    for (int i = 1; i + 1 + value_index < argc; i++)
+    {
+        if (std::string(argv[i]) == name)
+            return argv[i + 1 + value_index];
+    }
+    return nullptr;
+}
+
+/**
+ * Print the options of the window.
+ */
+void print_usage(char const* program)
+{
+    std::cerr << "Usage: " << program << " [--mesh FILE] [--threads N] [--pipeline 2|3 [--bounded-latency]] [--record TRACE | --replay TRACE] [--timings FILE]" << std::endl;
+}
+
+/**
+ * Check if the command line option \c name without a value is given.
+ */
+bool has_option(int argc, char** argv, char const* name)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::string(argv[i]) == name)
+            return true;
+    }
+    return false;
+}
+
+} // namespace
 
 int main(int argc, char** argv)
 {
+    // The benchmark, the software renderer and the self-test run headless, so they have to be started before any window
+    // is created
+    if (ex2::benchmark_requested(argc, argv))
+        return ex2::run_benchmark(argc, argv);
+    if (ex2::headless_render_requested(argc, argv))
+        return ex2::run_headless_render(argc, argv);
+    if (ex2::self_test_requested(argc, argv))
+        return ex2::run_self_test(argc, argv);
+
+    if (char const* threads = find_option_value(argc, argv, "--threads"))
+    {
+        unsigned int worker_count = 0;
+        if (!ex2::parse_option_value("--threads", threads, 0u, ex2::max_worker_count, &worker_count))
+        {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        ex2::configure_default_thread_pool(worker_count);
+    }
+
+    // Checked here already, so invalid values are reported before a window is opened
+    unsigned int pipeline_depth = 0;
+    if (char const* depth = find_option_value(argc, argv, "--pipeline"))
+    {
+        if (!ex2::parse_option_value("--pipeline", depth, 2u, 3u, &pipeline_depth))
+        {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Convert a PLY/OBJ mesh to the native format, which is memory-mapped instead of parsed when loaded. The mesh is
+    // optimized for the vertex cache and vertex fetch on the way, since the native format is loaded as is.
+    if (char const* input = find_option_value(argc, argv, "--convert-mesh"))
+    {
+        char const* output = find_option_value(argc, argv, "--convert-mesh", 1);
+        ex2::Mesh   mesh;
+        if (!output || !ex2::load_mesh(input, &mesh))
+        {
+            std::cerr << "Usage: " << argv[0] << " --convert-mesh INPUT.(ply|obj) OUTPUT.ex2mesh" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::cout << input << ": " << ex2::optimize_mesh(&mesh.positions, mesh.indices) << std::endl;
+        if (!ex2::save_native_mesh(output, mesh.view()))
+        {
+            std::cerr << "Could not write " << output << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+
+    // A mesh given with --mesh is streamed in while rendering, otherwise the bunny is shown
+    ex2::MeshStream mesh_stream;
+    char const*     mesh_path = find_option_value(argc, argv, "--mesh");
+    if (mesh_path && !mesh_stream.open(mesh_path))
+        return EXIT_FAILURE;
+
+    // A session given with --replay drives the camera parameters at a fixed time step instead of the GUI and the
+    // program exits at its end; --record writes the session to a trace for later replay
+    char const*       record_path = find_option_value(argc, argv, "--record");
+    char const*       replay_path = find_option_value(argc, argv, "--replay");
+    ex2::SessionTrace replay;
+    if (replay_path && !ex2::load_session_trace(replay_path, &replay))
+        return EXIT_FAILURE;
+
+    ex2::CameraParameters initial_parameters = replay_path ? replay.initial_parameters : ex2::CameraParameters();
+    ex2::SessionRecorder  recorder;
+    if (record_path && !recorder.open(record_path, initial_parameters))
+        return EXIT_FAILURE;
+
+    // A replay has to see the same geometry in every frame, so it waits for the whole mesh
+    if (replay_path && mesh_path)
+    {
+        while (!mesh_stream.is_complete() && !mesh_stream.has_failed())
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
     GLFWwindow*             window     = nullptr;
     cgtub::EventDispatcher* dispatcher = nullptr;
     if (!cgtub::init(1600, 400, "CG1", &window, &dispatcher))
@@ -40,6 +184,9 @@ int main(int argc, char** argv)
     cgtub::Canvas canvas_middle_clip(window, {0.50f, 0.f, 0.248f, 1.f});
     cgtub::Canvas canvas_right(window, {0.75f, 0.f, 0.25f, 1.f});
 
+    // Part of the window covered by each of the NDC and clip space canvases, which show the projected mesh
+    glm::vec2 const projected_canvas_extent = {0.25f, 1.f};
+
     cgtub::SimpleRenderer renderer_left(canvas_left);
     cgtub::SimpleRenderer renderer_middle_view(canvas_middle_view);
     cgtub::SimpleRenderer renderer_middle_clip(canvas_middle_clip);
@@ -90,178 +237,267 @@ int main(int argc, char** argv)
     };
     glm::vec3 coordinate_axes_color[] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
 
-    std::vector<glm::vec3>    bunny_vertices;
-    std::vector<glm::u32vec3> bunny_indices;
+    // The bunny is drawn straight from the embedded arrays, which are already in the order of ex2::optimize_mesh(...)
+    // like converted meshes, so it costs no work at startup
+    std::span<glm::vec3 const>    bunny_vertices;
+    std::span<glm::u32vec3 const> bunny_indices;
     ex2::create_bunny_geometry(&bunny_vertices, &bunny_indices);
     glm::vec3 bunny_color(0.75);
 
+    ex2::MeshView mesh = mesh_path ? mesh_stream.view() : ex2::MeshView{bunny_vertices, bunny_indices};
+
     std::vector<glm::vec3>    sphere_vertices;
     std::vector<glm::u32vec3> sphere_indices;
     cgtub::create_sphere_geometry(0.03f, &sphere_vertices, &sphere_indices);
 
+    // Derived per-frame data, recomputed only when the GUI changes a parameter. The settings of the cache are collected
+    // every frame and applied before its update.
+    ex2::FrameCache    frame_cache(mesh, coordinate_axes_start_end);
+    ex2::FrameSettings frame_settings;
+    ex2::FrameSettings applied_settings;
+    frame_settings.mesh = applied_settings.mesh = mesh;
+
+    // Meshlets for culling the mesh against the view frustum and levels of detail selected by its projected size,
+    // both built once the whole mesh is available
+    ex2::MeshletMesh meshlets;
+    ex2::LodChain    lod_chain;
+    bool             mesh_processed = false;
+
+    // Instanced scene drawing the mesh many times, which replaces the single mesh when enabled
+    ex2::InstanceSettings  instance_settings;
+    std::vector<glm::mat4> instance_models;
+
+    // Sweep of cameras around the mesh, transformed in one pass over the mesh and shown as a grid in the GUI
+    ex2::CameraBatchSettings           camera_batch_settings;
+    std::vector<ex2::CameraParameters> camera_sweep;
+    ex2::CameraBatch                   camera_batch;
+    bool                               camera_batch_dirty = true;
+
+    // With --pipeline 2 or 3, the frame cache is updated on a worker thread while the previous frame is rendered, with
+    // double or triple buffering. --bounded-latency always renders the previous frame instead of the newest completed one.
+    // The pipeline is declared after all data its worker thread reads, so it is stopped first.
+    std::unique_ptr<ex2::FramePipeline> pipeline;
+    if (pipeline_depth > 0)
+    {
+        pipeline = std::make_unique<ex2::FramePipeline>(pipeline_depth, has_option(argc, argv, "--bounded-latency"), mesh, coordinate_axes_start_end);
+    }
+
+    // The draw calls of the canvases are recorded concurrently by tasks of the frame graph, which also updates the frame
+    // cache when it is not pipelined, and then replayed in canvas order on this thread, which owns the GL context.
+    // Every canvas tracks which of its geometry changed between frames and keeps the transformed camera marker.
+    ex2::CanvasScene canvas_scene;
+    canvas_scene.world_axes       = coordinate_axes_start_end;
+    canvas_scene.axes_colors      = coordinate_axes_color;
+    canvas_scene.box_lines        = box_lines;
+    canvas_scene.box_colors       = box_colors;
+    canvas_scene.marker_positions = sphere_vertices;
+    canvas_scene.marker_faces     = sphere_indices;
+    canvas_scene.mesh_color       = bunny_color;
+
+    ex2::CanvasView const            canvas_views[] = {ex2::CanvasView::World, ex2::CanvasView::View, ex2::CanvasView::Ndc, ex2::CanvasView::Clip};
+    std::array<ex2::CommandBuffer, 4> canvas_commands;
+    std::array<ex2::GeometryCache, 4> canvas_geometry;
+    ex2::TaskGraph                    frame_graph;
+
     // State
-    float                   azimuth             = 0.f;
-    float                   fov                 = 60.f;
-    float                   size                = 0.8f;
-    float                   znear               = 0.35f;
-    float                   zfar                = 1.60f;
-    ex2::TransformationType transformation_type = ex2::TransformationType::Orthographic;
+    float                   azimuth             = initial_parameters.azimuth;
+    float                   fov                 = initial_parameters.fov;
+    float                   size                = initial_parameters.size;
+    float                   znear               = initial_parameters.znear;
+    float                   zfar                = initial_parameters.zfar;
+    ex2::TransformationType transformation_type = initial_parameters.transformation_type;
 
     float time = static_cast<float>(glfwGetTime());
 
+    std::vector<ex2::FrameTiming> replay_timings;
+    replay_timings.reserve(replay.frames.size());
+
     // --- MAIN LOOP ---
-    while (!glfwWindowShouldClose(window))
+    while (!glfwWindowShouldClose(window) && (!replay_path || replay_timings.size() < replay.frames.size()))
     {
+        EX2_PROFILE_FRAME();
+        EX2_PROFILE_ZONE("Frame");
+
+        auto frame_start = std::chrono::steady_clock::now();
+
         cgtub::begin_frame(window);
 
         float now = static_cast<float>(glfwGetTime());
-        float dt  = now - time;
+        float dt  = replay_path ? replay.timestep : now - time;
         time      = now;
 
-        dispatcher->poll_window_events();
-        canvas_left.update(dt, dispatcher);
-        canvas_middle_view.update(dt, dispatcher);
-        canvas_middle_clip.update(dt, dispatcher);
-        canvas_right.update(dt, dispatcher);
-        renderer_left.update(dt, dispatcher);
-        renderer_middle_view.update(dt, dispatcher);
-        renderer_middle_clip.update(dt, dispatcher);
-
-        ex2::gui(&azimuth, &fov, &size, &znear, &zfar, &transformation_type);
-
-        //  view Matrix Calculation
-        glm::vec3 camera_origin = glm::vec3(
-            std::sin(azimuth) * std::sin(glm::quarter_pi<float>()),
-            std::cos(glm::quarter_pi<float>()),
-            std::cos(azimuth) * std::sin(glm::quarter_pi<float>()));
-
-        glm::vec3 target   = glm::vec3(0.0f);
-        glm::vec3 v_dir    = glm::normalize(target - camera_origin);
-        glm::vec3 world_up = glm::vec3(0, 1.0f, 0);
-        glm::vec3 v_right  = glm::normalize(glm::cross(v_dir, world_up));
-        glm::vec3 v_up     = glm::cross(v_right, v_dir);
-
-        glm::mat4 R(1.0f);
-        R[0] = glm::vec4(v_right.x, v_up.x, -v_dir.x, 0.0f);
-        R[1] = glm::vec4(v_right.y, v_up.y, -v_dir.y, 0.0f);
-        R[2] = glm::vec4(v_right.z, v_up.z, -v_dir.z, 0.0f);
-
-        glm::mat4 T(1.0f);
-        T[3] = glm::vec4(-camera_origin, 1.0f);
-
-        glm::mat4 LookAt_Matrix = R * T;
-
-        // Projection Matrix Calculation
-        float r = size / 2.0f;
-        float l = -size / 2.0f;
-        float t = size / 2.0f;
-        float b = -size / 2.0f;
-        float n = znear;
-        float f = zfar;
-
-        // Perspective Variables
-        float fov_rad      = glm::radians(fov);
-        float tan_half_fov = std::tan(fov_rad / 2.0f);
-        float S            = 1.0f / tan_half_fov;
-        float A            = -(f + n) / (f - n);
-        float B            = -(2.0f * f * n) / (f - n);
-
-        glm::mat4 Projection_Matrix(1.0f);
-
-        if (transformation_type == ex2::TransformationType::Orthographic)
         {
-            Projection_Matrix    = glm::mat4(1.0f);
-            Projection_Matrix[0] = glm::vec4(2 / (r - l), 0.0f, 0.0f, 0.0f);
-            Projection_Matrix[1] = glm::vec4(0.0f, 2 / (t - b), 0.0f, 0.0f);
-            Projection_Matrix[2] = glm::vec4(0.0f, 0.0f, -2 / (f - n), 0.0f);
-            Projection_Matrix[3] = glm::vec4(-(r + l) / (r - l), -(t + b) / (t - b), -(f + n) / (f - n), 1.0f);
+            EX2_PROFILE_ZONE("Poll events");
+            dispatcher->poll_window_events();
+            canvas_left.update(dt, dispatcher);
+            canvas_middle_view.update(dt, dispatcher);
+            canvas_middle_clip.update(dt, dispatcher);
+            canvas_right.update(dt, dispatcher);
+            renderer_left.update(dt, dispatcher);
+            renderer_middle_view.update(dt, dispatcher);
+            renderer_middle_clip.update(dt, dispatcher);
         }
-        else // Perspective
+
+        // Query completion before the view, so a complete stream is guaranteed to return the whole mesh
+        bool mesh_complete = !mesh_path || mesh_stream.is_complete();
+        if (mesh_path)
         {
-            Projection_Matrix[0][0] = S;     // Scale X
-            Projection_Matrix[1][1] = S;     // Scale Y
-            Projection_Matrix[2][2] = A;     // Remap Z
-            Projection_Matrix[2][3] = -1.0f; // Perspective divide preparation (w = -z)
-            Projection_Matrix[3][2] = B;     // Z Offset
-            Projection_Matrix[3][3] = 0.0f;  // w = 0
+            mesh                = mesh_stream.view();
+            frame_settings.mesh = mesh;
+        }
+        if (mesh_complete && !mesh_processed)
+        {
+            // The topology and bounding sphere of the bunny are known at compile time
+            ex2::PreprocessedMeshView const bunny = ex2::bunny_preprocessed();
+            {
+                EX2_PROFILE_ZONE("Build meshlets");
+                ex2::build_meshlets(mesh, &meshlets, mesh_path ? nullptr : &bunny.topology);
+                frame_settings.meshlets = &meshlets;
+            }
+            {
+                EX2_PROFILE_ZONE("Build LOD chain");
+                if (mesh_path)
+                    lod_chain.build(mesh);
+                else
+                    lod_chain.build(mesh, bunny.center, bunny.radius);
+                frame_settings.lod_chain = &lod_chain;
+            }
+            mesh_processed = true;
         }
 
-        cgtub::clear(window, 0.f, 0.f, 0.f, 1.f);
-
-        canvas_left.clear(glm::vec3(1.f));
-        renderer_left.render_lines(coordinate_axes_start_end, coordinate_axes_color);
-        renderer_left.render_mesh(bunny_vertices, bunny_indices, bunny_color);
-
-        std::vector<glm::vec3> cam_sphere = sphere_vertices;
-        for (auto& v : cam_sphere)
-            v += camera_origin;
-        renderer_left.render_mesh(cam_sphere, sphere_indices, glm::vec3(1, 0, 1));
-
-        ex2::render_camera(renderer_left, LookAt_Matrix, Projection_Matrix);
-
-        canvas_middle_view.clear(glm::vec3(1.f));
+        int framebuffer_width  = 0;
+        int framebuffer_height = 0;
+        glfwGetFramebufferSize(window, &framebuffer_width, &framebuffer_height);
+        frame_settings.viewport = projected_canvas_extent * glm::vec2(framebuffer_width, framebuffer_height);
 
-        std::vector<glm::vec3> bunny_view;
-        bunny_view.reserve(bunny_vertices.size());
-        for (const auto& v : bunny_vertices)
+        ex2::GuiChanges gui_changes;
         {
-            bunny_view.push_back(glm::vec3(LookAt_Matrix * glm::vec4(v, 1.0f)));
+            EX2_PROFILE_ZONE("GUI");
+            gui_changes = ex2::gui(&azimuth, &fov, &size, &znear, &zfar, &transformation_type);
+            // The GUI shows the statistics of the frame rendered last
+            if (ex2::FrameCache const* shown = pipeline ? pipeline->displayed() : &frame_cache)
+                ex2::gui_frame_cache(*shown, &frame_settings.options);
+            ex2::gui_geometry_caches(canvas_geometry);
+            if (ex2::gui_instance_settings(&instance_settings))
+            {
+                // Frames still queued in the pipeline read the instance matrices
+                if (pipeline)
+                    pipeline->wait_idle();
+
+                instance_models.clear();
+                if (instance_settings.enabled)
+                    ex2::generate_instance_models(instance_settings, &instance_models);
+                frame_settings.instances        = instance_models;
+                frame_settings.instance_culling = instance_settings.cull;
+                frame_settings.instances_version++;
+            }
+            // The grid shows the sweep transformed in the previous frame
+            camera_batch_dirty |= ex2::gui_camera_batch(&camera_batch_settings, camera_batch);
+            ex2::gui_profiler();
         }
 
-        std::vector<glm::vec3> axes_view;
-        for (const auto& v : coordinate_axes_start_end)
+        // A replayed frame overrides the GUI, so the interaction is exactly the recorded one
+        if (replay_path)
         {
-            axes_view.push_back(glm::vec3(LookAt_Matrix * glm::vec4(v, 1.0f)));
+            ex2::SessionFrame const& frame = replay.frames[replay_timings.size()];
+            azimuth                        = frame.parameters.azimuth;
+            fov                            = frame.parameters.fov;
+            size                           = frame.parameters.size;
+            znear                          = frame.parameters.znear;
+            zfar                           = frame.parameters.zfar;
+            transformation_type            = frame.parameters.transformation_type;
+            gui_changes                    = frame.changes;
         }
+        recorder.record({azimuth, fov, size, znear, zfar, transformation_type}, gui_changes);
+
+        // The update time spans the whole frame graph, which records the canvases in addition to updating the frame cache.
+        // Pipelined, handing over the frame and waiting for the worker take the place of the frame cache update.
+        auto                        update_start = std::chrono::steady_clock::now();
+        ex2::FrameCache const*      frame        = &frame_cache;
+        ex2::FrameCache::StageTasks stages;
+        frame_graph.clear();
+        if (pipeline)
+        {
+            pipeline->submit({azimuth, fov, size, znear, zfar, transformation_type}, gui_changes, frame_settings);
+            frame = &pipeline->acquire();
+        }
+        else
+        {
+            ex2::apply_frame_settings(frame_settings, &applied_settings, &frame_cache);
+            stages = frame_cache.schedule_update({azimuth, fov, size, znear, zfar, transformation_type}, gui_changes, &frame_graph);
+        }
+        for (size_t i = 0; i < canvas_commands.size(); i++)
+            ex2::schedule_canvas(canvas_views[i], *frame, stages, canvas_scene, &frame_graph, &canvas_commands[i], &canvas_geometry[i]);
 
-        renderer_middle_view.render_mesh(bunny_view, bunny_indices, bunny_color);
-        renderer_middle_view.render_lines(axes_view, coordinate_axes_color);
-        ex2::render_camera(renderer_middle_view, glm::mat4(1.0f), Projection_Matrix);
-
-        canvas_middle_clip.clear(glm::vec3(1.0f));
-
-        std::vector<glm::vec3> bunny_ndc_visual_vec3;
-        std::vector<glm::vec4> bunny_ndc_real_vec4;
-
-        bunny_ndc_visual_vec3.reserve(bunny_vertices.size());
-        bunny_ndc_real_vec4.reserve(bunny_vertices.size());
-
-        for (const auto& v : bunny_view)
+        // The sweep follows the camera of the GUI and a streamed mesh. It splits the mesh over the pool itself, so as a pool
+        // task of the first wave it runs after the other tasks of that wave and before the canvases, not concurrently.
+        if (camera_batch_settings.enabled && (camera_batch_dirty || gui_changes != 0 || camera_batch.vertex_count() != mesh.positions.size()))
+        {
+            ex2::generate_camera_sweep({azimuth, fov, size, znear, zfar, transformation_type}, camera_batch_settings, &camera_sweep);
+            camera_batch.set_cameras(camera_sweep);
+            frame_graph.add([&camera_batch, positions = mesh.positions] { camera_batch.run(positions); }, {}, true);
+            camera_batch_dirty = false;
+        }
         {
-            glm::vec4 p = Projection_Matrix * glm::vec4(v, 1.0f);
+            EX2_PROFILE_ZONE("Frame graph");
+            frame_graph.run();
+        }
+        auto update_end = std::chrono::steady_clock::now();
 
-            bunny_ndc_real_vec4.push_back(p);
+        cgtub::clear(window, 0.f, 0.f, 0.f, 1.f);
 
-            if (p.w != 0.0f)
-                bunny_ndc_visual_vec3.push_back(glm::vec3(p) / p.w);
-            else
-                bunny_ndc_visual_vec3.push_back(glm::vec3(p));
+        {
+            EX2_PROFILE_ZONE("World canvas");
+            canvas_left.clear(glm::vec3(1.f));
+            canvas_commands[0].replay(canvas_geometry[0], renderer_left);
         }
 
-        renderer_middle_clip.render_mesh(bunny_ndc_visual_vec3, bunny_indices, bunny_color);
-        renderer_middle_clip.render_lines(box_lines, box_colors);
+        {
+            EX2_PROFILE_ZONE("View canvas");
+            canvas_middle_view.clear(glm::vec3(1.f));
+            canvas_commands[1].replay(canvas_geometry[1], renderer_middle_view);
+        }
 
-        std::vector<glm::vec3> ndc_axes_visual;
-        std::vector<glm::vec4> ndc_axes_real;
+        {
+            EX2_PROFILE_ZONE("NDC canvas");
+            canvas_middle_clip.clear(glm::vec3(1.0f));
+            canvas_commands[2].replay(canvas_geometry[2], renderer_middle_clip);
+        }
 
-        for (const auto& v : axes_view)
         {
-            glm::vec4 p = Projection_Matrix * glm::vec4(v, 1.0f);
-            ndc_axes_real.push_back(p);
+            EX2_PROFILE_ZONE("Clip canvas");
+            canvas_right.clear(glm::vec3(1.0f));
+            canvas_commands[3].replay(canvas_geometry[3], renderer_right);
+        }
 
-            if (p.w != 0.0f)
-                ndc_axes_visual.push_back(glm::vec3(p) / p.w);
-            else
-                ndc_axes_visual.push_back(glm::vec3(p));
+        {
+            EX2_PROFILE_ZONE("Present");
+            cgtub::end_frame(window);
         }
-        renderer_middle_clip.render_lines(ndc_axes_visual, coordinate_axes_color);
 
-        canvas_right.clear(glm::vec3(1.0f));
+        if (replay_path)
+        {
+            auto frame_end = std::chrono::steady_clock::now();
+            replay_timings.push_back({gui_changes,
+                                      std::chrono::duration<double, std::nano>(update_end - update_start).count(),
+                                      std::chrono::duration<double, std::nano>(frame_end - frame_start).count()});
+        }
+    }
 
-        renderer_right.render_mesh(bunny_ndc_real_vec4, bunny_indices, bunny_color);
-        renderer_right.render_lines(ndc_axes_real, coordinate_axes_color);
+    if (record_path && !recorder.close())
+        std::cerr << "Failed to write the session trace " << record_path << std::endl;
 
-        cgtub::end_frame(window);
+    if (replay_path)
+    {
+        char const*   timings_path = find_option_value(argc, argv, "--timings");
+        std::ofstream timings_file;
+        if (timings_path)
+            timings_file.open(timings_path);
+        if (timings_path && !timings_file)
+            std::cerr << "Could not open " << timings_path << " for writing" << std::endl;
+        else
+            ex2::write_frame_timings(timings_path ? timings_file : std::cout, replay_timings,
+                                     pipeline ? ex2::UpdateSpan::PipelineHandoff : ex2::UpdateSpan::FrameGraph);
     }
 
     cgtub::uninit(window, dispatcher);
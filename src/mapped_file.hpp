@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+namespace ex2
+{
+
+/**
+ * \brief A read-only memory mapping of a whole file.
+ *
+ * The mapping is released when the object is destroyed or \c close() is called.
+ */
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile const&)            = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * \brief Map the file at \c path into memory, replacing any previous mapping.
+     *
+     * \return true on success, false if the file could not be opened or mapped
+     */
+    bool open(std::string const& path);
+
+    /**
+     * \brief Release the mapping.
+     */
+    void close();
+
+    /**
+     * \brief The mapped bytes; empty if no file is mapped.
+     */
+    std::span<std::byte const> data() const { return {m_data, m_size}; }
+
+private:
+    std::byte const* m_data = nullptr;
+    size_t           m_size = 0;
+#ifdef _WIN32
+    void* m_file    = nullptr;
+    void* m_mapping = nullptr;
+#endif
+};
+
+} // namespace ex2
@@ -0,0 +1,780 @@
+#include "mesh_loader.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+
+namespace ex2
+{
+
+namespace
+{
+
+static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "Native meshes store tightly packed positions");
+static_assert(sizeof(glm::u32vec3) == 3 * sizeof(uint32_t), "Native meshes store tightly packed indices");
+
+constexpr char native_magic[8] = {'E', 'X', '2', 'M', 'E', 'S', 'H', '\0'};
+constexpr uint32_t native_version = 1;
+
+/**
+ * Header of the native mesh format. All values are little-endian, positions and indices are tightly packed.
+ */
+struct NativeMeshHeader
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t vertex_count;
+    uint64_t triangle_count;
+    uint64_t positions_offset;
+    uint64_t indices_offset;
+};
+
+constexpr uint64_t align_native(uint64_t offset)
+{
+    return (offset + 15) & ~uint64_t(15);
+}
+
+bool ends_with(std::string const& str, std::string_view suffix)
+{
+    if (str.size() < suffix.size())
+        return false;
+
+    return std::equal(suffix.rbegin(), suffix.rend(), str.rbegin(), [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+    });
+}
+
+bool is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+/**
+ * Return the line starting at \c *cursor (without line break) and advance the cursor to the next line.
+ */
+std::string_view next_line(std::span<std::byte const> data, size_t* cursor)
+{
+    char const* begin = reinterpret_cast<char const*>(data.data()) + *cursor;
+    size_t      rest  = data.size() - *cursor;
+
+    char const* newline = static_cast<char const*>(std::memchr(begin, '\n', rest));
+    size_t      length  = newline ? static_cast<size_t>(newline - begin) : rest;
+
+    *cursor += newline ? length + 1 : length;
+
+    if (length > 0 && begin[length - 1] == '\r')
+        length--;
+    return {begin, length};
+}
+
+/**
+ * Split the next whitespace separated token off \c line.
+ */
+std::string_view next_token(std::string_view* line)
+{
+    size_t begin = 0;
+    while (begin < line->size() && is_space((*line)[begin]))
+        begin++;
+
+    size_t end = begin;
+    while (end < line->size() && !is_space((*line)[end]))
+        end++;
+
+    std::string_view token = line->substr(begin, end - begin);
+    line->remove_prefix(end);
+    return token;
+}
+
+template <typename T>
+bool parse_number(std::string_view token, T* value)
+{
+    if (!token.empty() && token.front() == '+')
+        token.remove_prefix(1);
+
+    auto result = std::from_chars(token.data(), token.data() + token.size(), *value);
+    return result.ec == std::errc() && result.ptr == token.data() + token.size();
+}
+
+} // namespace
+
+// --- Parser ---
+
+struct MeshParser::Cursor
+{
+    char const* p;
+    char const* end;
+    bool        ascii;
+    bool        swap;
+    bool        ok = true;
+
+    static size_t type_size(PlyType type)
+    {
+        switch (type)
+        {
+        case PlyType::Int8:
+        case PlyType::UInt8:
+            return 1;
+        case PlyType::Int16:
+        case PlyType::UInt16:
+            return 2;
+        case PlyType::Float64:
+            return 8;
+        default:
+            return 4;
+        }
+    }
+
+    template <typename T>
+    T load()
+    {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, p, sizeof(T));
+        if (swap)
+            std::reverse(bytes, bytes + sizeof(T));
+        p += sizeof(T);
+
+        T value;
+        std::memcpy(&value, bytes, sizeof(T));
+        return value;
+    }
+
+    double read(PlyType type)
+    {
+        if (!ok)
+            return 0.0;
+
+        if (ascii)
+        {
+            while (p < end && (is_space(*p) || *p == '\n'))
+                p++;
+
+            if (p < end && *p == '+')
+                p++;
+
+            double value  = 0.0;
+            auto   result = std::from_chars(p, end, value);
+            if (result.ec != std::errc())
+            {
+                ok = false;
+                return 0.0;
+            }
+            p = result.ptr;
+            return value;
+        }
+
+        if (static_cast<size_t>(end - p) < type_size(type))
+        {
+            ok = false;
+            return 0.0;
+        }
+
+        switch (type)
+        {
+        case PlyType::Int8:
+            return load<int8_t>();
+        case PlyType::UInt8:
+            return load<uint8_t>();
+        case PlyType::Int16:
+            return load<int16_t>();
+        case PlyType::UInt16:
+            return load<uint16_t>();
+        case PlyType::Int32:
+            return load<int32_t>();
+        case PlyType::UInt32:
+            return load<uint32_t>();
+        case PlyType::Float32:
+            return load<float>();
+        default:
+            return load<double>();
+        }
+    }
+
+    void skip(PlyType type, size_t count)
+    {
+        if (ascii)
+        {
+            for (size_t i = 0; i < count && ok; i++)
+                read(type);
+        }
+        else if (static_cast<size_t>(end - p) < count * type_size(type))
+            ok = false;
+        else
+            p += count * type_size(type);
+    }
+
+    void skip_line()
+    {
+        char const* newline = static_cast<char const*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+        p                   = newline ? newline + 1 : end;
+    }
+};
+
+bool MeshParser::fail(std::string message)
+{
+    m_error = std::move(message);
+    return false;
+}
+
+bool MeshParser::begin(std::span<std::byte const> data, MeshFormat format)
+{
+    *this    = MeshParser();
+    m_data   = data;
+    m_format = format;
+
+    switch (format)
+    {
+    case MeshFormat::Ply:
+        return begin_ply();
+    case MeshFormat::Obj:
+        return begin_obj();
+    default:
+        return fail("Unsupported mesh format");
+    }
+}
+
+bool MeshParser::parse_vertices(std::span<glm::vec3> positions)
+{
+    if (positions.size() != m_vertex_count)
+        return fail("Position buffer has the wrong size");
+
+    return m_format == MeshFormat::Ply ? parse_ply_vertices(positions) : parse_obj_vertices(positions);
+}
+
+size_t MeshParser::parse_triangles(std::span<glm::u32vec3> triangles)
+{
+    size_t written = 0;
+    while (written < triangles.size() && !failed())
+    {
+        // Emit the pending polygon as a fan around its first vertex
+        while (m_polygon_next + 1 < m_polygon.size() && written < triangles.size())
+        {
+            triangles[written++] = glm::u32vec3(m_polygon[0], m_polygon[m_polygon_next], m_polygon[m_polygon_next + 1]);
+            m_polygon_next++;
+        }
+
+        if (written == triangles.size())
+            break;
+
+        bool has_polygon = (m_format == MeshFormat::Ply) ? next_ply_polygon() : next_obj_polygon();
+        if (!has_polygon || !validate_polygon())
+            break;
+        m_polygon_next = 1;
+    }
+
+    return failed() ? 0 : written;
+}
+
+bool MeshParser::validate_polygon()
+{
+    for (uint32_t index : m_polygon)
+    {
+        if (index >= m_vertex_count)
+            return fail("Vertex index " + std::to_string(index) + " out of range");
+    }
+    return true;
+}
+
+// --- PLY ---
+
+bool MeshParser::begin_ply()
+{
+    auto parse_type = [](std::string_view name, PlyType* type) {
+        static constexpr std::pair<std::string_view, PlyType> types[] = {
+            {"char", PlyType::Int8}, {"int8", PlyType::Int8}, {"uchar", PlyType::UInt8}, {"uint8", PlyType::UInt8},
+            {"short", PlyType::Int16}, {"int16", PlyType::Int16}, {"ushort", PlyType::UInt16}, {"uint16", PlyType::UInt16},
+            {"int", PlyType::Int32}, {"int32", PlyType::Int32}, {"uint", PlyType::UInt32}, {"uint32", PlyType::UInt32},
+            {"float", PlyType::Float32}, {"float32", PlyType::Float32}, {"double", PlyType::Float64}, {"float64", PlyType::Float64}};
+
+        for (auto const& [type_name, value] : types)
+        {
+            if (type_name == name)
+            {
+                *type = value;
+                return true;
+            }
+        }
+        return false;
+    };
+
+    size_t cursor = 0;
+    if (next_line(m_data, &cursor) != "ply")
+        return fail("Missing PLY magic number");
+
+    bool has_format = false;
+    while (true)
+    {
+        if (cursor >= m_data.size())
+            return fail("Unexpected end of PLY header");
+
+        std::string_view line    = next_line(m_data, &cursor);
+        std::string_view keyword = next_token(&line);
+
+        if (keyword == "end_header")
+            break;
+        else if (keyword == "format")
+        {
+            std::string_view format = next_token(&line);
+            if (format == "ascii")
+                m_ply_ascii = true;
+            else if (format == "binary_little_endian" || format == "binary_big_endian")
+            {
+                bool big_endian = format == "binary_big_endian";
+                m_ply_ascii     = false;
+                m_ply_swap      = big_endian != (std::endian::native == std::endian::big);
+            }
+            else
+                return fail("Unknown PLY format " + std::string(format));
+            has_format = true;
+        }
+        else if (keyword == "element")
+        {
+            PlyElement element;
+            element.name = next_token(&line);
+            if (!parse_number(next_token(&line), &element.count))
+                return fail("Invalid PLY element count");
+            m_ply_elements.push_back(element);
+        }
+        else if (keyword == "property")
+        {
+            if (m_ply_elements.empty())
+                return fail("PLY property without element");
+
+            PlyProperty      property;
+            std::string_view type = next_token(&line);
+            if (type == "list")
+            {
+                property.is_list = true;
+                if (!parse_type(next_token(&line), &property.count_type))
+                    return fail("Unknown PLY list count type");
+                type = next_token(&line);
+            }
+            if (!parse_type(type, &property.type))
+                return fail("Unknown PLY property type " + std::string(type));
+
+            property.name = next_token(&line);
+            m_ply_elements.back().properties.push_back(property);
+        }
+        else if (keyword != "comment" && keyword != "obj_info" && !keyword.empty())
+            return fail("Unknown PLY header keyword " + std::string(keyword));
+    }
+
+    if (!has_format)
+        return fail("Missing PLY format");
+
+    size_t const none    = m_ply_elements.size();
+    m_ply_vertex_element = none;
+    m_ply_face_element   = none;
+    for (size_t e = 0; e < m_ply_elements.size(); e++)
+    {
+        PlyElement const& element = m_ply_elements[e];
+        if (element.name == "vertex")
+            m_ply_vertex_element = e;
+        else if (element.name == "face")
+        {
+            m_ply_face_element = e;
+            for (size_t p = 0; p < element.properties.size(); p++)
+            {
+                if (element.properties[p].is_list &&
+                    (element.properties[p].name == "vertex_indices" || element.properties[p].name == "vertex_index"))
+                    m_ply_index_property = p;
+            }
+        }
+    }
+
+    if (m_ply_vertex_element == none)
+        return fail("PLY file has no vertex element");
+
+    std::vector<PlyProperty> const& vertex_properties = m_ply_elements[m_ply_vertex_element].properties;
+    for (char const* name : {"x", "y", "z"})
+    {
+        if (std::none_of(vertex_properties.begin(), vertex_properties.end(), [name](PlyProperty const& p) { return p.name == name; }))
+            return fail("PLY vertices have no " + std::string(name) + " coordinate");
+    }
+    m_vertex_count = m_ply_elements[m_ply_vertex_element].count;
+
+    // Locate the records of every element up to the faces and count the triangles of the faces
+    Cursor scan{reinterpret_cast<char const*>(m_data.data()) + cursor,
+                reinterpret_cast<char const*>(m_data.data()) + m_data.size(),
+                m_ply_ascii,
+                m_ply_swap};
+
+    for (size_t e = 0; e < m_ply_elements.size() && m_ply_face_element != none; e++)
+    {
+        PlyElement& element = m_ply_elements[e];
+        element.offset      = static_cast<size_t>(scan.p - reinterpret_cast<char const*>(m_data.data()));
+
+        if (e == m_ply_face_element)
+        {
+            for (size_t r = 0; r < element.count && scan.ok; r++)
+            {
+                for (size_t p = 0; p < element.properties.size(); p++)
+                {
+                    PlyProperty const& property = element.properties[p];
+                    size_t             count    = property.is_list ? static_cast<size_t>(scan.read(property.count_type)) : 1;
+                    if (p == m_ply_index_property && count >= 3)
+                        m_triangle_count += count - 2;
+                    scan.skip(property.type, count);
+                }
+            }
+            break;
+        }
+
+        for (size_t r = 0; r < element.count && scan.ok; r++)
+        {
+            if (!skip_ply_record(scan, element))
+                break;
+        }
+    }
+
+    if (!scan.ok)
+        return fail("Unexpected end of PLY data");
+
+    if (m_ply_face_element != none)
+        m_cursor = m_ply_elements[m_ply_face_element].offset;
+
+    return true;
+}
+
+bool MeshParser::skip_ply_record(Cursor& cursor, PlyElement const& element)
+{
+    // ASCII records are stored one per line
+    if (cursor.ascii)
+    {
+        cursor.skip_line();
+        return true;
+    }
+
+    for (PlyProperty const& property : element.properties)
+    {
+        size_t count = property.is_list ? static_cast<size_t>(cursor.read(property.count_type)) : 1;
+        cursor.skip(property.type, count);
+    }
+    return cursor.ok;
+}
+
+bool MeshParser::parse_ply_vertices(std::span<glm::vec3> positions)
+{
+    PlyElement const& element = m_ply_elements[m_ply_vertex_element];
+
+    Cursor cursor{reinterpret_cast<char const*>(m_data.data()) + element.offset,
+                  reinterpret_cast<char const*>(m_data.data()) + m_data.size(),
+                  m_ply_ascii,
+                  m_ply_swap};
+
+    size_t coordinate[3] = {0, 0, 0};
+    for (size_t p = 0; p < element.properties.size(); p++)
+    {
+        std::string const& name = element.properties[p].name;
+        if (name == "x" || name == "y" || name == "z")
+            coordinate[name[0] - 'x'] = p;
+    }
+
+    for (size_t v = 0; v < element.count && cursor.ok; v++)
+    {
+        for (size_t p = 0; p < element.properties.size(); p++)
+        {
+            PlyProperty const& property = element.properties[p];
+            if (property.is_list)
+            {
+                cursor.skip(property.type, static_cast<size_t>(cursor.read(property.count_type)));
+                continue;
+            }
+
+            float value = static_cast<float>(cursor.read(property.type));
+            for (int c = 0; c < 3; c++)
+            {
+                if (coordinate[c] == p)
+                    positions[v][c] = value;
+            }
+        }
+    }
+
+    return cursor.ok ? true : fail("Unexpected end of PLY vertex data");
+}
+
+bool MeshParser::next_ply_polygon()
+{
+    if (m_ply_face_element >= m_ply_elements.size())
+        return false;
+
+    PlyElement const& element = m_ply_elements[m_ply_face_element];
+    if (m_ply_faces_read == element.count)
+        return false;
+
+    Cursor cursor{reinterpret_cast<char const*>(m_data.data()) + m_cursor,
+                  reinterpret_cast<char const*>(m_data.data()) + m_data.size(),
+                  m_ply_ascii,
+                  m_ply_swap};
+
+    for (size_t p = 0; p < element.properties.size(); p++)
+    {
+        PlyProperty const& property = element.properties[p];
+        size_t             count    = property.is_list ? static_cast<size_t>(cursor.read(property.count_type)) : 1;
+
+        if (p != m_ply_index_property)
+        {
+            cursor.skip(property.type, count);
+            continue;
+        }
+
+        m_polygon.resize(count);
+        for (size_t i = 0; i < count; i++)
+            m_polygon[i] = static_cast<uint32_t>(cursor.read(property.type));
+    }
+
+    if (!cursor.ok)
+        return fail("Unexpected end of PLY face data");
+
+    m_cursor = static_cast<size_t>(cursor.p - reinterpret_cast<char const*>(m_data.data()));
+    m_ply_faces_read++;
+    return true;
+}
+
+// --- OBJ ---
+
+bool MeshParser::begin_obj()
+{
+    size_t cursor = 0;
+    while (cursor < m_data.size())
+    {
+        std::string_view line    = next_line(m_data, &cursor);
+        std::string_view keyword = next_token(&line);
+
+        if (keyword == "v")
+            m_vertex_count++;
+        else if (keyword == "f")
+        {
+            size_t count = 0;
+            while (!next_token(&line).empty())
+                count++;
+            if (count >= 3)
+                m_triangle_count += count - 2;
+        }
+    }
+
+    return true;
+}
+
+bool MeshParser::parse_obj_vertices(std::span<glm::vec3> positions)
+{
+    size_t cursor = 0;
+    size_t v      = 0;
+    while (cursor < m_data.size())
+    {
+        std::string_view line = next_line(m_data, &cursor);
+        if (next_token(&line) != "v")
+            continue;
+
+        for (int c = 0; c < 3; c++)
+        {
+            if (!parse_number(next_token(&line), &positions[v][c]))
+                return fail("Invalid OBJ vertex " + std::to_string(v + 1));
+        }
+        v++;
+    }
+
+    return true;
+}
+
+bool MeshParser::next_obj_polygon()
+{
+    while (m_cursor < m_data.size())
+    {
+        std::string_view line    = next_line(m_data, &m_cursor);
+        std::string_view keyword = next_token(&line);
+
+        if (keyword == "v")
+        {
+            m_obj_vertices_seen++;
+            continue;
+        }
+        if (keyword != "f")
+            continue;
+
+        m_polygon.clear();
+        for (std::string_view token = next_token(&line); !token.empty(); token = next_token(&line))
+        {
+            // Only the position index of "v", "v/vt", "v//vn" and "v/vt/vn" is used
+            int64_t index = 0;
+            if (!parse_number(token.substr(0, token.find('/')), &index) || index == 0)
+            {
+                fail("Invalid OBJ face index " + std::string(token));
+                return false;
+            }
+
+            // Negative indices count backwards from the last vertex defined so far
+            int64_t absolute = index > 0 ? index - 1 : static_cast<int64_t>(m_obj_vertices_seen) + index;
+            if (absolute < 0)
+            {
+                fail("OBJ face index " + std::string(token) + " out of range");
+                return false;
+            }
+            m_polygon.push_back(static_cast<uint32_t>(absolute));
+        }
+        return true;
+    }
+
+    return false;
+}
+
+// --- Loading ---
+
+MeshFormat mesh_format_from_path(std::string const& path)
+{
+    if (ends_with(path, ".ply"))
+        return MeshFormat::Ply;
+    if (ends_with(path, ".obj"))
+        return MeshFormat::Obj;
+    if (ends_with(path, ".ex2mesh"))
+        return MeshFormat::Native;
+    return MeshFormat::Unknown;
+}
+
+void normalize_positions(std::span<glm::vec3> positions)
+{
+    if (positions.empty())
+        return;
+
+    glm::vec3 lower = positions[0];
+    glm::vec3 upper = positions[0];
+    for (glm::vec3 const& p : positions)
+    {
+        lower = glm::min(lower, p);
+        upper = glm::max(upper, p);
+    }
+
+    glm::vec3 center = 0.5f * (lower + upper);
+    glm::vec3 extent = upper - lower;
+    float     scale  = std::max({extent.x, extent.y, extent.z});
+    scale            = scale > 0.f ? normalized_mesh_extent / scale : 1.f;
+
+    for (glm::vec3& p : positions)
+    {
+        p = (p - center) * scale;
+    }
+}
+
+bool load_mesh(std::string const& path, Mesh* mesh)
+{
+    MeshFormat format = mesh_format_from_path(path);
+
+    if (format == MeshFormat::Native)
+    {
+        MappedMesh mapped;
+        if (!mapped.open(path))
+        {
+            std::cerr << "Failed to load mesh " << path << ": not a valid native mesh" << std::endl;
+            return false;
+        }
+
+        mesh->positions.assign(mapped.view().positions.begin(), mapped.view().positions.end());
+        mesh->indices.assign(mapped.view().indices.begin(), mapped.view().indices.end());
+        return true;
+    }
+
+    MappedFile file;
+    if (!file.open(path))
+    {
+        std::cerr << "Failed to load mesh " << path << ": could not open file" << std::endl;
+        return false;
+    }
+
+    MeshParser parser;
+    bool       ok = parser.begin(file.data(), format);
+    if (ok)
+    {
+        mesh->positions.resize(parser.vertex_count());
+        mesh->indices.resize(parser.triangle_count());
+
+        ok = parser.parse_vertices(mesh->positions) &&
+             parser.parse_triangles(mesh->indices) == mesh->indices.size();
+    }
+
+    if (!ok)
+    {
+        std::cerr << "Failed to load mesh " << path << ": " << (parser.failed() ? parser.error() : "truncated face data") << std::endl;
+        return false;
+    }
+
+    normalize_positions(mesh->positions);
+    return true;
+}
+
+bool save_native_mesh(std::string const& path, MeshView mesh)
+{
+    if (std::endian::native != std::endian::little)
+        return false;
+
+    NativeMeshHeader header;
+    std::memcpy(header.magic, native_magic, sizeof(native_magic));
+    header.version          = native_version;
+    header.reserved         = 0;
+    header.vertex_count     = mesh.positions.size();
+    header.triangle_count   = mesh.indices.size();
+    header.positions_offset = align_native(sizeof(NativeMeshHeader));
+    header.indices_offset   = align_native(header.positions_offset + mesh.positions.size_bytes());
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+
+    char const padding[16] = {};
+    auto       pad_to      = [&](uint64_t offset) {
+        file.write(padding, static_cast<std::streamsize>(offset - static_cast<uint64_t>(file.tellp())));
+    };
+
+    file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    pad_to(header.positions_offset);
+    file.write(reinterpret_cast<char const*>(mesh.positions.data()), static_cast<std::streamsize>(mesh.positions.size_bytes()));
+    pad_to(header.indices_offset);
+    file.write(reinterpret_cast<char const*>(mesh.indices.data()), static_cast<std::streamsize>(mesh.indices.size_bytes()));
+
+    return static_cast<bool>(file);
+}
+
+bool MappedMesh::open(std::string const& path)
+{
+    m_view = MeshView();
+
+    if (std::endian::native != std::endian::little || !m_file.open(path))
+        return false;
+
+    std::span<std::byte const> data = m_file.data();
+    if (data.size() < sizeof(NativeMeshHeader))
+        return false;
+
+    NativeMeshHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, native_magic, sizeof(native_magic)) != 0 || header.version != native_version)
+        return false;
+
+    // Compare the counts to the space after each offset instead of multiplying them, which could overflow
+    uint64_t const size = data.size();
+    if (header.positions_offset % alignof(glm::vec3) != 0 || header.indices_offset % alignof(glm::u32vec3) != 0 ||
+        header.positions_offset > size || header.vertex_count > (size - header.positions_offset) / sizeof(glm::vec3) ||
+        header.indices_offset > size || header.triangle_count > (size - header.indices_offset) / sizeof(glm::u32vec3))
+        return false;
+
+    MeshView view;
+    view.positions = {reinterpret_cast<glm::vec3 const*>(data.data() + header.positions_offset), static_cast<size_t>(header.vertex_count)};
+    view.indices   = {reinterpret_cast<glm::u32vec3 const*>(data.data() + header.indices_offset), static_cast<size_t>(header.triangle_count)};
+
+    // Like the PLY and OBJ parsers, reject out of range indices once here, so no later pass has to check them
+    for (glm::u32vec3 const& triangle : view.indices)
+    {
+        if (triangle.x >= header.vertex_count || triangle.y >= header.vertex_count || triangle.z >= header.vertex_count)
+            return false;
+    }
+
+    m_view = view;
+    return true;
+}
+
+} // namespace ex2
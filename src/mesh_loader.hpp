@@ -0,0 +1,220 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "mapped_file.hpp"
+
+namespace ex2
+{
+
+/**
+ * \brief The largest extent of a normalized mesh.
+ *
+ * This is the largest bounding box extent of the bunny returned by \c create_bunny_geometry(...), so loaded meshes
+ * appear at the same scale as the bunny.
+ */
+constexpr float normalized_mesh_extent = 0.81f;
+
+/**
+ * \brief Non-owning view of the geometry of a triangle mesh.
+ */
+struct MeshView
+{
+    std::span<glm::vec3 const>    positions;
+    std::span<glm::u32vec3 const> indices;
+};
+
+/**
+ * \brief Triangle mesh that owns its geometry.
+ */
+struct Mesh
+{
+    std::vector<glm::vec3>    positions;
+    std::vector<glm::u32vec3> indices;
+
+    MeshView view() const { return {positions, indices}; }
+};
+
+enum class MeshFormat
+{
+    Unknown = 0,
+    Ply,
+    Obj,
+    Native
+};
+
+/**
+ * \brief Determine the format of a mesh file from its extension (`.ply`, `.obj` or `.ex2mesh`).
+ */
+MeshFormat mesh_format_from_path(std::string const& path);
+
+/**
+ * \brief Center positions at the origin and scale them uniformly, so their largest extent is \c normalized_mesh_extent.
+ *
+ * This is the same normalization that the bunny returned by \c create_bunny_geometry(...) has.
+ */
+void normalize_positions(std::span<glm::vec3> positions);
+
+/**
+ * \brief Load a PLY (ASCII or binary) or OBJ mesh and normalize it.
+ *
+ * Native meshes are copied; use \c MappedMesh to access them without copying.
+ *
+ * \param[in]  path The path of the mesh file
+ * \param[out] mesh The loaded mesh
+ *
+ * \return true on success, false if the file could not be read or parsed (an error is printed to stderr)
+ */
+bool load_mesh(std::string const& path, Mesh* mesh);
+
+/**
+ * \brief Write a mesh in the native binary format, which can be memory-mapped by \c MappedMesh.
+ *
+ * The positions are written as given, normalize them beforehand if needed.
+ *
+ * \return true on success, false if the file could not be written
+ */
+bool save_native_mesh(std::string const& path, MeshView mesh);
+
+/**
+ * \brief A mesh in the native binary format, memory-mapped and used in place without copying.
+ *
+ * Opening a mesh validates the header and checks that every index is in range, which pages in the indices; the
+ * positions are paged in lazily as they are used.
+ */
+class MappedMesh
+{
+public:
+    /**
+     * \brief Map the native mesh file at \c path.
+     *
+     * \return true on success, false if the file could not be mapped or is not a valid native mesh
+     */
+    bool open(std::string const& path);
+
+    /**
+     * \brief View of the mapped geometry; valid as long as this object exists and no other file is opened.
+     */
+    MeshView view() const { return m_view; }
+
+private:
+    MappedFile m_file;
+    MeshView   m_view;
+};
+
+/**
+ * \brief Incremental parser for PLY and OBJ meshes held in memory.
+ *
+ * Parsing happens in three steps, so callers can allocate the output once and use triangles while the rest is parsed:
+ *  1. \c begin(...) reads the header and counts the vertices and triangles
+ *  2. \c parse_vertices(...) reads all vertex positions
+ *  3. \c parse_triangles(...) reads the triangles in chunks of any size
+ *
+ * Polygons with more than three vertices are triangulated as fans. Positions are not normalized.
+ */
+class MeshParser
+{
+public:
+    /**
+     * \brief Start parsing \c data, which must stay valid until parsing is done.
+     *
+     * \return true if the header could be parsed, false otherwise (see \c error())
+     */
+    bool begin(std::span<std::byte const> data, MeshFormat format);
+
+    size_t vertex_count() const { return m_vertex_count; }
+    size_t triangle_count() const { return m_triangle_count; }
+
+    /**
+     * \brief Read all vertex positions.
+     *
+     * \param[out] positions The output buffer, must hold exactly \c vertex_count() elements
+     *
+     * \return true on success, false otherwise (see \c error())
+     */
+    bool parse_vertices(std::span<glm::vec3> positions);
+
+    /**
+     * \brief Read the next triangles, up to the size of the output buffer.
+     *
+     * \param[out] triangles The output buffer
+     *
+     * \return The number of triangles written; 0 once all triangles are read or on errors (see \c error())
+     */
+    size_t parse_triangles(std::span<glm::u32vec3> triangles);
+
+    bool               failed() const { return !m_error.empty(); }
+    std::string const& error() const { return m_error; }
+
+private:
+    enum class PlyType
+    {
+        Int8,
+        UInt8,
+        Int16,
+        UInt16,
+        Int32,
+        UInt32,
+        Float32,
+        Float64
+    };
+
+    struct PlyProperty
+    {
+        std::string name;
+        PlyType     type       = PlyType::Float32;
+        bool        is_list    = false;
+        PlyType     count_type = PlyType::UInt8;
+    };
+
+    struct PlyElement
+    {
+        std::string              name;
+        size_t                   count = 0;
+        std::vector<PlyProperty> properties;
+        size_t                   offset = 0; //!< Offset of the first record in the data
+    };
+
+    struct Cursor;
+
+    bool begin_ply();
+    bool begin_obj();
+    bool parse_ply_vertices(std::span<glm::vec3> positions);
+    bool parse_obj_vertices(std::span<glm::vec3> positions);
+    bool next_ply_polygon();
+    bool next_obj_polygon();
+    bool skip_ply_record(Cursor& cursor, PlyElement const& element);
+    bool validate_polygon();
+    bool fail(std::string message);
+
+    std::span<std::byte const> m_data;
+    MeshFormat                 m_format         = MeshFormat::Unknown;
+    size_t                     m_vertex_count   = 0;
+    size_t                     m_triangle_count = 0;
+    size_t                     m_cursor         = 0; //!< Offset of the next face record/line
+    std::string                m_error;
+
+    // Pending polygon that is emitted as a triangle fan
+    std::vector<uint32_t> m_polygon;
+    size_t                m_polygon_next = 0;
+
+    // PLY
+    bool                    m_ply_ascii = true;
+    bool                    m_ply_swap  = false;
+    std::vector<PlyElement> m_ply_elements;
+    size_t                  m_ply_vertex_element = 0; //!< Index into m_ply_elements
+    size_t                  m_ply_face_element   = 0; //!< Index into m_ply_elements
+    size_t                  m_ply_index_property = 0; //!< Index of the vertex index list in the face element
+    size_t                  m_ply_faces_read     = 0;
+
+    // OBJ
+    size_t m_obj_vertices_seen = 0;
+};
+
+} // namespace ex2
@@ -0,0 +1,290 @@
+#include "mesh_optimizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace ex2
+{
+
+namespace
+{
+
+constexpr size_t   forsyth_cache_size  = 32;
+constexpr float    last_triangle_score = 0.75f; //!< Score of the vertices of the last emitted triangle
+constexpr float    cache_decay_power   = 1.5f;
+constexpr float    valence_boost_scale = 2.0f;
+constexpr float    valence_boost_power = 0.5f;
+constexpr uint32_t max_scored_valence  = 32;
+constexpr uint32_t no_triangle         = ~uint32_t(0);
+
+/**
+ * Scores of Forsyth's algorithm, tabulated by cache position and by the number of remaining triangles of a vertex.
+ */
+struct ScoreTables
+{
+    float cache[forsyth_cache_size];
+    float valence[max_scored_valence + 1];
+
+    ScoreTables()
+    {
+        for (size_t i = 0; i < forsyth_cache_size; i++)
+        {
+            // The vertices of the last triangle get a fixed score, so the next triangle does not simply reuse them
+            cache[i] = i < 3 ? last_triangle_score
+                             : std::pow(1.f - static_cast<float>(i - 3) / static_cast<float>(forsyth_cache_size - 3), cache_decay_power);
+        }
+
+        valence[0] = 0.f;
+        for (uint32_t i = 1; i <= max_scored_valence; i++)
+            valence[i] = valence_boost_scale * std::pow(static_cast<float>(i), -valence_boost_power);
+    }
+
+    float score(int cache_position, uint32_t remaining) const
+    {
+        if (remaining == 0)
+            return -1.f;
+
+        float result = cache_position >= 0 ? cache[cache_position] : 0.f;
+        return result + valence[std::min(remaining, max_scored_valence)];
+    }
+};
+
+} // namespace
+
+VertexCacheStatistics analyze_vertex_cache(std::span<glm::u32vec3 const> indices, size_t vertex_count, size_t cache_size)
+{
+    VertexCacheStatistics statistics;
+
+    // A vertex is in the FIFO cache if fewer than cache_size vertices have been inserted since it was
+    std::vector<size_t> inserted(vertex_count, 0);
+    size_t              time = cache_size + 1;
+
+    for (glm::u32vec3 const& triangle : indices)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            if (time - inserted[triangle[k]] > cache_size)
+            {
+                inserted[triangle[k]] = time++;
+                statistics.transformed_vertices++;
+            }
+        }
+    }
+
+    statistics.acmr = indices.empty() ? 0.0 : static_cast<double>(statistics.transformed_vertices) / static_cast<double>(indices.size());
+    statistics.atvr = vertex_count == 0 ? 0.0 : static_cast<double>(statistics.transformed_vertices) / static_cast<double>(vertex_count);
+    return statistics;
+}
+
+void optimize_vertex_cache(std::span<glm::u32vec3> indices, size_t vertex_count)
+{
+    size_t triangle_count = indices.size();
+    if (triangle_count == 0)
+        return;
+
+    static ScoreTables const tables;
+
+    // The triangles adjacent to each vertex, in compressed sparse row layout
+    std::vector<uint32_t> offsets(vertex_count + 1, 0);
+    std::vector<uint32_t> adjacency(3 * triangle_count);
+    for (glm::u32vec3 const& triangle : indices)
+    {
+        for (int k = 0; k < 3; k++)
+            offsets[triangle[k] + 1]++;
+    }
+    for (size_t v = 0; v < vertex_count; v++)
+        offsets[v + 1] += offsets[v];
+
+    std::vector<uint32_t> remaining(vertex_count);
+    for (size_t v = 0; v < vertex_count; v++)
+        remaining[v] = offsets[v + 1] - offsets[v];
+
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t t = 0; t < triangle_count; t++)
+    {
+        for (int k = 0; k < 3; k++)
+            adjacency[fill[indices[t][k]]++] = static_cast<uint32_t>(t);
+    }
+
+    std::vector<float> vertex_score(vertex_count);
+    for (size_t v = 0; v < vertex_count; v++)
+        vertex_score[v] = tables.score(-1, remaining[v]);
+
+    std::vector<float> triangle_score(triangle_count);
+    std::vector<bool>  emitted(triangle_count, false);
+    uint32_t           best = 0;
+    for (size_t t = 0; t < triangle_count; t++)
+    {
+        glm::u32vec3 const& triangle = indices[t];
+        triangle_score[t]            = vertex_score[triangle[0]] + vertex_score[triangle[1]] + vertex_score[triangle[2]];
+        if (triangle_score[t] > triangle_score[best])
+            best = static_cast<uint32_t>(t);
+    }
+
+    // The cache holds three extra entries for the vertices pushed out by the last triangle
+    std::vector<uint32_t>     cache;
+    std::vector<uint32_t>     next_cache;
+    std::vector<glm::u32vec3> output;
+    cache.reserve(forsyth_cache_size + 3);
+    next_cache.reserve(forsyth_cache_size + 3);
+    output.reserve(triangle_count);
+
+    size_t cursor = 0;
+    while (output.size() < triangle_count)
+    {
+        // Without a candidate in the cache, continue with the next triangle not emitted yet
+        if (best == no_triangle)
+        {
+            while (emitted[cursor])
+                cursor++;
+            best = static_cast<uint32_t>(cursor);
+        }
+
+        glm::u32vec3 const triangle = indices[best];
+        output.push_back(triangle);
+        emitted[best] = true;
+
+        next_cache.clear();
+        for (int k = 0; k < 3; k++)
+        {
+            remaining[triangle[k]]--;
+            next_cache.push_back(triangle[k]);
+        }
+        for (uint32_t v : cache)
+        {
+            if (v != triangle[0] && v != triangle[1] && v != triangle[2])
+                next_cache.push_back(v);
+        }
+        std::swap(cache, next_cache);
+
+        // Rescore the vertices in the cache, and those that fell out of it, then pick the best triangle adjacent to the cache
+        for (size_t i = 0; i < cache.size(); i++)
+        {
+            uint32_t v     = cache[i];
+            float    score = tables.score(i < forsyth_cache_size ? static_cast<int>(i) : -1, remaining[v]);
+            float    delta = score - vertex_score[v];
+
+            vertex_score[v] = score;
+            for (uint32_t j = offsets[v]; j < offsets[v + 1]; j++)
+                triangle_score[adjacency[j]] += delta;
+        }
+
+        best             = no_triangle;
+        float best_score = -1.f;
+        for (size_t i = 0; i < std::min(cache.size(), forsyth_cache_size); i++)
+        {
+            uint32_t v = cache[i];
+            for (uint32_t j = offsets[v]; j < offsets[v + 1]; j++)
+            {
+                uint32_t t = adjacency[j];
+                if (!emitted[t] && triangle_score[t] > best_score)
+                {
+                    best       = t;
+                    best_score = triangle_score[t];
+                }
+            }
+        }
+
+        if (cache.size() > forsyth_cache_size)
+            cache.resize(forsyth_cache_size);
+    }
+
+    std::copy(output.begin(), output.end(), indices.begin());
+}
+
+void optimize_vertex_fetch(std::vector<glm::vec3>* positions, std::span<glm::u32vec3> indices)
+{
+    constexpr uint32_t unused = ~uint32_t(0);
+
+    std::vector<uint32_t> remap(positions->size(), unused);
+    uint32_t              next = 0;
+    for (glm::u32vec3& triangle : indices)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            uint32_t& index = remap[triangle[k]];
+            if (index == unused)
+                index = next++;
+            triangle[k] = index;
+        }
+    }
+
+    std::vector<glm::vec3> reordered(next);
+    for (size_t v = 0; v < positions->size(); v++)
+    {
+        if (remap[v] != unused)
+            reordered[remap[v]] = (*positions)[v];
+    }
+    *positions = std::move(reordered);
+}
+
+MeshOptimizationReport optimize_mesh(std::vector<glm::vec3>* positions, std::span<glm::u32vec3> indices)
+{
+    MeshOptimizationReport report;
+    report.triangles       = indices.size();
+    report.vertices_before = positions->size();
+    report.before          = analyze_vertex_cache(indices, positions->size());
+
+    // The fetch order follows the triangle order, so the triangles have to be reordered first
+    optimize_vertex_cache(indices, positions->size());
+    optimize_vertex_fetch(positions, indices);
+
+    report.vertices_after = positions->size();
+    report.after          = analyze_vertex_cache(indices, positions->size());
+    return report;
+}
+
+std::ostream& operator<<(std::ostream& out, MeshOptimizationReport const& report)
+{
+    return out << report.triangles << " triangles, " << report.vertices_before << " -> " << report.vertices_after << " vertices"
+               << ", ACMR " << report.before.acmr << " -> " << report.after.acmr
+               << ", ATVR " << report.before.atvr << " -> " << report.after.atvr;
+}
+
+void quantize_mesh(MeshView mesh, QuantizedMesh* quantized)
+{
+    constexpr float steps = 65535.f;
+
+    glm::vec3 lower = glm::vec3(0.f);
+    glm::vec3 upper = glm::vec3(0.f);
+    if (!mesh.positions.empty())
+    {
+        lower = upper = mesh.positions[0];
+        for (glm::vec3 const& p : mesh.positions)
+        {
+            lower = glm::min(lower, p);
+            upper = glm::max(upper, p);
+        }
+    }
+
+    // Flat axes are encoded as 0 and decoded to the lower bound
+    glm::vec3 extent = upper - lower;
+    glm::vec3 encode = glm::vec3(extent.x > 0.f ? steps / extent.x : 0.f,
+                                 extent.y > 0.f ? steps / extent.y : 0.f,
+                                 extent.z > 0.f ? steps / extent.z : 0.f);
+
+    quantized->positions.resize(mesh.positions.size());
+    for (size_t i = 0; i < mesh.positions.size(); i++)
+    {
+        glm::vec3 q             = glm::clamp(glm::round((mesh.positions[i] - lower) * encode), 0.f, steps);
+        quantized->positions[i] = glm::u16vec3(q);
+    }
+    quantized->decode_matrix = glm::scale(glm::translate(glm::mat4(1.f), lower), extent / steps);
+
+    quantized->indices16.clear();
+    quantized->indices32.clear();
+    if (mesh.positions.size() <= 65536)
+    {
+        quantized->indices16.resize(mesh.indices.size());
+        for (size_t t = 0; t < mesh.indices.size(); t++)
+            quantized->indices16[t] = glm::u16vec3(mesh.indices[t]);
+    }
+    else
+    {
+        quantized->indices32.assign(mesh.indices.begin(), mesh.indices.end());
+    }
+}
+
+} // namespace ex2
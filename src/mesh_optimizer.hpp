@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "mesh_loader.hpp"
+
+namespace ex2
+{
+
+/**
+ * \brief Size of the FIFO vertex cache simulated by \c analyze_vertex_cache(...), typical for GPUs.
+ */
+constexpr size_t analysis_cache_size = 16;
+
+/**
+ * \brief Efficiency of the post-transform vertex cache for a triangle order.
+ */
+struct VertexCacheStatistics
+{
+    size_t transformed_vertices = 0; //!< Vertices that missed the cache and had to be transformed
+    double acmr                 = 0.0; //!< Average cache miss ratio: transformed vertices per triangle, 0.5 at best
+    double atvr                 = 0.0; //!< Average transformed vertex ratio: transformed vertices per vertex, 1 at best
+};
+
+/**
+ * \brief Simulate a FIFO vertex cache for the triangles in the given order.
+ *
+ * \param[in] indices      The triangles of the mesh
+ * \param[in] vertex_count The number of vertices referenced by the triangles
+ * \param[in] cache_size   The number of vertices held by the cache
+ */
+VertexCacheStatistics analyze_vertex_cache(std::span<glm::u32vec3 const> indices, size_t vertex_count, size_t cache_size = analysis_cache_size);
+
+/**
+ * \brief Reorder the triangles for the post-transform vertex cache, with the scoring of Forsyth's linear-speed algorithm.
+ *
+ * The triangles are emitted greedily by a score that prefers vertices recently used and vertices with few remaining
+ * triangles, so that vertices are finished while they are still in the cache.
+ */
+void optimize_vertex_cache(std::span<glm::u32vec3> indices, size_t vertex_count);
+
+/**
+ * \brief Renumber the vertices in the order in which the triangles first use them, so vertex fetches run linearly.
+ *
+ * Vertices not used by any triangle are removed.
+ */
+void optimize_vertex_fetch(std::vector<glm::vec3>* positions, std::span<glm::u32vec3> indices);
+
+/**
+ * \brief The vertex cache statistics of a mesh before and after \c optimize_mesh(...).
+ */
+struct MeshOptimizationReport
+{
+    size_t                triangles       = 0;
+    size_t                vertices_before = 0;
+    size_t                vertices_after  = 0;
+    VertexCacheStatistics before;
+    VertexCacheStatistics after;
+};
+
+/**
+ * \brief Optimize a mesh for the vertex cache and then for vertex fetch.
+ *
+ * Both only change the order of the triangles and vertices, so the mesh looks the same afterwards.
+ */
+MeshOptimizationReport optimize_mesh(std::vector<glm::vec3>* positions, std::span<glm::u32vec3> indices);
+
+/**
+ * \brief Write the ACMR and ATVR before and after the optimization as one line of text.
+ */
+std::ostream& operator<<(std::ostream& out, MeshOptimizationReport const& report);
+
+/**
+ * \brief A mesh with 16-bit positions and, if it has at most 65536 vertices, 16-bit indices.
+ *
+ * The positions are quantized uniformly within the bounding box of the mesh and restored by \c decode_matrix, which can
+ * be folded into the model matrix, so a 16-bit position takes half the memory of a float position.
+ */
+struct QuantizedMesh
+{
+    std::vector<glm::u16vec3> positions;
+    std::vector<glm::u16vec3> indices16; //!< The triangles if \c has_16bit_indices()
+    std::vector<glm::u32vec3> indices32; //!< The triangles otherwise
+    glm::mat4                 decode_matrix = glm::mat4(1.f);
+
+    bool has_16bit_indices() const { return !indices16.empty() || indices32.empty(); }
+};
+
+/**
+ * \brief Quantize the positions of a mesh to 16 bits per coordinate and narrow its indices if possible.
+ *
+ * The largest error of a position is half a quantization step, 1/131070 of the bounding box extent along each axis.
+ */
+void quantize_mesh(MeshView mesh, QuantizedMesh* quantized);
+
+} // namespace ex2
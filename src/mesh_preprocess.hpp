@@ -0,0 +1,268 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include <glm/glm.hpp>
+
+#include "mesh_loader.hpp"
+
+namespace ex2
+{
+
+/**
+ * \brief Arithmetic usable in constant expressions, since the glm functions and \c std::sqrt are not constexpr.
+ *
+ * Outside of constant evaluation, \c sqrt(...) falls back to \c std::sqrt, so code shared by compile-time and runtime
+ * preprocessing does not pay for the iteration at runtime.
+ */
+namespace constexpr_math
+{
+
+constexpr glm::vec3 add(glm::vec3 const& a, glm::vec3 const& b)
+{
+    return glm::vec3(a.x + b.x, a.y + b.y, a.z + b.z);
+}
+
+constexpr glm::vec3 sub(glm::vec3 const& a, glm::vec3 const& b)
+{
+    return glm::vec3(a.x - b.x, a.y - b.y, a.z - b.z);
+}
+
+constexpr glm::vec3 scale(glm::vec3 const& v, float s)
+{
+    return glm::vec3(v.x * s, v.y * s, v.z * s);
+}
+
+constexpr float dot(glm::vec3 const& a, glm::vec3 const& b)
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+constexpr glm::vec3 cross(glm::vec3 const& a, glm::vec3 const& b)
+{
+    return glm::vec3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+
+constexpr glm::vec3 min(glm::vec3 const& a, glm::vec3 const& b)
+{
+    return glm::vec3(a.x < b.x ? a.x : b.x, a.y < b.y ? a.y : b.y, a.z < b.z ? a.z : b.z);
+}
+
+constexpr glm::vec3 max(glm::vec3 const& a, glm::vec3 const& b)
+{
+    return glm::vec3(a.x > b.x ? a.x : b.x, a.y > b.y ? a.y : b.y, a.z > b.z ? a.z : b.z);
+}
+
+/**
+ * Square root by Newton's method in double precision. Starting above the root, the iterates decrease until they reach
+ * it up to rounding, so the first step that does not decrease ends the iteration.
+ */
+constexpr float sqrt(float value)
+{
+    if (!std::is_constant_evaluated())
+        return value > 0.f ? std::sqrt(value) : 0.f;
+
+    if (!(value > 0.f))
+        return 0.f;
+
+    double x = value >= 1.f ? static_cast<double>(value) : 1.0;
+    while (true)
+    {
+        double next = 0.5 * (x + static_cast<double>(value) / x);
+        if (!(next < x))
+            break;
+        x = next;
+    }
+    return static_cast<float>(x);
+}
+
+constexpr float length(glm::vec3 const& v)
+{
+    return sqrt(dot(v, v));
+}
+
+constexpr glm::vec3 normalize_or_zero(glm::vec3 const& v)
+{
+    float length_v = length(v);
+    return length_v > 0.f ? scale(v, 1.f / length_v) : glm::vec3(0.f);
+}
+
+//! Corner \c index of a triangle, without the subscript operator of glm, which is not constexpr in every configuration
+constexpr uint32_t corner(glm::u32vec3 const& triangle, int index)
+{
+    return index == 0 ? triangle.x : index == 1 ? triangle.y : triangle.z;
+}
+
+constexpr void set_corner(glm::u32vec3& triangle, int index, uint32_t value)
+{
+    (index == 0 ? triangle.x : index == 1 ? triangle.y : triangle.z) = value;
+}
+
+} // namespace constexpr_math
+
+/**
+ * \brief Non-owning view of the connectivity and face normals of a mesh, see \c compute_mesh_topology(...).
+ */
+struct MeshTopology
+{
+    //! Entry of \c face_adjacency for boundary edges and edges shared by more than two faces
+    static constexpr uint32_t no_face = ~uint32_t(0);
+
+    std::span<uint32_t const>     vertex_face_offsets; //!< The faces around vertex v are `vertex_faces[offsets[v], offsets[v + 1])`
+    std::span<uint32_t const>     vertex_faces;
+    std::span<glm::u32vec3 const> face_adjacency;      //!< For edge i of every face (from corner i to i + 1), the face across it
+    std::span<glm::vec3 const>    face_normals;        //!< Unit normal of every face, zero for degenerate faces
+};
+
+/**
+ * \brief Derive the faces around every vertex, the face across every edge and the face normals of a mesh.
+ *
+ * Adjacency is found through the faces around each vertex instead of comparing all pairs of faces, so the time grows
+ * linearly with the mesh size. This is constexpr, so it serves both \c preprocess_mesh(...) at compile time and meshes
+ * loaded at runtime.
+ *
+ * \param[in]  mesh                The mesh
+ * \param[out] vertex_face_offsets `positions.size() + 1` entries
+ * \param[out] vertex_faces        `3 * indices.size()` entries
+ * \param[out] face_adjacency      `indices.size()` entries
+ * \param[out] face_normals        `indices.size()` entries
+ */
+constexpr void compute_mesh_topology(MeshView mesh, std::span<uint32_t> vertex_face_offsets, std::span<uint32_t> vertex_faces,
+                                     std::span<glm::u32vec3> face_adjacency, std::span<glm::vec3> face_normals)
+{
+    using namespace constexpr_math;
+
+    size_t const vertex_count = mesh.positions.size();
+    size_t const face_count   = mesh.indices.size();
+
+    // Count the faces of every vertex into the entry after it, then turn the counts into offsets
+    for (uint32_t& offset : vertex_face_offsets)
+        offset = 0;
+    for (glm::u32vec3 const& face : mesh.indices)
+    {
+        for (int i = 0; i < 3; i++)
+            vertex_face_offsets[corner(face, i) + 1]++;
+    }
+    for (size_t v = 0; v < vertex_count; v++)
+        vertex_face_offsets[v + 1] += vertex_face_offsets[v];
+
+    // Filling advances each offset to the next vertex's, so shifting them back by one entry restores them
+    for (size_t f = 0; f < face_count; f++)
+    {
+        for (int i = 0; i < 3; i++)
+            vertex_faces[vertex_face_offsets[corner(mesh.indices[f], i)]++] = static_cast<uint32_t>(f);
+    }
+    for (size_t v = vertex_count; v > 0; v--)
+        vertex_face_offsets[v] = vertex_face_offsets[v - 1];
+    vertex_face_offsets[0] = 0;
+
+    // The face across edge (a, b) is the other face around a that also contains b
+    for (size_t f = 0; f < face_count; f++)
+    {
+        glm::u32vec3 const& face      = mesh.indices[f];
+        glm::u32vec3        neighbors = glm::u32vec3(MeshTopology::no_face);
+        for (int edge = 0; edge < 3; edge++)
+        {
+            uint32_t a        = corner(face, edge);
+            uint32_t b        = corner(face, (edge + 1) % 3);
+            uint32_t neighbor = MeshTopology::no_face;
+            int      found    = 0;
+            for (uint32_t i = vertex_face_offsets[a]; i < vertex_face_offsets[a + 1]; i++)
+            {
+                uint32_t            other      = vertex_faces[i];
+                glm::u32vec3 const& other_face = mesh.indices[other];
+                if (other != f && (other_face.x == b || other_face.y == b || other_face.z == b))
+                {
+                    neighbor = other;
+                    found++;
+                }
+            }
+            if (found == 1)
+                set_corner(neighbors, edge, neighbor);
+        }
+        face_adjacency[f] = neighbors;
+
+        glm::vec3 const& p = mesh.positions[face.x];
+        face_normals[f]    = normalize_or_zero(cross(sub(mesh.positions[face.y], p), sub(mesh.positions[face.z], p)));
+    }
+}
+
+/**
+ * \brief Non-owning view of the data derived from a mesh by \c preprocess_mesh(...).
+ */
+struct PreprocessedMeshView
+{
+    glm::vec3    aabb_min = glm::vec3(0.f);
+    glm::vec3    aabb_max = glm::vec3(0.f);
+    glm::vec3    center   = glm::vec3(0.f); //!< Center of the bounding sphere, the center of the bounding box
+    float        radius   = 0.f;            //!< Radius of the bounding sphere
+    MeshTopology topology;
+};
+
+/**
+ * \brief Data derived from a mesh with \c V vertices and \c F faces, computed at compile time by \c preprocess_mesh(...).
+ */
+template <size_t V, size_t F>
+struct PreprocessedMesh
+{
+    glm::vec3 aabb_min = glm::vec3(0.f);
+    glm::vec3 aabb_max = glm::vec3(0.f);
+    glm::vec3 center   = glm::vec3(0.f);
+    float     radius   = 0.f;
+
+    std::array<uint32_t, V + 1> vertex_face_offsets{};
+    std::array<uint32_t, 3 * F> vertex_faces{};
+    std::array<glm::u32vec3, F> face_adjacency{};
+    std::array<glm::vec3, F>    face_normals{};
+
+    constexpr PreprocessedMeshView view() const
+    {
+        return {aabb_min, aabb_max, center, radius, {vertex_face_offsets, vertex_faces, face_adjacency, face_normals}};
+    }
+};
+
+/**
+ * \brief Derive the bounds and the topology of an embedded mesh at compile time.
+ *
+ * The bounding sphere is centered in the bounding box, like the spheres of \c LodChain and the meshlets, so it can be
+ * passed to \c LodChain::build(...) instead of being computed at startup. The topology is that of
+ * \c compute_mesh_topology(...) and can be passed to \c build_meshlets(...). Larger meshes than the bunny may need a
+ * higher constant evaluation limit of the compiler.
+ *
+ * \param[in] positions The vertex positions
+ * \param[in] faces     The triangles, as indices into \c positions
+ */
+template <size_t V, size_t F>
+consteval PreprocessedMesh<V, F> preprocess_mesh(std::array<glm::vec3, V> const& positions, std::array<glm::u32vec3, F> const& faces)
+{
+    using namespace constexpr_math;
+
+    PreprocessedMesh<V, F> result;
+    if constexpr (V > 0)
+    {
+        result.aabb_min = positions[0];
+        result.aabb_max = positions[0];
+    }
+    for (glm::vec3 const& p : positions)
+    {
+        result.aabb_min = min(result.aabb_min, p);
+        result.aabb_max = max(result.aabb_max, p);
+    }
+    result.center = scale(add(result.aabb_min, result.aabb_max), 0.5f);
+    for (glm::vec3 const& p : positions)
+    {
+        float distance = length(sub(p, result.center));
+        result.radius  = distance > result.radius ? distance : result.radius;
+    }
+
+    compute_mesh_topology({positions, faces}, result.vertex_face_offsets, result.vertex_faces, result.face_adjacency, result.face_normals);
+
+    return result;
+}
+
+} // namespace ex2
@@ -0,0 +1,96 @@
+#include "mesh_stream.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace ex2
+{
+
+MeshStream::~MeshStream()
+{
+    m_cancel.store(true, std::memory_order_relaxed);
+    if (m_thread.joinable())
+        m_thread.join();
+}
+
+bool MeshStream::open(std::string const& path)
+{
+    if (m_thread.joinable())
+    {
+        std::cerr << "MeshStream::open may only be called once" << std::endl;
+        return false;
+    }
+
+    m_path            = path;
+    MeshFormat format = mesh_format_from_path(path);
+
+    if (format == MeshFormat::Native)
+    {
+        if (!m_native.open(path))
+        {
+            std::cerr << "Failed to load mesh " << path << ": not a valid native mesh" << std::endl;
+            m_state.store(State::Failed, std::memory_order_release);
+            return false;
+        }
+
+        m_complete_view = m_native.view();
+        m_loaded_vertices.store(m_complete_view.positions.size(), std::memory_order_relaxed);
+        m_loaded_triangles.store(m_complete_view.indices.size(), std::memory_order_relaxed);
+        m_state.store(State::Complete, std::memory_order_release);
+        return true;
+    }
+
+    if (!m_file.open(path) || !m_parser.begin(m_file.data(), format))
+    {
+        std::cerr << "Failed to load mesh " << path << ": " << (m_parser.failed() ? m_parser.error() : "could not open file") << std::endl;
+        m_state.store(State::Failed, std::memory_order_release);
+        return false;
+    }
+
+    // Allocate once, the loader thread only fills in the storage
+    m_mesh.positions.resize(m_parser.vertex_count());
+    m_mesh.indices.resize(m_parser.triangle_count());
+    m_complete_view = m_mesh.view();
+
+    m_thread = std::thread(&MeshStream::load, this);
+    return true;
+}
+
+MeshView MeshStream::view() const
+{
+    // The counts are published with release semantics after the data they cover has been written
+    size_t triangles = m_loaded_triangles.load(std::memory_order_acquire);
+    size_t vertices  = m_loaded_vertices.load(std::memory_order_acquire);
+
+    return {m_complete_view.positions.first(vertices), m_complete_view.indices.first(triangles)};
+}
+
+void MeshStream::load()
+{
+    auto fail = [this]() {
+        std::cerr << "Failed to load mesh " << m_path << ": " << (m_parser.failed() ? m_parser.error() : "truncated face data") << std::endl;
+        m_state.store(State::Failed, std::memory_order_release);
+    };
+
+    if (!m_parser.parse_vertices(m_mesh.positions))
+        return fail();
+
+    normalize_positions(m_mesh.positions);
+    m_loaded_vertices.store(m_mesh.positions.size(), std::memory_order_release);
+
+    size_t loaded = 0;
+    while (loaded < m_mesh.indices.size() && !m_cancel.load(std::memory_order_relaxed))
+    {
+        size_t chunk  = std::min(chunk_triangles, m_mesh.indices.size() - loaded);
+        size_t parsed = m_parser.parse_triangles(std::span(m_mesh.indices).subspan(loaded, chunk));
+        if (parsed == 0)
+            return fail();
+
+        loaded += parsed;
+        m_loaded_triangles.store(loaded, std::memory_order_release);
+    }
+
+    m_state.store(m_cancel.load(std::memory_order_relaxed) ? State::Failed : State::Complete, std::memory_order_release);
+}
+
+} // namespace ex2
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "mapped_file.hpp"
+#include "mesh_loader.hpp"
+
+namespace ex2
+{
+
+/**
+ * \brief Loads a mesh on a background thread, so it can be rendered while it is still being loaded.
+ *
+ * PLY and OBJ meshes are loaded in two phases: first all vertices are parsed and normalized, then the triangles are
+ * parsed in chunks. After the first phase, \c view() returns all positions and the triangles parsed so far, so the mesh
+ * fills in over the following frames. Native meshes are memory-mapped and available immediately.
+ *
+ * The storage for the mesh is allocated once from the counts in the file, so spans returned by \c view() stay valid
+ * until the stream is destroyed.
+ */
+class MeshStream
+{
+public:
+    /**
+     * \brief Triangles published at once while streaming.
+     */
+    static constexpr size_t chunk_triangles = size_t(1) << 16;
+
+    MeshStream() = default;
+    ~MeshStream();
+
+    MeshStream(MeshStream const&)            = delete;
+    MeshStream& operator=(MeshStream const&) = delete;
+
+    /**
+     * \brief Open the mesh file at \c path and start loading it.
+     *
+     * \return true if the file could be opened and its header is valid, false otherwise (an error is printed to stderr)
+     */
+    bool open(std::string const& path);
+
+    /**
+     * \brief The part of the mesh loaded so far.
+     */
+    MeshView view() const;
+
+    /**
+     * \brief Check if the whole mesh has been loaded.
+     */
+    bool is_complete() const { return m_state.load(std::memory_order_acquire) == State::Complete; }
+
+    /**
+     * \brief Check if loading has stopped because of an error.
+     */
+    bool has_failed() const { return m_state.load(std::memory_order_acquire) == State::Failed; }
+
+private:
+    enum class State
+    {
+        Loading,
+        Complete,
+        Failed
+    };
+
+    void load();
+
+    std::string m_path;
+    MappedFile  m_file;
+    MappedMesh  m_native;
+    MeshParser  m_parser;
+    Mesh        m_mesh;
+    MeshView    m_complete_view;
+
+    std::thread         m_thread;
+    std::atomic<bool>   m_cancel{false};
+    std::atomic<State>  m_state{State::Loading};
+    std::atomic<size_t> m_loaded_vertices{0};
+    std::atomic<size_t> m_loaded_triangles{0};
+};
+
+} // namespace ex2
@@ -0,0 +1,363 @@
+#include "meshlet.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+#include "thread_pool.hpp"
+
+namespace ex2
+{
+
+namespace
+{
+
+constexpr uint8_t no_slot         = 0xFF;
+constexpr size_t  bvh_leaf_size   = 4;
+constexpr size_t  bvh_max_depth   = 64;
+constexpr float   cone_min_cosine = 0.1f; //!< Cones wider than acos(0.1) are not worth testing
+
+/**
+ * The topology of a mesh derived at runtime, for meshes without a precomputed one.
+ */
+struct TopologyBuffers
+{
+    std::vector<uint32_t>     vertex_face_offsets;
+    std::vector<uint32_t>     vertex_faces;
+    std::vector<glm::u32vec3> face_adjacency;
+    std::vector<glm::vec3>    face_normals;
+
+    explicit TopologyBuffers(MeshView mesh)
+        : vertex_face_offsets(mesh.positions.size() + 1),
+          vertex_faces(3 * mesh.indices.size()),
+          face_adjacency(mesh.indices.size()),
+          face_normals(mesh.indices.size())
+    {
+        compute_mesh_topology(mesh, vertex_face_offsets, vertex_faces, face_adjacency, face_normals);
+    }
+
+    MeshTopology view() const { return {vertex_face_offsets, vertex_faces, face_adjacency, face_normals}; }
+};
+
+std::span<uint32_t const> faces_around(MeshTopology const& topology, uint32_t vertex)
+{
+    return topology.vertex_faces.subspan(topology.vertex_face_offsets[vertex],
+                                         topology.vertex_face_offsets[vertex + 1] - topology.vertex_face_offsets[vertex]);
+}
+
+void compute_meshlet_bounds(MeshView mesh, MeshletMesh const& meshlets, std::span<glm::vec3 const> face_normals,
+                            std::span<uint32_t const> faces, Meshlet* meshlet)
+{
+    std::span<uint32_t const> vertices = std::span(meshlets.vertices).subspan(meshlet->vertex_offset, meshlet->vertex_count);
+
+    meshlet->aabb_min = glm::vec3(INFINITY);
+    meshlet->aabb_max = glm::vec3(-INFINITY);
+    for (uint32_t v : vertices)
+    {
+        meshlet->aabb_min = glm::min(meshlet->aabb_min, mesh.positions[v]);
+        meshlet->aabb_max = glm::max(meshlet->aabb_max, mesh.positions[v]);
+    }
+
+    meshlet->center = 0.5f * (meshlet->aabb_min + meshlet->aabb_max);
+    meshlet->radius = 0.f;
+    for (uint32_t v : vertices)
+        meshlet->radius = std::max(meshlet->radius, glm::length(mesh.positions[v] - meshlet->center));
+
+    // The cone axis is the average normal, the cone angle is the largest angle between the axis and a normal. Degenerate
+    // faces have a zero normal, which neither moves the axis nor narrows the cone.
+    glm::vec3 normal_sum = glm::vec3(0.f);
+    for (uint32_t f : faces)
+        normal_sum += face_normals[f];
+
+    meshlet->cone_axis   = glm::vec3(0.f);
+    meshlet->cone_cutoff = 1.f;
+
+    float sum_length = glm::length(normal_sum);
+    if (sum_length == 0.f)
+        return;
+
+    glm::vec3 axis       = normal_sum / sum_length;
+    float     min_cosine = 1.f;
+    for (uint32_t f : faces)
+    {
+        if (face_normals[f] != glm::vec3(0.f))
+            min_cosine = std::min(min_cosine, glm::dot(axis, face_normals[f]));
+    }
+
+    if (min_cosine <= cone_min_cosine)
+        return;
+
+    meshlet->cone_axis   = axis;
+    meshlet->cone_cutoff = std::sqrt(1.f - min_cosine * min_cosine);
+}
+
+/**
+ * Build the subtree of \c node over the meshlets `[first, first + count)` by recursive median splits, reordering them.
+ */
+void build_bvh_node(std::vector<Meshlet>& meshlets, std::vector<MeshletBvhNode>& nodes, size_t node, uint32_t first, uint32_t count)
+{
+    glm::vec3 aabb_min    = glm::vec3(INFINITY);
+    glm::vec3 aabb_max    = glm::vec3(-INFINITY);
+    glm::vec3 centers_min = glm::vec3(INFINITY);
+    glm::vec3 centers_max = glm::vec3(-INFINITY);
+    for (uint32_t m = first; m < first + count; m++)
+    {
+        aabb_min    = glm::min(aabb_min, meshlets[m].aabb_min);
+        aabb_max    = glm::max(aabb_max, meshlets[m].aabb_max);
+        centers_min = glm::min(centers_min, meshlets[m].center);
+        centers_max = glm::max(centers_max, meshlets[m].center);
+    }
+
+    nodes[node].aabb_min = aabb_min;
+    nodes[node].aabb_max = aabb_max;
+
+    if (count <= bvh_leaf_size)
+    {
+        nodes[node].first = first;
+        nodes[node].count = count;
+        return;
+    }
+
+    glm::vec3 extent = centers_max - centers_min;
+    int       axis   = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : (extent.y >= extent.z ? 1 : 2);
+
+    uint32_t middle = first + count / 2;
+    std::nth_element(meshlets.begin() + first, meshlets.begin() + middle, meshlets.begin() + first + count,
+                     [axis](Meshlet const& a, Meshlet const& b) { return a.center[axis] < b.center[axis]; });
+
+    uint32_t children = static_cast<uint32_t>(nodes.size());
+    nodes.resize(nodes.size() + 2);
+    nodes[node].first = children;
+    nodes[node].count = 0;
+
+    build_bvh_node(meshlets, nodes, children, first, middle - first);
+    build_bvh_node(meshlets, nodes, children + 1, middle, first + count - middle);
+}
+
+/**
+ * Whether all triangles of a meshlet face away from the camera, see \c Meshlet::cone_axis.
+ */
+bool is_backfacing(Meshlet const& meshlet, glm::vec3 const& eye, glm::vec3 const& forward, bool perspective)
+{
+    if (perspective)
+    {
+        glm::vec3 direction = meshlet.center - eye;
+        return glm::dot(direction, meshlet.cone_axis) >= meshlet.cone_cutoff * glm::length(direction) + meshlet.radius;
+    }
+    return glm::dot(forward, meshlet.cone_axis) >= meshlet.cone_cutoff;
+}
+
+} // namespace
+
+void build_meshlets(MeshView mesh, MeshletMesh* meshlets, MeshTopology const* topology)
+{
+    meshlets->meshlets.clear();
+    meshlets->vertices.clear();
+    meshlets->triangles.clear();
+    meshlets->nodes.clear();
+
+    if (mesh.indices.empty())
+        return;
+
+    // Meshes without a precomputed topology have theirs derived here
+    std::optional<TopologyBuffers> derived;
+    MeshTopology const             mesh_topology = topology ? *topology : derived.emplace(mesh).view();
+
+    std::vector<uint8_t>  emitted(mesh.indices.size(), 0);
+    std::vector<uint8_t>  slots(mesh.positions.size(), no_slot); //!< Meshlet-local index of each vertex
+    std::vector<uint32_t> meshlet_faces;                          //!< Mesh face indices of the current meshlet
+    size_t                seed = 0;
+
+    Meshlet meshlet;
+
+    auto new_vertex_count = [&](glm::u32vec3 const& triangle) {
+        return (slots[triangle[0]] == no_slot) + (slots[triangle[1]] == no_slot) + (slots[triangle[2]] == no_slot);
+    };
+
+    // Whether the triangle is unemitted, fits into the meshlet and adds fewer vertices than the best candidate so far
+    auto is_better_candidate = [&](uint32_t t, int* best) {
+        if (t == MeshTopology::no_face || emitted[t])
+            return false;
+
+        int added = new_vertex_count(mesh.indices[t]);
+        if (added >= *best || meshlet.vertex_count + added > meshlet_max_vertices)
+            return false;
+
+        *best = added;
+        return true;
+    };
+
+    // An unemitted triangle across an edge of the given triangle whose third vertex is already in the meshlet, which
+    // closes a gap in the meshlet and so keeps its outline short
+    auto find_edge_neighbor = [&](uint32_t triangle, uint32_t* candidate) {
+        glm::u32vec3 const& neighbors = mesh_topology.face_adjacency[triangle];
+        for (int k = 0; k < 3; k++)
+        {
+            int best = 1;
+            if (is_better_candidate(neighbors[k], &best))
+            {
+                *candidate = neighbors[k];
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // The unemitted triangle adjacent to the given vertices that adds the fewest vertices to the meshlet
+    auto find_candidate = [&](std::span<uint32_t const> vertices, uint32_t* candidate) {
+        int best = 4;
+        for (uint32_t v : vertices)
+        {
+            for (uint32_t t : faces_around(mesh_topology, v))
+            {
+                if (is_better_candidate(t, &best))
+                {
+                    *candidate = t;
+                    if (best == 0)
+                        return true;
+                }
+            }
+        }
+        return best < 4;
+    };
+
+    while (true)
+    {
+        while (seed < mesh.indices.size() && emitted[seed])
+            seed++;
+        if (seed == mesh.indices.size())
+            break;
+
+        meshlet                 = Meshlet();
+        meshlet.vertex_offset   = static_cast<uint32_t>(meshlets->vertices.size());
+        meshlet.triangle_offset = static_cast<uint32_t>(meshlets->triangles.size());
+        meshlet_faces.clear();
+
+        uint32_t triangle = static_cast<uint32_t>(seed);
+        while (true)
+        {
+            glm::u32vec3 const& indices = mesh.indices[triangle];
+            glm::u8vec3         local;
+            for (int k = 0; k < 3; k++)
+            {
+                if (slots[indices[k]] == no_slot)
+                {
+                    slots[indices[k]] = static_cast<uint8_t>(meshlet.vertex_count++);
+                    meshlets->vertices.push_back(indices[k]);
+                }
+                local[k] = slots[indices[k]];
+            }
+            meshlets->triangles.push_back(local);
+            meshlet.triangle_count++;
+            meshlet_faces.push_back(triangle);
+            emitted[triangle] = 1;
+
+            if (meshlet.triangle_count == meshlet_max_triangles)
+                break;
+
+            // Prefer neighbors of the last triangle, first across its edges, which keeps the meshlet compact, then neighbors
+            // of the whole meshlet
+            uint32_t const            last_vertices[3] = {indices.x, indices.y, indices.z};
+            std::span<uint32_t const> meshlet_vertices = std::span(meshlets->vertices).subspan(meshlet.vertex_offset);
+            if (!find_edge_neighbor(triangle, &triangle) && !find_candidate(last_vertices, &triangle) &&
+                !find_candidate(meshlet_vertices, &triangle))
+                break;
+        }
+
+        compute_meshlet_bounds(mesh, *meshlets, mesh_topology.face_normals, meshlet_faces, &meshlet);
+        for (uint32_t v : std::span(meshlets->vertices).subspan(meshlet.vertex_offset))
+            slots[v] = no_slot;
+
+        meshlets->meshlets.push_back(meshlet);
+    }
+
+    meshlets->nodes.resize(1);
+    build_bvh_node(meshlets->meshlets, meshlets->nodes, 0, 0, static_cast<uint32_t>(meshlets->meshlets.size()));
+}
+
+void MeshletCuller::run(MeshletMesh const& meshlets, std::span<glm::vec3 const> positions, Camera<float> const& camera, bool cull_back_faces)
+{
+    m_stats = Stats();
+    m_visible.clear();
+
+    if (!meshlets.nodes.empty())
+    {
+        Frustum   frustum     = camera.frustum();
+        glm::vec3 eye         = camera.position();
+        glm::vec3 forward     = camera.forward();
+        bool      perspective = camera.projection().perspective;
+
+        struct Entry
+        {
+            uint32_t node;
+            uint32_t plane_mask;
+        };
+        Entry  stack[bvh_max_depth];
+        size_t stack_size = 0;
+        stack[stack_size++] = {0, Frustum::all_planes};
+
+        while (stack_size > 0)
+        {
+            Entry entry = stack[--stack_size];
+            m_stats.visited_nodes++;
+
+            MeshletBvhNode const& node = meshlets.nodes[entry.node];
+            if (entry.plane_mask != 0 && !frustum_intersects_aabb(frustum, node.aabb_min, node.aabb_max, &entry.plane_mask))
+                continue;
+
+            if (node.count == 0)
+            {
+                stack[stack_size++] = {node.first + 1, entry.plane_mask};
+                stack[stack_size++] = {node.first, entry.plane_mask};
+                continue;
+            }
+
+            for (uint32_t m = node.first; m < node.first + node.count; m++)
+            {
+                Meshlet const& meshlet = meshlets.meshlets[m];
+                if (entry.plane_mask != 0 && !frustum_intersects_sphere(frustum, meshlet.center, meshlet.radius, entry.plane_mask))
+                    continue;
+
+                if (cull_back_faces && is_backfacing(meshlet, eye, forward, perspective))
+                {
+                    m_stats.cone_culled++;
+                    continue;
+                }
+
+                m_visible.push_back(m);
+            }
+        }
+    }
+
+    m_stats.visible_meshlets = m_visible.size();
+    m_stats.frustum_culled   = meshlets.meshlets.size() - m_stats.visible_meshlets - m_stats.cone_culled;
+
+    // Assign each visible meshlet its range in the output, then copy the meshlets in parallel
+    m_offsets.resize(m_visible.size());
+    glm::u32vec2 total = glm::u32vec2(0);
+    for (size_t i = 0; i < m_visible.size(); i++)
+    {
+        Meshlet const& meshlet = meshlets.meshlets[m_visible[i]];
+        m_offsets[i]           = total;
+        total += glm::u32vec2(meshlet.vertex_count, meshlet.triangle_count);
+    }
+
+    m_positions.resize(total.x);
+    m_indices.resize(total.y);
+
+    parallel_for(m_visible.size(), parallel_threshold, parallel_chunk_size, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            Meshlet const& meshlet       = meshlets.meshlets[m_visible[i]];
+            uint32_t       vertex_base   = m_offsets[i].x;
+            uint32_t       triangle_base = m_offsets[i].y;
+
+            for (uint32_t v = 0; v < meshlet.vertex_count; v++)
+                m_positions[vertex_base + v] = positions[meshlets.vertices[meshlet.vertex_offset + v]];
+            for (uint32_t t = 0; t < meshlet.triangle_count; t++)
+                m_indices[triangle_base + t] = glm::u32vec3(vertex_base) + glm::u32vec3(meshlets.triangles[meshlet.triangle_offset + t]);
+        }
+    });
+}
+
+} // namespace ex2
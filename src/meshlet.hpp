@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "camera_math.hpp"
+#include "frustum.hpp"
+#include "mesh_loader.hpp"
+#include "mesh_preprocess.hpp"
+
+namespace ex2
+{
+
+constexpr size_t meshlet_max_vertices  = 64;
+constexpr size_t meshlet_max_triangles = 124;
+
+/**
+ * \brief A small cluster of connected triangles with bounds for coarse culling.
+ *
+ * The vertices of a meshlet are \c vertex_count consecutive entries of \c MeshletMesh::vertices starting at
+ * \c vertex_offset, its triangles are \c triangle_count consecutive entries of \c MeshletMesh::triangles starting at
+ * \c triangle_offset, which index the meshlet vertices.
+ */
+struct Meshlet
+{
+    uint32_t vertex_offset   = 0;
+    uint32_t triangle_offset = 0;
+    uint32_t vertex_count    = 0;
+    uint32_t triangle_count  = 0;
+
+    glm::vec3 center = glm::vec3(0.f); //!< Center of the bounding sphere
+    float     radius = 0.f;            //!< Radius of the bounding sphere
+
+    glm::vec3 aabb_min = glm::vec3(0.f);
+    glm::vec3 aabb_max = glm::vec3(0.f);
+
+    //! Axis of the cone containing all triangle normals; zero if the normals are spread too wide for cone culling
+    glm::vec3 cone_axis   = glm::vec3(0.f);
+    //! Sine of the cone's half angle; 1 disables cone culling
+    float     cone_cutoff = 1.f;
+};
+
+/**
+ * \brief Node of the bounding volume hierarchy over the meshlets.
+ *
+ * Leaves (\c count > 0) reference the meshlets `[first, first + count)`, inner nodes reference their two children at
+ * \c first and `first + 1`.
+ */
+struct MeshletBvhNode
+{
+    glm::vec3 aabb_min = glm::vec3(0.f);
+    uint32_t  first    = 0;
+    glm::vec3 aabb_max = glm::vec3(0.f);
+    uint32_t  count    = 0;
+};
+
+/**
+ * \brief A mesh partitioned into meshlets, arranged in a bounding volume hierarchy.
+ *
+ * The positions are not copied; the meshlets reference the vertices of the mesh they were built from by index.
+ */
+struct MeshletMesh
+{
+    std::vector<Meshlet>        meshlets;
+    std::vector<uint32_t>       vertices;  //!< Mesh vertex indices of all meshlets
+    std::vector<glm::u8vec3>    triangles; //!< Meshlet-local vertex indices of all meshlets
+    std::vector<MeshletBvhNode> nodes;     //!< Root at index 0; empty if there are no meshlets
+};
+
+/**
+ * \brief Partition a mesh into meshlets with at most \c meshlet_max_vertices vertices and \c meshlet_max_triangles
+ * triangles and build the bounding volume hierarchy over them.
+ *
+ * Meshlets are grown greedily over shared vertices, preferring triangles across the edges of the last one, so they
+ * consist of connected triangles and stay compact. The normal cones are bounded by the face normals of the topology.
+ *
+ * \param[in]  mesh     The mesh
+ * \param[out] meshlets The meshlets and their hierarchy
+ * \param[in]  topology The topology of \c mesh, e.g. precomputed by \c preprocess_mesh(...); derived from the mesh with
+ *                      \c compute_mesh_topology(...) if \c nullptr
+ */
+void build_meshlets(MeshView mesh, MeshletMesh* meshlets, MeshTopology const* topology = nullptr);
+
+/**
+ * \brief Culls meshlets against the view frustum and collects the geometry of the visible ones.
+ *
+ * The bounding volume hierarchy is traversed with the frustum planes of the camera, subtrees entirely inside the
+ * frustum are accepted without further tests. Optionally meshlets whose triangles all face away from the camera are
+ * culled by their normal cone.
+ *
+ * The result is a compacted mesh with only the vertices and triangles of the visible meshlets, so transforming it
+ * costs time proportional to the visible geometry. All buffers are reused from call to call.
+ */
+class MeshletCuller
+{
+public:
+    //! Number of visible meshlets from which their geometry is collected in parallel, and meshlets per chunk
+    static constexpr size_t parallel_threshold  = 256;
+    static constexpr size_t parallel_chunk_size = 64;
+
+    struct Stats
+    {
+        size_t visible_meshlets = 0;
+        size_t frustum_culled   = 0; //!< Meshlets outside the frustum, including those of culled BVH nodes
+        size_t cone_culled      = 0; //!< Meshlets inside the frustum that face away from the camera
+        size_t visited_nodes    = 0;
+    };
+
+    /**
+     * \brief Cull the meshlets and collect the visible geometry.
+     *
+     * \param[in] meshlets          The meshlets of the mesh
+     * \param[in] positions         The vertex positions of the mesh the meshlets were built from
+     * \param[in] camera            The camera, whose cached frustum planes and position are used
+     * \param[in] cull_back_faces   Also cull meshlets by their normal cone
+     */
+    void run(MeshletMesh const& meshlets, std::span<glm::vec3 const> positions, Camera<float> const& camera, bool cull_back_faces);
+
+    //! The vertices and triangles of the visible meshlets
+    MeshView mesh() const { return {m_positions, m_indices}; }
+
+    Stats const& stats() const { return m_stats; }
+
+private:
+    std::vector<glm::vec3>    m_positions;
+    std::vector<glm::u32vec3> m_indices;
+    std::vector<uint32_t>     m_visible;
+    std::vector<glm::u32vec2> m_offsets; //!< First output vertex and triangle of each visible meshlet
+    Stats                     m_stats;
+};
+
+} // namespace ex2
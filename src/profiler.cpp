@@ -0,0 +1,389 @@
+#include "profiler.hpp"
+
+#if EX2_PROFILER
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <imgui.h>
+
+namespace ex2
+{
+
+namespace
+{
+
+constexpr size_t ring_capacity  = size_t(1) << 14; //!< Zones held per thread
+constexpr size_t history_frames = 120;              //!< Frames the statistics of the GUI are computed over
+
+struct Zone
+{
+    char const* name;
+    uint64_t    start_ns;
+    uint64_t    end_ns;
+    uint64_t    frame;
+    uint32_t    thread;
+    uint32_t    depth;
+};
+
+/**
+ * Ring buffer of the zones recorded by one thread.
+ *
+ * The slots are written with relaxed atomic stores, so the GUI thread can read them while the owning thread records new
+ * zones. Zones whose slots may have been reused while they were read are discarded afterwards, like in a seqlock.
+ */
+struct ZoneRing
+{
+    struct Slot
+    {
+        std::atomic<char const*> name;
+        std::atomic<uint64_t>    start_ns;
+        std::atomic<uint64_t>    end_ns;
+        std::atomic<uint64_t>    frame;
+        std::atomic<uint32_t>    depth;
+    };
+
+    explicit ZoneRing(uint32_t thread)
+        : thread(thread), slots(new Slot[ring_capacity])
+    {
+    }
+
+    uint32_t                thread;
+    std::unique_ptr<Slot[]> slots;
+    std::atomic<uint64_t>   written{0}; //!< Zones recorded so far
+};
+
+struct Registry
+{
+    std::mutex                             mutex;
+    std::vector<std::unique_ptr<ZoneRing>> rings;
+};
+
+Registry& registry()
+{
+    static Registry registry;
+    return registry;
+}
+
+std::atomic<uint64_t> g_frame{0};
+
+thread_local ZoneRing* t_ring  = nullptr;
+thread_local uint32_t  t_depth = 0;
+
+ZoneRing& thread_ring()
+{
+    // Only the first zone of a thread registers its ring, the rings live until the program exits
+    if (t_ring == nullptr)
+    {
+        Registry&       r = registry();
+        std::lock_guard lock(r.mutex);
+        r.rings.push_back(std::make_unique<ZoneRing>(static_cast<uint32_t>(r.rings.size())));
+        t_ring = r.rings.back().get();
+    }
+    return *t_ring;
+}
+
+uint64_t now_ns()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * Copy the zones of all frames starting with \c first_frame from the rings of all threads.
+ */
+void collect_zones(uint64_t first_frame, std::vector<Zone>* zones)
+{
+    zones->clear();
+
+    Registry&       r = registry();
+    std::lock_guard lock(r.mutex);
+    for (std::unique_ptr<ZoneRing> const& ring : r.rings)
+    {
+        uint64_t end   = ring->written.load(std::memory_order_acquire);
+        uint64_t begin = end > ring_capacity ? end - ring_capacity : 0;
+        size_t   first = zones->size();
+
+        // Newest first, so reading can stop at the first zone of an older frame
+        for (uint64_t i = end; i > begin; i--)
+        {
+            ZoneRing::Slot const& slot = ring->slots[(i - 1) % ring_capacity];
+
+            Zone zone;
+            zone.name     = slot.name.load(std::memory_order_relaxed);
+            zone.start_ns = slot.start_ns.load(std::memory_order_relaxed);
+            zone.end_ns   = slot.end_ns.load(std::memory_order_relaxed);
+            zone.frame    = slot.frame.load(std::memory_order_relaxed);
+            zone.depth    = slot.depth.load(std::memory_order_relaxed);
+            zone.thread   = ring->thread;
+
+            if (zone.frame < first_frame)
+                break;
+            zones->push_back(zone);
+        }
+
+        // Slots at or below `written - capacity` may have been overwritten by the owning thread in the meantime
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t written      = ring->written.load(std::memory_order_relaxed);
+        uint64_t oldest_valid = written >= ring_capacity ? written - ring_capacity + 1 : 0;
+        size_t   valid        = end > oldest_valid ? static_cast<size_t>(end - oldest_valid) : 0;
+        zones->resize(first + std::min(zones->size() - first, valid));
+    }
+}
+
+/**
+ * Per-frame totals of one zone over the last \c history_frames frames.
+ */
+struct ZoneStats
+{
+    char const*         name = nullptr;
+    std::vector<double> frame_ms;
+    uint32_t            calls   = 0; //!< Calls in the last completed frame
+    double              average = 0.0;
+    double              p99     = 0.0;
+};
+
+ZoneStats& find_stats(std::vector<ZoneStats>& stats, char const* name)
+{
+    for (ZoneStats& s : stats)
+    {
+        if (s.name == name || std::strcmp(s.name, name) == 0)
+            return s;
+    }
+
+    stats.emplace_back();
+    stats.back().name = name;
+    stats.back().frame_ms.resize(history_frames);
+    return stats.back();
+}
+
+ImU32 zone_color(char const* name)
+{
+    // FNV-1a, so a zone keeps its color from frame to frame
+    uint32_t hash = 2166136261u;
+    for (char const* c = name; *c; c++)
+        hash = (hash ^ static_cast<uint8_t>(*c)) * 16777619u;
+
+    return IM_COL32(90 + hash % 140, 90 + (hash >> 8) % 140, 90 + (hash >> 16) % 140, 255);
+}
+
+void draw_timeline(std::vector<Zone> const& zones, uint64_t frame)
+{
+    uint64_t frame_start = UINT64_MAX;
+    uint64_t frame_end   = 0;
+    uint32_t threads     = 0;
+    uint32_t depth       = 0;
+    for (Zone const& zone : zones)
+    {
+        if (zone.frame != frame)
+            continue;
+        frame_start = std::min(frame_start, zone.start_ns);
+        frame_end   = std::max(frame_end, zone.end_ns);
+        threads     = std::max(threads, zone.thread + 1);
+        depth       = std::max(depth, zone.depth + 1);
+    }
+    if (frame_end <= frame_start)
+        return;
+
+    ImGui::Text("Frame %llu: %.3f ms", static_cast<unsigned long long>(frame), static_cast<double>(frame_end - frame_start) * 1e-6);
+
+    // One lane per thread, one row per nesting depth within a lane
+    ImDrawList* draw_list  = ImGui::GetWindowDrawList();
+    ImVec2      origin     = ImGui::GetCursorScreenPos();
+    float       width      = std::max(ImGui::GetContentRegionAvail().x, 100.f);
+    float       row_height = ImGui::GetTextLineHeightWithSpacing();
+    double      scale      = width / static_cast<double>(frame_end - frame_start);
+
+    for (Zone const& zone : zones)
+    {
+        if (zone.frame != frame)
+            continue;
+
+        float  row = static_cast<float>(zone.thread * depth + zone.depth);
+        ImVec2 min = ImVec2(origin.x + static_cast<float>(static_cast<double>(zone.start_ns - frame_start) * scale), origin.y + row * row_height);
+        ImVec2 max = ImVec2(origin.x + static_cast<float>(static_cast<double>(zone.end_ns - frame_start) * scale), min.y + row_height - 1.f);
+        max.x      = std::max(max.x, min.x + 1.f);
+
+        draw_list->AddRectFilled(min, max, zone_color(zone.name));
+        if (ImGui::CalcTextSize(zone.name).x < max.x - min.x - 4.f)
+            draw_list->AddText(ImVec2(min.x + 2.f, min.y), IM_COL32(0, 0, 0, 255), zone.name);
+        if (ImGui::IsMouseHoveringRect(min, max))
+            ImGui::SetTooltip("%s: %.3f ms (thread %u)", zone.name, static_cast<double>(zone.end_ns - zone.start_ns) * 1e-6, zone.thread);
+    }
+
+    ImGui::Dummy(ImVec2(width, static_cast<float>(threads * depth) * row_height));
+}
+
+/**
+ * All zones still held by the ring buffers, ordered by start time.
+ */
+std::vector<Zone> collect_all_zones()
+{
+    std::vector<Zone> zones;
+    collect_zones(0, &zones);
+    std::sort(zones.begin(), zones.end(), [](Zone const& a, Zone const& b) { return a.start_ns < b.start_ns; });
+    return zones;
+}
+
+} // namespace
+
+ScopedZone::ScopedZone(char const* name)
+    : m_name(name), m_start_ns(now_ns())
+{
+    t_depth++;
+}
+
+ScopedZone::~ScopedZone()
+{
+    uint64_t end_ns = now_ns();
+    t_depth--;
+
+    ZoneRing&       ring  = thread_ring();
+    uint64_t        index = ring.written.load(std::memory_order_relaxed);
+    ZoneRing::Slot& slot  = ring.slots[index % ring_capacity];
+
+    slot.name.store(m_name, std::memory_order_relaxed);
+    slot.start_ns.store(m_start_ns, std::memory_order_relaxed);
+    slot.end_ns.store(end_ns, std::memory_order_relaxed);
+    slot.frame.store(g_frame.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    slot.depth.store(t_depth, std::memory_order_relaxed);
+    ring.written.store(index + 1, std::memory_order_release);
+}
+
+void profiler_mark_frame()
+{
+    g_frame.fetch_add(1, std::memory_order_relaxed);
+}
+
+void gui_profiler()
+{
+    // Kept across frames, so the panel does not allocate once it has seen all zones
+    static std::vector<Zone>      zones;
+    static std::vector<ZoneStats> stats;
+    static std::vector<double>    sorted;
+    static bool                   paused = false;
+    static std::string            export_status;
+
+    uint64_t frame = g_frame.load(std::memory_order_relaxed);
+    uint64_t first = frame > history_frames ? frame - history_frames : 0;
+
+    ImGui::Begin("Profiler");
+    ImGui::Checkbox("Pause", &paused);
+    ImGui::SameLine();
+    if (ImGui::Button("Export CSV"))
+        export_status = export_profile_csv("profile.csv") ? "Wrote profile.csv" : "Could not write profile.csv";
+    ImGui::SameLine();
+    if (ImGui::Button("Export Chrome trace"))
+        export_status = export_profile_chrome_trace("profile_trace.json") ? "Wrote profile_trace.json" : "Could not write profile_trace.json";
+    if (!export_status.empty())
+        ImGui::TextUnformatted(export_status.c_str());
+
+    if (!paused)
+    {
+        // Only completed frames, the current frame is still being recorded
+        collect_zones(first, &zones);
+
+        for (ZoneStats& s : stats)
+        {
+            std::fill(s.frame_ms.begin(), s.frame_ms.end(), 0.0);
+            s.calls = 0;
+        }
+        for (Zone const& zone : zones)
+        {
+            if (zone.frame >= frame)
+                continue;
+
+            ZoneStats& s = find_stats(stats, zone.name);
+            s.frame_ms[(zone.frame - first) % history_frames] += static_cast<double>(zone.end_ns - zone.start_ns) * 1e-6;
+            if (zone.frame + 1 == frame)
+                s.calls++;
+        }
+
+        size_t frame_count = static_cast<size_t>(std::max<uint64_t>(1, frame - first));
+        for (ZoneStats& s : stats)
+        {
+            sorted.assign(s.frame_ms.begin(), s.frame_ms.begin() + frame_count);
+            std::sort(sorted.begin(), sorted.end());
+
+            double total = 0.0;
+            for (double ms : sorted)
+                total += ms;
+
+            s.average = total / static_cast<double>(frame_count);
+            s.p99     = sorted[std::min(frame_count - 1, frame_count * 99 / 100)];
+        }
+        std::sort(stats.begin(), stats.end(), [](ZoneStats const& a, ZoneStats const& b) { return a.average > b.average; });
+    }
+
+    ImGui::Text("%-28s %10s %10s %7s", "Zone", "avg [ms]", "p99 [ms]", "calls");
+    ImGui::Separator();
+    for (ZoneStats const& s : stats)
+        ImGui::Text("%-28s %10.3f %10.3f %7u", s.name, s.average, s.p99, s.calls);
+
+    ImGui::Separator();
+    if (frame > 0)
+        draw_timeline(zones, frame - 1);
+
+    ImGui::End();
+}
+
+bool export_profile_csv(std::string const& path)
+{
+    std::ofstream file(path);
+    if (!file)
+    {
+        std::cerr << "Could not open " << path << " for writing" << std::endl;
+        return false;
+    }
+
+    std::vector<Zone> zones  = collect_all_zones();
+    uint64_t          origin = zones.empty() ? 0 : zones.front().start_ns;
+
+    file << "frame,thread,depth,name,start_us,duration_us\n";
+    for (Zone const& zone : zones)
+    {
+        file << zone.frame << ',' << zone.thread << ',' << zone.depth << ',' << zone.name << ','
+             << static_cast<double>(zone.start_ns - origin) * 1e-3 << ','
+             << static_cast<double>(zone.end_ns - zone.start_ns) * 1e-3 << '\n';
+    }
+
+    return static_cast<bool>(file);
+}
+
+bool export_profile_chrome_trace(std::string const& path)
+{
+    std::ofstream file(path);
+    if (!file)
+    {
+        std::cerr << "Could not open " << path << " for writing" << std::endl;
+        return false;
+    }
+
+    std::vector<Zone> zones  = collect_all_zones();
+    uint64_t          origin = zones.empty() ? 0 : zones.front().start_ns;
+
+    // Complete events ("ph": "X") with timestamps in microseconds; zone names are identifiers without quotes
+    file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    for (size_t i = 0; i < zones.size(); i++)
+    {
+        Zone const& zone = zones[i];
+        file << "  {\"name\": \"" << zone.name << "\", \"cat\": \"ex2\", \"ph\": \"X\""
+             << ", \"ts\": " << static_cast<double>(zone.start_ns - origin) * 1e-3
+             << ", \"dur\": " << static_cast<double>(zone.end_ns - zone.start_ns) * 1e-3
+             << ", \"pid\": 1, \"tid\": " << zone.thread
+             << ", \"args\": {\"frame\": " << zone.frame << "}}" << (i + 1 < zones.size() ? "," : "") << "\n";
+    }
+    file << "]}\n";
+
+    return static_cast<bool>(file);
+}
+
+} // namespace ex2
+
+#endif
@@ -0,0 +1,86 @@
+#pragma once
+
+/**
+ * Scoped-timer instrumentation of the frame.
+ *
+ * Zones are opened with \c EX2_PROFILE_ZONE("Name") and closed at the end of the enclosing scope, frames are delimited
+ * with \c EX2_PROFILE_FRAME(). Recording a zone writes one record into a fixed-size ring buffer of the calling thread,
+ * so it does not allocate or lock. The recorded zones are shown by \c gui_profiler() and can be exported as CSV or as
+ * Chrome trace JSON (open with chrome://tracing or https://ui.perfetto.dev).
+ *
+ * Define \c EX2_PROFILER as 0 to compile all instrumentation to nothing.
+ */
+
+#ifndef EX2_PROFILER
+#define EX2_PROFILER 1
+#endif
+
+#include <cstdint>
+#include <string>
+
+namespace ex2
+{
+
+#if EX2_PROFILER
+
+/**
+ * \brief Records the time between its construction and destruction as a zone; use \c EX2_PROFILE_ZONE(...).
+ */
+class ScopedZone
+{
+public:
+    /**
+     * \param[in] name The name of the zone, must be a string with static storage duration (e.g. a literal)
+     */
+    explicit ScopedZone(char const* name);
+    ~ScopedZone();
+
+    ScopedZone(ScopedZone const&)            = delete;
+    ScopedZone& operator=(ScopedZone const&) = delete;
+
+private:
+    char const* m_name;
+    uint64_t    m_start_ns;
+};
+
+/**
+ * \brief Start a new frame; zones ending after this call belong to the new frame.
+ */
+void profiler_mark_frame();
+
+/**
+ * \brief Show the per-zone statistics and the timeline of the last completed frame in a GUI window.
+ */
+void gui_profiler();
+
+/**
+ * \brief Write all zones still held by the ring buffers as CSV, one zone per line.
+ *
+ * \return true on success, false if the file could not be written
+ */
+bool export_profile_csv(std::string const& path);
+
+/**
+ * \brief Write all zones still held by the ring buffers in the Chrome trace event format.
+ *
+ * \return true on success, false if the file could not be written
+ */
+bool export_profile_chrome_trace(std::string const& path);
+
+#define EX2_PROFILE_CONCAT_IMPL(a, b) a##b
+#define EX2_PROFILE_CONCAT(a, b)      EX2_PROFILE_CONCAT_IMPL(a, b)
+#define EX2_PROFILE_ZONE(name)        ::ex2::ScopedZone EX2_PROFILE_CONCAT(ex2_profile_zone_, __LINE__)(name)
+#define EX2_PROFILE_FRAME()           ::ex2::profiler_mark_frame()
+
+#else
+
+inline void gui_profiler() {}
+inline bool export_profile_csv(std::string const&) { return false; }
+inline bool export_profile_chrome_trace(std::string const&) { return false; }
+
+#define EX2_PROFILE_ZONE(name) ((void)0)
+#define EX2_PROFILE_FRAME()    ((void)0)
+
+#endif
+
+} // namespace ex2
@@ -0,0 +1,486 @@
+#include "self_test.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "camera_math.hpp"
+#include "helper.hpp"
+#include "simd_transform.hpp"
+#include "software_rasterizer.hpp"
+
+namespace ex2
+{
+
+namespace
+{
+
+//! Not a multiple of any vector width, so every path also runs its scalar tail
+constexpr size_t point_count = 1003;
+
+//! Number of cameras of the sweep checking the camera math
+constexpr size_t camera_count = 1000;
+
+//! Number of cameras of the sweep the rasterizer paths are compared with, and the size of their images
+constexpr size_t raster_camera_count = 8;
+constexpr int    raster_size         = 256;
+
+/**
+ * Largest errors of one instruction set path.
+ */
+struct IsaErrors
+{
+    double transform = 0.0; // In ULP of the sum of the magnitudes of the terms
+    double mvp       = 0.0; // In ULP of the sum of the magnitudes of the terms
+    double divide    = 0.0; // In ULP of the result
+};
+
+/**
+ * Map a float to an integer such that adjacent floats map to adjacent integers, across the sign as well.
+ */
+int64_t ordered_bits(float value)
+{
+    int32_t bits = std::bit_cast<int32_t>(value);
+    return bits < 0 ? int64_t(std::numeric_limits<int32_t>::min()) - bits : bits;
+}
+
+/**
+ * Number of floats between \c a and \c b, infinite if exactly one of them is NaN.
+ */
+double ulp_distance(float a, float b)
+{
+    if (std::isnan(a) || std::isnan(b))
+        return std::isnan(a) && std::isnan(b) ? 0.0 : std::numeric_limits<double>::infinity();
+    return static_cast<double>(std::abs(ordered_bits(a) - ordered_bits(b)));
+}
+
+/**
+ * Difference of \c a and \c b in ULP of \c magnitude, which is the sum of the magnitudes of the terms of a dot product.
+ */
+double scaled_ulp_distance(float a, float b, float magnitude)
+{
+    if (std::isnan(a) || std::isnan(b))
+        return ulp_distance(a, b);
+
+    float ulp = std::nextafter(magnitude, std::numeric_limits<float>::infinity()) - magnitude;
+    ulp       = std::max(ulp, std::numeric_limits<float>::denorm_min());
+    return std::abs(static_cast<double>(a) - static_cast<double>(b)) / static_cast<double>(ulp);
+}
+
+/**
+ * The matrices of the test: a view, orthographic and perspective projections with both depth ranges, an infinite
+ * perspective projection and a dense matrix without structure.
+ */
+std::vector<glm::mat4> test_matrices(std::mt19937& generator)
+{
+    glm::mat4 view = look_at(glm::vec3(3.f, 1.5f, -2.f), glm::vec3(0.f), glm::vec3(0.f, 1.f, 0.f)).matrix;
+
+    std::vector<glm::mat4> matrices = {
+        view,
+        orthographic(-2.f, 2.f, -1.f, 1.f, 0.1f, 20.f).matrix * view,
+        perspective(glm::radians(60.f), 1.5f, 0.1f, 20.f).matrix * view,
+        perspective(glm::radians(60.f), 1.5f, 0.1f, 20.f, DepthRange::ReversedZ).matrix * view,
+        infinite_perspective(glm::radians(45.f), 1.f, 0.01f).matrix * view,
+    };
+
+    std::uniform_real_distribution<float> entry(-4.f, 4.f);
+    glm::mat4                             dense;
+    for (int col = 0; col < 4; col++)
+        for (int row = 0; row < 4; row++)
+            dense[col][row] = entry(generator);
+    matrices.push_back(dense);
+
+    return matrices;
+}
+
+/**
+ * Model matrix of \c transform_points_mvp(...): a rotation around the y-axis, a uniform scale and a translation.
+ */
+glm::mat4 test_model_matrix()
+{
+    float const angle = 0.6f;
+    float const scale = 0.5f;
+
+    glm::mat4 model(1.f);
+    model[0][0] = scale * std::cos(angle);
+    model[0][2] = -scale * std::sin(angle);
+    model[1][1] = scale;
+    model[2][0] = scale * std::sin(angle);
+    model[2][2] = scale * std::cos(angle);
+    model[3]    = glm::vec4(1.f, -2.f, 0.5f, 1.f);
+    return model;
+}
+
+/**
+ * Largest error of the coordinates of \c got against `m * vec4(point, 1)`, in ULP of the sum of the magnitudes of the terms.
+ */
+double transform_error(glm::mat4 const& m, glm::vec3 const& point, glm::vec4 const& got, glm::vec4 const& reference)
+{
+    double    error = 0.0;
+    glm::vec4 p     = glm::vec4(point, 1.0f);
+    for (int row = 0; row < 4; row++)
+    {
+        float magnitude = std::abs(m[0][row] * p.x) + std::abs(m[1][row] * p.y) + std::abs(m[2][row] * p.z) + std::abs(m[3][row]);
+        error           = std::max(error, scaled_ulp_distance(got[row], reference[row], magnitude));
+    }
+    return error;
+}
+
+/**
+ * Run the kernels of the active instruction set on \c points for every matrix and compare them to glm.
+ */
+IsaErrors check_active_isa(std::vector<glm::vec3> const& points, std::vector<glm::mat4> const& matrices)
+{
+    IsaErrors       errors;
+    glm::mat4 const model = test_model_matrix();
+
+    simd::Positions soa_points;
+    simd::to_soa(points, &soa_points);
+
+    // Both the full range and a range starting and ending off the vector width
+    size_t const ranges[2][2] = {{0, points.size()}, {5, points.size() - 3}};
+
+    for (glm::mat4 const& m : matrices)
+    {
+        std::vector<glm::vec4> reference(points.size());
+        for (size_t i = 0; i < points.size(); i++)
+            reference[i] = m * glm::vec4(points[i], 1.0f);
+
+        for (auto const& range : ranges)
+        {
+            simd::HomogeneousPositions clip;
+            clip.resize(points.size());
+            simd::transform_points(m, soa_points, &clip, range[0], range[1]);
+
+            for (size_t i = range[0]; i < range[1]; i++)
+            {
+                glm::vec4 got    = glm::vec4(clip.x[i], clip.y[i], clip.z[i], clip.w[i]);
+                errors.transform = std::max(errors.transform, transform_error(m, points[i], got, reference[i]));
+            }
+        }
+
+        // The matrix as the projection of the model-view product, with an output that has to be resized. The first
+        // matrix of test_matrices(...) is the view matrix.
+        {
+            glm::mat4 const view = matrices.front();
+            glm::mat4 const mvp  = m * view * model;
+
+            simd::HomogeneousPositions clip;
+            simd::transform_points_mvp(model, view, m, soa_points, &clip);
+
+            for (size_t i = 0; i < points.size(); i++)
+            {
+                glm::vec4 got = i < clip.size() ? glm::vec4(clip.x[i], clip.y[i], clip.z[i], clip.w[i]) : glm::vec4(NAN);
+                errors.mvp    = std::max(errors.mvp, transform_error(mvp, points[i], got, mvp * glm::vec4(points[i], 1.0f)));
+            }
+        }
+
+        // Divide the reference clip coordinates, with some w forced to zero to cover the pass-through
+        simd::HomogeneousPositions homogeneous;
+        homogeneous.resize(points.size());
+        for (size_t i = 0; i < points.size(); i++)
+        {
+            homogeneous.x[i] = reference[i].x;
+            homogeneous.y[i] = reference[i].y;
+            homogeneous.z[i] = reference[i].z;
+            homogeneous.w[i] = i % 7 == 0 ? 0.0f : reference[i].w;
+        }
+
+        for (auto const& range : ranges)
+        {
+            simd::Positions divided;
+            divided.resize(points.size());
+            simd::perspective_divide(homogeneous, &divided, range[0], range[1]);
+
+            for (size_t i = range[0]; i < range[1]; i++)
+            {
+                glm::vec3 p = glm::vec3(homogeneous.x[i], homogeneous.y[i], homogeneous.z[i]);
+                if (homogeneous.w[i] != 0.0f)
+                    p = p / homogeneous.w[i];
+
+                errors.divide = std::max({errors.divide, ulp_distance(divided.x[i], p.x), ulp_distance(divided.y[i], p.y), ulp_distance(divided.z[i], p.z)});
+            }
+        }
+    }
+
+    return errors;
+}
+
+/**
+ * The largest errors of the camera math over a sweep of cameras, relative to the largest element of the exact result.
+ *
+ * The exact inverses are approximated by \c glm::inverse of the double precision matrices built from the same parameters,
+ * the exact frustum corners by the NDC corners transformed by the \c glm::inverse of the double precision view
+ * projection matrix. Besides the cameras of the GUI, the sweep covers the reversed-Z depth range and infinite
+ * perspective projections.
+ */
+struct CameraAccuracy
+{
+    //! Bound of the errors of the closed-form results, in multiples of the machine epsilon of their precision
+    static constexpr double max_epsilons     = 16.0;
+    static constexpr double max_float_error  = max_epsilons * std::numeric_limits<float>::epsilon();
+    static constexpr double max_double_error = max_epsilons * std::numeric_limits<double>::epsilon();
+
+    double inverse_float     = 0.0; // The closed-form inverses in single precision
+    double glm_inverse_float = 0.0; // glm::inverse of the single precision matrices, for comparison
+    double inverse_double    = 0.0; // The closed-form inverses in double precision
+    double corners_float     = 0.0; // The frustum corners of Camera<float>
+    double corners_double    = 0.0; // The frustum corners of Camera<double>
+    double planes_double     = 0.0; // Distance of the exact corners to the planes of Camera<double> through them
+
+    void add(CameraParameters const& parameters);
+    void add(InvertibleMatrix<float> const& matrix, InvertibleMatrix<double> const& matrix_double);
+    void add(InvertibleMatrix<float> const& view, InvertibleMatrix<double> const& view_double, Projection<float> const& projection,
+             Projection<double> const& projection_double);
+
+    bool within_bounds() const
+    {
+        return inverse_float <= max_float_error && inverse_double <= max_double_error && corners_float <= max_float_error &&
+               corners_double <= max_double_error && planes_double <= max_double_error;
+    }
+};
+
+double relative_error(glm::dmat4 const& inverse, glm::dmat4 const& reference)
+{
+    double error = 0.0;
+    double scale = 0.0;
+    for (int c = 0; c < 4; c++)
+    {
+        for (int r = 0; r < 4; r++)
+        {
+            error = std::max(error, std::abs(inverse[c][r] - reference[c][r]));
+            scale = std::max(scale, std::abs(reference[c][r]));
+        }
+    }
+    return error / scale;
+}
+
+void CameraAccuracy::add(CameraParameters const& parameters)
+{
+    glm::vec3                origin      = camera_position(parameters.azimuth);
+    InvertibleMatrix<float>  view        = camera_view(origin);
+    InvertibleMatrix<double> view_double = camera_view(glm::dvec3(origin));
+    add(view, view_double);
+    add(view, view_double, camera_projection(parameters), camera_projection<double>(parameters));
+
+    // The same volumes with the depth mappings the GUI does not offer
+    float  n         = parameters.znear;
+    float  f         = parameters.zfar;
+    float  half_size = parameters.size / 2.f;
+    float  fovy      = glm::radians(parameters.fov);
+    double fovy_d    = glm::radians(static_cast<double>(parameters.fov));
+    if (parameters.transformation_type == TransformationType::Orthographic)
+    {
+        add(view, view_double, orthographic(-half_size, half_size, -half_size, half_size, n, f, DepthRange::ReversedZ),
+            orthographic<double>(-half_size, half_size, -half_size, half_size, n, f, DepthRange::ReversedZ));
+    }
+    else
+        add(view, view_double, perspective(fovy, 1.f, n, f, DepthRange::ReversedZ), perspective<double>(fovy_d, 1.0, n, f, DepthRange::ReversedZ));
+
+    for (DepthRange depth_range : {DepthRange::NegativeOneToOne, DepthRange::ReversedZ})
+        add(view, view_double, infinite_perspective(fovy, 1.f, n, depth_range), infinite_perspective<double>(fovy_d, 1.0, n, depth_range));
+}
+
+void CameraAccuracy::add(InvertibleMatrix<float> const& matrix, InvertibleMatrix<double> const& matrix_double)
+{
+    glm::dmat4 reference = glm::inverse(matrix_double.matrix);
+
+    inverse_float     = std::max(inverse_float, relative_error(glm::dmat4(matrix.inverse), reference));
+    glm_inverse_float = std::max(glm_inverse_float, relative_error(glm::dmat4(glm::inverse(matrix.matrix)), reference));
+    inverse_double    = std::max(inverse_double, relative_error(matrix_double.inverse, reference));
+}
+
+void CameraAccuracy::add(InvertibleMatrix<float> const& view, InvertibleMatrix<double> const& view_double, Projection<float> const& projection,
+                         Projection<double> const& projection_double)
+{
+    add(projection, projection_double);
+
+    Camera<float> camera;
+    camera.set_view(view);
+    camera.set_projection(projection);
+
+    Camera<double> camera_double;
+    camera_double.set_view(view_double);
+    camera_double.set_projection(projection_double);
+
+    // Without a far plane, the far corners are placed at the distance chosen by the camera
+    glm::dmat4 const& p          = projection_double.matrix;
+    double            near_depth = projection_double.near_depth();
+    double            far_depth  = projection_double.far_depth();
+    if (projection_double.infinite_far)
+    {
+        double distance = Camera<double>::infinite_far_scale * projection_double.znear;
+        far_depth       = (p[3][2] - distance * p[2][2]) / distance;
+    }
+
+    glm::dmat4 const inverse_view_projection = glm::inverse(p * view_double.matrix);
+    double const     corner_x[4]             = {-1.0, 1.0, 1.0, -1.0};
+    double const     corner_y[4]             = {-1.0, -1.0, 1.0, 1.0};
+
+    // Reconstructing a corner from its depth in NDC, like combining the rows of the matrix to the near and far planes,
+    // amplifies rounding errors by the ratio of the far to the near distance, so the errors are relative to that as well
+    double far_distance = projection_double.infinite_far ? Camera<double>::infinite_far_scale * projection_double.znear : projection_double.zfar;
+    double condition    = projection_double.perspective ? std::max(1.0, far_distance / projection_double.znear) : 1.0;
+
+    glm::dvec3 reference[8];
+    double     scale = 0.0;
+    for (size_t i = 0; i < 8; i++)
+    {
+        glm::dvec4 world = inverse_view_projection * glm::dvec4(corner_x[i % 4], corner_y[i % 4], i < 4 ? near_depth : far_depth, 1.0);
+        reference[i]     = glm::dvec3(world) / world.w;
+        scale            = std::max({scale, std::abs(reference[i].x), std::abs(reference[i].y), std::abs(reference[i].z)});
+    }
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        glm::dvec3 error_float  = glm::abs(glm::dvec3(camera.frustum_corners()[i]) - reference[i]) / (condition * scale);
+        glm::dvec3 error_double = glm::abs(camera_double.frustum_corners()[i] - reference[i]) / (condition * scale);
+        corners_float           = std::max({corners_float, error_float.x, error_float.y, error_float.z});
+        corners_double          = std::max({corners_double, error_double.x, error_double.y, error_double.z});
+
+        // Every corner lies on a left or right, a bottom or top and a near or far plane; an infinite far plane has none
+        unsigned int planes[3] = {i % 4 == 0 || i % 4 == 3 ? 0u : 1u, i % 4 < 2 ? 2u : 3u, i < 4 ? 4u : 5u};
+        for (unsigned int plane : planes)
+        {
+            if (plane == 5 && projection_double.infinite_far)
+                continue;
+
+            glm::dvec4 const& equation = camera_double.frustum_planes()[plane];
+            planes_double              = std::max(planes_double, std::abs(glm::dot(glm::dvec3(equation), reference[i]) + equation.w) / (condition * scale));
+        }
+    }
+}
+
+/**
+ * Render the bunny seen by a camera of the sweep with the active instruction set.
+ */
+void render_bunny(CameraParameters const& parameters, Framebuffer* framebuffer)
+{
+    std::span<glm::vec3 const>    positions;
+    std::span<glm::u32vec3 const> indices;
+    create_bunny_geometry(&positions, &indices);
+
+    Camera<float> camera;
+    camera.set_view(camera_view(camera_position(parameters.azimuth)));
+    camera.set_projection(camera_projection(parameters));
+
+    SoftwareRenderer renderer(framebuffer, glm::vec4(0.f, 0.f, 1.f, 1.f));
+    renderer.set_camera(camera);
+    renderer.clear(glm::vec3(1.f));
+    renderer.render_mesh(positions, indices, glm::vec3(0.8f, 0.5f, 0.3f));
+}
+
+/**
+ * Number of pixels whose color or depth differs between the images of the scalar and the SSE4.1 rasterizer.
+ */
+size_t compare_rasterizers()
+{
+    Framebuffer scalar(raster_size, raster_size);
+    Framebuffer vectorized(raster_size, raster_size);
+
+    size_t differing = 0;
+    for (size_t i = 0; i < raster_camera_count; i++)
+    {
+        CameraParameters parameters = sweep_camera_parameters(i, raster_camera_count);
+
+        simd::set_active_isa(simd::Isa::Scalar);
+        render_bunny(parameters, &scalar);
+        simd::set_active_isa(simd::Isa::SSE41);
+        render_bunny(parameters, &vectorized);
+
+        for (int y = 0; y < raster_size; y++)
+        {
+            for (int x = 0; x < raster_size; x++)
+            {
+                if (scalar.pixel(x, y) != vectorized.pixel(x, y) || scalar.depth_row(y)[x] != vectorized.depth_row(y)[x])
+                    differing++;
+            }
+        }
+    }
+    return differing;
+}
+
+} // namespace
+
+bool self_test_requested(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--self-test") == 0)
+            return true;
+    }
+    return false;
+}
+
+int run_self_test(int /*argc*/, char** /*argv*/)
+{
+    // Fixed seed, so a failure can be reproduced
+    std::mt19937                          generator(42);
+    std::uniform_real_distribution<float> coordinate(-10.f, 10.f);
+
+    std::vector<glm::vec3> points(point_count);
+    for (glm::vec3& p : points)
+        p = glm::vec3(coordinate(generator), coordinate(generator), coordinate(generator));
+
+    std::vector<glm::mat4> matrices = test_matrices(generator);
+
+    simd::Isa const isas[]   = {simd::Isa::Scalar, simd::Isa::SSE41, simd::Isa::AVX2, simd::Isa::AVX512};
+    simd::Isa const previous = simd::active_isa();
+    bool            passed   = true;
+
+    std::cout << "Transform kernels vs. glm, tolerance " << max_ulp_error << " ULP" << std::endl;
+    for (simd::Isa isa : isas)
+    {
+        std::cout << "  " << std::left << std::setw(8) << simd::isa_name(isa) << std::right;
+        if (simd::set_active_isa(isa) != isa)
+        {
+            std::cout << "skipped, not supported by this CPU" << std::endl;
+            continue;
+        }
+
+        IsaErrors errors = check_active_isa(points, matrices);
+        bool      ok     = errors.transform <= max_ulp_error && errors.mvp <= max_ulp_error && errors.divide <= max_ulp_error;
+        passed           = passed && ok;
+
+        std::cout << "transform " << errors.transform << " ULP, mvp " << errors.mvp << " ULP, divide " << errors.divide << " ULP" << (ok ? "" : "  FAILED")
+                  << std::endl;
+    }
+
+    // The rasterizer has a scalar and an SSE4.1 path, which have to produce the same image
+    std::cout << "Rasterizer SSE4.1 vs. scalar, " << raster_camera_count << " images of the bunny" << std::endl;
+    if (simd::set_active_isa(simd::Isa::SSE41) == simd::Isa::SSE41)
+    {
+        size_t differing = compare_rasterizers();
+        passed           = passed && differing == 0;
+        std::cout << "  " << differing << " pixels differ" << (differing == 0 ? "" : "  FAILED") << std::endl;
+    }
+    else
+        std::cout << "  skipped, SSE4.1 not supported by this CPU" << std::endl;
+    simd::set_active_isa(previous);
+
+    CameraAccuracy camera;
+    for (size_t i = 0; i < camera_count; i++)
+        camera.add(sweep_camera_parameters(i, camera_count));
+    passed = passed && camera.within_bounds();
+
+    std::cout << "Camera math vs. glm::inverse in double precision, tolerance " << CameraAccuracy::max_epsilons << " machine epsilons" << std::endl;
+    std::cout << "  inverses float " << camera.inverse_float << " (glm::inverse " << camera.glm_inverse_float << "), double " << camera.inverse_double
+              << std::endl;
+    std::cout << "  frustum corners float " << camera.corners_float << ", double " << camera.corners_double << ", planes double " << camera.planes_double
+              << (camera.within_bounds() ? "" : "  FAILED") << std::endl;
+
+    std::cout << (passed ? "All supported paths agree with glm" : "Self-test failed") << std::endl;
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+} // namespace ex2
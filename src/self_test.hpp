@@ -0,0 +1,40 @@
+#pragma once
+
+namespace ex2
+{
+
+//! Largest error in ULP accepted by \c run_self_test(...) for every instruction set path
+constexpr double max_ulp_error = 4.0;
+
+/**
+ * \brief Check if the self-test was requested on the command line (`--self-test`).
+ */
+bool self_test_requested(int argc, char** argv);
+
+/**
+ * \brief Check every instruction set path of the batched transform kernels and the camera math against glm, without a
+ * window.
+ *
+ * For each of \c simd::Isa::Scalar, \c SSE41, \c AVX2 and \c AVX512 that the CPU supports, a fixed set of pseudo-random
+ * points is transformed by several view and projection matrices with \c simd::transform_points(...) and divided with
+ * \c simd::perspective_divide(...), over the full range and over a range with unaligned bounds. Every matrix is also used
+ * as the projection of \c simd::transform_points_mvp(...) with a fixed model and view matrix. The results are compared
+ * to `glm::mat4 * glm::vec4` and to the glm division:
+ *  - Transformed coordinates, also those of the combined matrix, may differ by at most \c max_ulp_error ULP of the sum
+ *    of the magnitudes of their four terms, which bounds the rounding differences of a reordered dot product even where
+ *    the terms cancel.
+ *  - Divided coordinates may differ by at most \c max_ulp_error ULP of the result.
+ *
+ * Unsupported instruction sets are reported as skipped. The largest error of every path is printed to stdout.
+ *
+ * The closed-form camera inverses and the frustum corners and planes of \c Camera are checked in single and double
+ * precision over a sweep of cameras (see \c sweep_camera_parameters(...)), extended by reversed-Z and infinite
+ * perspective projections, against \c glm::inverse in double precision. Errors may be at most 16 machine epsilons of
+ * their precision; those of the frustum relative to the ratio of the far to the near distance, which the reconstruction
+ * from depth amplifies errors by.
+ *
+ * \return EXIT_SUCCESS if all supported paths and the camera math are within the tolerance, EXIT_FAILURE otherwise
+ */
+int run_self_test(int argc, char** argv);
+
+} // namespace ex2
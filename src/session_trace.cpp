@@ -0,0 +1,261 @@
+#include "session_trace.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+
+namespace ex2
+{
+
+namespace
+{
+
+constexpr char     trace_magic[8] = {'E', 'X', '2', 'T', 'R', 'C', 'E', '\0'};
+constexpr uint32_t trace_version  = 1;
+
+/**
+ * Number of parameters in \c GuiParameter; a frame stores the changes of all of them in one byte.
+ */
+constexpr unsigned int parameter_count = 6;
+constexpr GuiChanges   parameter_mask  = (1 << parameter_count) - 1;
+
+/**
+ * Header of a session trace, followed by the frames. All values are little-endian.
+ */
+struct TraceHeader
+{
+    char     magic[8];
+    uint32_t version;
+    float    timestep;
+    float    azimuth;
+    float    fov;
+    float    size;
+    float    znear;
+    float    zfar;
+    uint32_t transformation_type;
+};
+
+/**
+ * The float member of \c CameraParameters tracked by the given bit of \c GuiChanges, or nullptr for the transformation type.
+ */
+float CameraParameters::* float_parameter(unsigned int parameter)
+{
+    switch (static_cast<GuiParameter>(parameter))
+    {
+    case GuiParameter::Azimuth: return &CameraParameters::azimuth;
+    case GuiParameter::Size: return &CameraParameters::size;
+    case GuiParameter::Fov: return &CameraParameters::fov;
+    case GuiParameter::Near: return &CameraParameters::znear;
+    case GuiParameter::Far: return &CameraParameters::zfar;
+    default: return nullptr;
+    }
+}
+
+struct Summary
+{
+    double mean = 0.0;
+    double p50  = 0.0;
+    double p99  = 0.0;
+};
+
+Summary summarize(std::vector<double> samples)
+{
+    Summary summary;
+    if (samples.empty())
+        return summary;
+
+    std::sort(samples.begin(), samples.end());
+    for (double sample : samples)
+        summary.mean += sample;
+    summary.mean /= static_cast<double>(samples.size());
+    summary.p50 = samples[samples.size() / 2];
+    summary.p99 = samples[std::min(samples.size() - 1, samples.size() * 99 / 100)];
+    return summary;
+}
+
+char const* update_span_name(UpdateSpan span)
+{
+    switch (span)
+    {
+    case UpdateSpan::FrameCache: return "frame_cache";
+    case UpdateSpan::FrameGraph: return "frame_graph";
+    case UpdateSpan::PipelineHandoff: return "pipeline_handoff";
+    }
+    return "unknown";
+}
+
+} // namespace
+
+bool SessionRecorder::open(std::string const& path, CameraParameters const& initial_parameters, float timestep)
+{
+    m_frame_count = 0;
+    if (m_file.is_open())
+        m_file.close();
+
+    if (std::endian::native != std::endian::little)
+    {
+        std::cerr << "Session traces can only be recorded on little-endian machines" << std::endl;
+        return false;
+    }
+
+    m_file.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_file)
+    {
+        std::cerr << "Could not open " << path << " for writing" << std::endl;
+        return false;
+    }
+
+    TraceHeader header;
+    std::memcpy(header.magic, trace_magic, sizeof(trace_magic));
+    header.version             = trace_version;
+    header.timestep            = timestep;
+    header.azimuth             = initial_parameters.azimuth;
+    header.fov                 = initial_parameters.fov;
+    header.size                = initial_parameters.size;
+    header.znear               = initial_parameters.znear;
+    header.zfar                = initial_parameters.zfar;
+    header.transformation_type = static_cast<uint32_t>(initial_parameters.transformation_type);
+    m_file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+
+    return static_cast<bool>(m_file);
+}
+
+void SessionRecorder::record(CameraParameters const& parameters, GuiChanges changes)
+{
+    if (!m_file.is_open())
+        return;
+
+    uint8_t mask = static_cast<uint8_t>(changes & parameter_mask);
+    m_file.put(static_cast<char>(mask));
+
+    // The values of the changed parameters follow in the order of their bits
+    for (unsigned int p = 0; p < parameter_count; p++)
+    {
+        if (!(mask & (1u << p)))
+            continue;
+
+        if (float CameraParameters::* member = float_parameter(p))
+            m_file.write(reinterpret_cast<char const*>(&(parameters.*member)), sizeof(float));
+        else
+            m_file.put(static_cast<char>(parameters.transformation_type));
+    }
+
+    m_frame_count++;
+}
+
+bool SessionRecorder::close()
+{
+    if (!m_file.is_open())
+        return false;
+
+    m_file.flush();
+    bool written = static_cast<bool>(m_file);
+    m_file.close();
+    return written;
+}
+
+bool load_session_trace(std::string const& path, SessionTrace* trace)
+{
+    auto fail = [&](char const* reason) {
+        std::cerr << "Failed to load session trace " << path << ": " << reason << std::endl;
+        return false;
+    };
+
+    if (std::endian::native != std::endian::little)
+        return fail("session traces can only be read on little-endian machines");
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return fail("could not open the file");
+
+    std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    TraceHeader header;
+    if (data.size() < sizeof(header))
+        return fail("truncated header");
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, trace_magic, sizeof(trace_magic)) != 0 || header.version != trace_version)
+        return fail("not a valid session trace");
+    if (header.transformation_type > static_cast<uint32_t>(TransformationType::Perspective))
+        return fail("invalid transformation type");
+
+    trace->timestep                               = header.timestep;
+    trace->initial_parameters.azimuth             = header.azimuth;
+    trace->initial_parameters.fov                 = header.fov;
+    trace->initial_parameters.size                = header.size;
+    trace->initial_parameters.znear               = header.znear;
+    trace->initial_parameters.zfar                = header.zfar;
+    trace->initial_parameters.transformation_type = static_cast<TransformationType>(header.transformation_type);
+    trace->frames.clear();
+
+    // Every frame starts from the parameters of the previous one and overwrites the changed ones
+    CameraParameters parameters = trace->initial_parameters;
+    size_t           offset     = sizeof(header);
+    while (offset < data.size())
+    {
+        uint8_t mask = static_cast<uint8_t>(data[offset++]);
+        if (mask & ~parameter_mask)
+            return fail("invalid frame");
+
+        for (unsigned int p = 0; p < parameter_count; p++)
+        {
+            if (!(mask & (1u << p)))
+                continue;
+
+            if (float CameraParameters::* member = float_parameter(p))
+            {
+                if (data.size() - offset < sizeof(float))
+                    return fail("truncated frame");
+                std::memcpy(&(parameters.*member), data.data() + offset, sizeof(float));
+                offset += sizeof(float);
+            }
+            else
+            {
+                if (offset == data.size() || static_cast<uint8_t>(data[offset]) > static_cast<uint8_t>(TransformationType::Perspective))
+                    return fail("truncated frame");
+                parameters.transformation_type = static_cast<TransformationType>(data[offset++]);
+            }
+        }
+
+        trace->frames.push_back({parameters, static_cast<GuiChanges>(mask)});
+    }
+
+    return true;
+}
+
+void write_frame_timings(std::ostream& out, std::span<FrameTiming const> timings, UpdateSpan update_span)
+{
+    std::vector<double> update_samples;
+    std::vector<double> frame_samples;
+    for (FrameTiming const& timing : timings)
+    {
+        update_samples.push_back(timing.update_ns);
+        frame_samples.push_back(timing.frame_ns);
+    }
+
+    Summary update = summarize(std::move(update_samples));
+    Summary frame  = summarize(std::move(frame_samples));
+
+    out << "{\n";
+    out << "  \"update_span\": \"" << update_span_name(update_span) << "\",\n";
+    out << "  \"frames\": " << timings.size() << ",\n";
+    out << "  \"update\": {\"mean_ns\": " << update.mean << ", \"p50_ns\": " << update.p50 << ", \"p99_ns\": " << update.p99 << "},\n";
+    out << "  \"frame\": {\"mean_ns\": " << frame.mean << ", \"p50_ns\": " << frame.p50 << ", \"p99_ns\": " << frame.p99 << "},\n";
+    out << "  \"timings\": [\n";
+
+    for (size_t i = 0; i < timings.size(); i++)
+    {
+        out << "    {\"changes\": " << timings[i].changes
+            << ", \"update_ns\": " << timings[i].update_ns
+            << ", \"frame_ns\": " << timings[i].frame_ns
+            << "}" << (i + 1 < timings.size() ? "," : "") << "\n";
+    }
+
+    out << "  ]\n";
+    out << "}\n";
+}
+
+} // namespace ex2
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "helper.hpp"
+
+namespace ex2
+{
+
+/**
+ * \brief One frame of a recorded session: the camera parameters after the GUI update and the changes it reported.
+ */
+struct SessionFrame
+{
+    CameraParameters parameters;
+    GuiChanges       changes = 0;
+};
+
+/**
+ * \brief A recorded session, as loaded by \c load_session_trace(...).
+ */
+struct SessionTrace
+{
+    float                     timestep = 1.f / 60.f; //!< Fixed time step of a frame in seconds used when replaying
+    CameraParameters          initial_parameters;    //!< The parameters before the first frame
+    std::vector<SessionFrame> frames;
+};
+
+/**
+ * \brief Records the camera parameters and \c GuiChanges of every frame to a compact binary trace.
+ *
+ * Every frame is stored as one byte with the \c GuiChanges bits, followed by the new values of the changed parameters
+ * only, so frames without interaction take one byte. The trace is written to the file as it is recorded and is
+ * complete when the recorder is closed or destroyed.
+ */
+class SessionRecorder
+{
+public:
+    /**
+     * \brief Create the trace file at \c path and start recording.
+     *
+     * \param[in] path               The path of the trace file
+     * \param[in] initial_parameters The parameters before the first recorded frame
+     * \param[in] timestep           The time step of a frame in seconds used when the trace is replayed
+     *
+     * \return true on success, false if the file could not be created (an error is printed to stderr)
+     */
+    bool open(std::string const& path, CameraParameters const& initial_parameters, float timestep = 1.f / 60.f);
+
+    /**
+     * \brief Append a frame; does nothing if the recorder is not open.
+     *
+     * \param[in] parameters The parameters after the GUI update of the frame
+     * \param[in] changes    The changes reported by the GUI update, as returned by \c gui(...)
+     */
+    void record(CameraParameters const& parameters, GuiChanges changes);
+
+    /**
+     * \brief Finish the trace and close the file.
+     *
+     * \return true if the whole trace has been written, false otherwise
+     */
+    bool close();
+
+    bool   is_open() const { return m_file.is_open(); }
+    size_t frame_count() const { return m_frame_count; }
+
+private:
+    std::ofstream m_file;
+    size_t        m_frame_count = 0;
+};
+
+/**
+ * \brief Load a trace written by \c SessionRecorder and reconstruct the parameters of every frame.
+ *
+ * \return true on success, false if the file could not be read or is not a valid trace (an error is printed to stderr)
+ */
+bool load_session_trace(std::string const& path, SessionTrace* trace);
+
+/**
+ * \brief What the update time of a \c FrameTiming measures, which depends on where the session was replayed.
+ */
+enum class UpdateSpan
+{
+    FrameCache,     //!< Only \c FrameCache::update(...), as replayed by `--benchmark --replay`
+    FrameGraph,     //!< The frame graph of the window: the frame cache update and recording the canvases
+    PipelineHandoff //!< Like \c FrameGraph, but handing the frame to the \c FramePipeline and waiting for a finished one
+                    //!< replaces the frame cache update
+};
+
+/**
+ * \brief Timings of one replayed frame.
+ *
+ * The update times of different \c UpdateSpan are not comparable: those of the window include recording the canvases,
+ * and pipelined they hide the work that overlaps the previous frame.
+ */
+struct FrameTiming
+{
+    GuiChanges changes   = 0;
+    double     update_ns = 0.0; //!< Time spent updating the frame, see \c UpdateSpan
+    double     frame_ns  = 0.0; //!< Time of the whole frame
+};
+
+/**
+ * \brief Write the timings of a replayed session as JSON: the span the update time covers, mean, p50 and p99 of both
+ * timings, followed by all frames.
+ */
+void write_frame_timings(std::ostream& out, std::span<FrameTiming const> timings, UpdateSpan update_span);
+
+} // namespace ex2
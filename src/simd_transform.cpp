@@ -0,0 +1,335 @@
+#include "simd_transform.hpp"
+
+#include <cassert>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define EX2_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define EX2_SIMD_X86 0
+#endif
+
+namespace ex2::simd
+{
+
+namespace
+{
+
+using TransformKernel = void (*)(glm::mat4 const&, Positions const&, HomogeneousPositions*, size_t, size_t);
+using DivideKernel    = void (*)(HomogeneousPositions const&, Positions*, size_t, size_t);
+
+// --- Scalar ---
+
+void transform_points_scalar(glm::mat4 const& m, Positions const& in, HomogeneousPositions* out, size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        float x = in.x[i];
+        float y = in.y[i];
+        float z = in.z[i];
+
+        // Same order of operations as glm's mat4 * vec4 (with w = 1)
+        out->x[i] = (m[0][0] * x + m[1][0] * y) + (m[2][0] * z + m[3][0]);
+        out->y[i] = (m[0][1] * x + m[1][1] * y) + (m[2][1] * z + m[3][1]);
+        out->z[i] = (m[0][2] * x + m[1][2] * y) + (m[2][2] * z + m[3][2]);
+        out->w[i] = (m[0][3] * x + m[1][3] * y) + (m[2][3] * z + m[3][3]);
+    }
+}
+
+void perspective_divide_scalar(HomogeneousPositions const& in, Positions* out, size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        float w   = in.w[i];
+        float d   = (w != 0.0f) ? w : 1.0f;
+        out->x[i] = in.x[i] / d;
+        out->y[i] = in.y[i] / d;
+        out->z[i] = in.z[i] / d;
+    }
+}
+
+#if EX2_SIMD_X86
+
+// --- SSE4.1 ---
+
+__attribute__((target("sse4.1"))) void transform_points_sse41(glm::mat4 const& m, Positions const& in, HomogeneousPositions* out, size_t begin, size_t end)
+{
+    __m128 c[4][4];
+    for (int col = 0; col < 4; col++)
+        for (int row = 0; row < 4; row++)
+            c[col][row] = _mm_set1_ps(m[col][row]);
+
+    float* o[4] = {out->x.data(), out->y.data(), out->z.data(), out->w.data()};
+
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(in.x.data() + i);
+        __m128 y = _mm_loadu_ps(in.y.data() + i);
+        __m128 z = _mm_loadu_ps(in.z.data() + i);
+
+        for (int row = 0; row < 4; row++)
+        {
+            __m128 a = _mm_add_ps(_mm_mul_ps(c[0][row], x), _mm_mul_ps(c[1][row], y));
+            __m128 b = _mm_add_ps(_mm_mul_ps(c[2][row], z), c[3][row]);
+            _mm_storeu_ps(o[row] + i, _mm_add_ps(a, b));
+        }
+    }
+    transform_points_scalar(m, in, out, i, end);
+}
+
+__attribute__((target("sse4.1"))) void perspective_divide_sse41(HomogeneousPositions const& in, Positions* out, size_t begin, size_t end)
+{
+    __m128 const zero = _mm_setzero_ps();
+    __m128 const one  = _mm_set1_ps(1.0f);
+
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4)
+    {
+        __m128 w = _mm_loadu_ps(in.w.data() + i);
+        __m128 d = _mm_blendv_ps(one, w, _mm_cmpneq_ps(w, zero));
+
+        _mm_storeu_ps(out->x.data() + i, _mm_div_ps(_mm_loadu_ps(in.x.data() + i), d));
+        _mm_storeu_ps(out->y.data() + i, _mm_div_ps(_mm_loadu_ps(in.y.data() + i), d));
+        _mm_storeu_ps(out->z.data() + i, _mm_div_ps(_mm_loadu_ps(in.z.data() + i), d));
+    }
+    perspective_divide_scalar(in, out, i, end);
+}
+
+// --- AVX2 ---
+
+__attribute__((target("avx2"))) void transform_points_avx2(glm::mat4 const& m, Positions const& in, HomogeneousPositions* out, size_t begin, size_t end)
+{
+    __m256 c[4][4];
+    for (int col = 0; col < 4; col++)
+        for (int row = 0; row < 4; row++)
+            c[col][row] = _mm256_set1_ps(m[col][row]);
+
+    float* o[4] = {out->x.data(), out->y.data(), out->z.data(), out->w.data()};
+
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8)
+    {
+        __m256 x = _mm256_loadu_ps(in.x.data() + i);
+        __m256 y = _mm256_loadu_ps(in.y.data() + i);
+        __m256 z = _mm256_loadu_ps(in.z.data() + i);
+
+        for (int row = 0; row < 4; row++)
+        {
+            __m256 a = _mm256_add_ps(_mm256_mul_ps(c[0][row], x), _mm256_mul_ps(c[1][row], y));
+            __m256 b = _mm256_add_ps(_mm256_mul_ps(c[2][row], z), c[3][row]);
+            _mm256_storeu_ps(o[row] + i, _mm256_add_ps(a, b));
+        }
+    }
+    transform_points_scalar(m, in, out, i, end);
+}
+
+__attribute__((target("avx2"))) void perspective_divide_avx2(HomogeneousPositions const& in, Positions* out, size_t begin, size_t end)
+{
+    __m256 const zero = _mm256_setzero_ps();
+    __m256 const one  = _mm256_set1_ps(1.0f);
+
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8)
+    {
+        __m256 w = _mm256_loadu_ps(in.w.data() + i);
+        __m256 d = _mm256_blendv_ps(one, w, _mm256_cmp_ps(w, zero, _CMP_NEQ_UQ));
+
+        _mm256_storeu_ps(out->x.data() + i, _mm256_div_ps(_mm256_loadu_ps(in.x.data() + i), d));
+        _mm256_storeu_ps(out->y.data() + i, _mm256_div_ps(_mm256_loadu_ps(in.y.data() + i), d));
+        _mm256_storeu_ps(out->z.data() + i, _mm256_div_ps(_mm256_loadu_ps(in.z.data() + i), d));
+    }
+    perspective_divide_scalar(in, out, i, end);
+}
+
+// --- AVX-512 ---
+
+__attribute__((target("avx512f"))) void transform_points_avx512(glm::mat4 const& m, Positions const& in, HomogeneousPositions* out, size_t begin, size_t end)
+{
+    __m512 c[4][4];
+    for (int col = 0; col < 4; col++)
+        for (int row = 0; row < 4; row++)
+            c[col][row] = _mm512_set1_ps(m[col][row]);
+
+    float* o[4] = {out->x.data(), out->y.data(), out->z.data(), out->w.data()};
+
+    __mmask16 const all_lanes = 0xFFFF;
+
+    size_t i = begin;
+    for (; i + 16 <= end; i += 16)
+    {
+        __m512 x = _mm512_loadu_ps(in.x.data() + i);
+        __m512 y = _mm512_loadu_ps(in.y.data() + i);
+        __m512 z = _mm512_loadu_ps(in.z.data() + i);
+
+        // AVX-512 implies FMA, the masked forms keep the compiler from contracting the products
+        for (int row = 0; row < 4; row++)
+        {
+            __m512 a = _mm512_maskz_add_ps(all_lanes, _mm512_maskz_mul_ps(all_lanes, c[0][row], x), _mm512_maskz_mul_ps(all_lanes, c[1][row], y));
+            __m512 b = _mm512_maskz_add_ps(all_lanes, _mm512_maskz_mul_ps(all_lanes, c[2][row], z), c[3][row]);
+            _mm512_storeu_ps(o[row] + i, _mm512_maskz_add_ps(all_lanes, a, b));
+        }
+    }
+    transform_points_scalar(m, in, out, i, end);
+}
+
+__attribute__((target("avx512f"))) void perspective_divide_avx512(HomogeneousPositions const& in, Positions* out, size_t begin, size_t end)
+{
+    __m512 const zero = _mm512_setzero_ps();
+    __m512 const one  = _mm512_set1_ps(1.0f);
+
+    size_t i = begin;
+    for (; i + 16 <= end; i += 16)
+    {
+        __m512    w = _mm512_loadu_ps(in.w.data() + i);
+        __mmask16 k = _mm512_cmp_ps_mask(w, zero, _CMP_NEQ_UQ);
+        __m512    d = _mm512_mask_blend_ps(k, one, w);
+
+        _mm512_storeu_ps(out->x.data() + i, _mm512_div_ps(_mm512_loadu_ps(in.x.data() + i), d));
+        _mm512_storeu_ps(out->y.data() + i, _mm512_div_ps(_mm512_loadu_ps(in.y.data() + i), d));
+        _mm512_storeu_ps(out->z.data() + i, _mm512_div_ps(_mm512_loadu_ps(in.z.data() + i), d));
+    }
+    perspective_divide_scalar(in, out, i, end);
+}
+
+#endif // EX2_SIMD_X86
+
+struct Kernels
+{
+    Isa             isa;
+    TransformKernel transform_points;
+    DivideKernel    perspective_divide;
+};
+
+Kernels kernels_for(Isa isa)
+{
+    switch (isa)
+    {
+#if EX2_SIMD_X86
+    case Isa::AVX512:
+        return {Isa::AVX512, transform_points_avx512, perspective_divide_avx512};
+    case Isa::AVX2:
+        return {Isa::AVX2, transform_points_avx2, perspective_divide_avx2};
+    case Isa::SSE41:
+        return {Isa::SSE41, transform_points_sse41, perspective_divide_sse41};
+#endif
+    default:
+        return {Isa::Scalar, transform_points_scalar, perspective_divide_scalar};
+    }
+}
+
+Kernels& active_kernels()
+{
+    static Kernels kernels = kernels_for(detect_isa());
+    return kernels;
+}
+
+} // namespace
+
+Isa detect_isa()
+{
+#if EX2_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return Isa::AVX512;
+    if (__builtin_cpu_supports("avx2"))
+        return Isa::AVX2;
+    if (__builtin_cpu_supports("sse4.1"))
+        return Isa::SSE41;
+#endif
+    return Isa::Scalar;
+}
+
+Isa active_isa()
+{
+    return active_kernels().isa;
+}
+
+Isa set_active_isa(Isa isa)
+{
+    Isa supported = detect_isa();
+    if (static_cast<int>(isa) > static_cast<int>(supported))
+        isa = supported;
+
+    active_kernels() = kernels_for(isa);
+    return isa;
+}
+
+char const* isa_name(Isa isa)
+{
+    switch (isa)
+    {
+    case Isa::SSE41:
+        return "SSE4.1";
+    case Isa::AVX2:
+        return "AVX2";
+    case Isa::AVX512:
+        return "AVX-512";
+    default:
+        return "Scalar";
+    }
+}
+
+void to_soa(std::span<glm::vec3 const> positions, Positions* out)
+{
+    out->resize(positions.size());
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        out->x[i] = positions[i].x;
+        out->y[i] = positions[i].y;
+        out->z[i] = positions[i].z;
+    }
+}
+
+void to_aos(HomogeneousPositions const& positions, std::span<glm::vec4> out)
+{
+    assert(out.size() >= positions.size());
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        out[i] = glm::vec4(positions.x[i], positions.y[i], positions.z[i], positions.w[i]);
+    }
+}
+
+void to_aos(Positions const& positions, std::span<glm::vec3> out)
+{
+    assert(out.size() >= positions.size());
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        out[i] = glm::vec3(positions.x[i], positions.y[i], positions.z[i]);
+    }
+}
+
+void transform_points(glm::mat4 const& matrix, Positions const& points, HomogeneousPositions* out, size_t begin, size_t end)
+{
+    assert(end <= points.size() && end <= out->size());
+    active_kernels().transform_points(matrix, points, out, begin, end);
+}
+
+void transform_points(glm::mat4 const& matrix, Positions const& points, HomogeneousPositions* out)
+{
+    out->resize(points.size());
+    transform_points(matrix, points, out, 0, points.size());
+}
+
+void perspective_divide(HomogeneousPositions const& points, Positions* out, size_t begin, size_t end)
+{
+    assert(end <= points.size() && end <= out->size());
+    active_kernels().perspective_divide(points, out, begin, end);
+}
+
+void perspective_divide(HomogeneousPositions const& points, Positions* out)
+{
+    out->resize(points.size());
+    perspective_divide(points, out, 0, points.size());
+}
+
+void transform_points_mvp(glm::mat4 const&      model_matrix,
+                          glm::mat4 const&      view_matrix,
+                          glm::mat4 const&      projection_matrix,
+                          Positions const&      points,
+                          HomogeneousPositions* out)
+{
+    transform_points(projection_matrix * view_matrix * model_matrix, points, out);
+}
+
+} // namespace ex2::simd
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace ex2::simd
+{
+
+/**
+ * \brief Instruction set used by the batched transform kernels.
+ */
+enum class Isa
+{
+    Scalar = 0,
+    SSE41,
+    AVX2,
+    AVX512
+};
+
+/**
+ * \brief Vertex positions in structure-of-arrays layout, one contiguous array per coordinate.
+ */
+struct Positions
+{
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+
+    size_t size() const { return x.size(); }
+    void   resize(size_t n)
+    {
+        x.resize(n);
+        y.resize(n);
+        z.resize(n);
+    }
+};
+
+/**
+ * \brief Homogeneous positions (e.g. in clip space) in structure-of-arrays layout.
+ */
+struct HomogeneousPositions
+{
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    std::vector<float> w;
+
+    size_t size() const { return x.size(); }
+    void   resize(size_t n)
+    {
+        x.resize(n);
+        y.resize(n);
+        z.resize(n);
+        w.resize(n);
+    }
+};
+
+/**
+ * \brief The best instruction set supported by the CPU the program is running on.
+ */
+Isa detect_isa();
+
+/**
+ * \brief The instruction set currently used by the kernels. Defaults to \c detect_isa().
+ */
+Isa active_isa();
+
+/**
+ * \brief Override the instruction set used by the kernels, e.g. to compare paths against each other.
+ *
+ * Requests for an instruction set that is not supported by the CPU fall back to the best supported one.
+ *
+ * \return The instruction set that is active after the call
+ */
+Isa set_active_isa(Isa isa);
+
+/**
+ * \brief Human readable name of an instruction set.
+ */
+char const* isa_name(Isa isa);
+
+/**
+ * \brief Convert positions from array-of-structures to structure-of-arrays layout.
+ *
+ * \param[in]  positions The input positions
+ * \param[out] out       The output positions, resized to `positions.size()`
+ */
+void to_soa(std::span<glm::vec3 const> positions, Positions* out);
+
+/**
+ * \brief Convert homogeneous positions from structure-of-arrays to array-of-structures layout.
+ *
+ * \param[in]  positions The input positions
+ * \param[out] out       The output buffer, must hold at least `positions.size()` elements
+ */
+void to_aos(HomogeneousPositions const& positions, std::span<glm::vec4> out);
+
+/**
+ * \brief Convert positions from structure-of-arrays to array-of-structures layout.
+ *
+ * \param[in]  positions The input positions
+ * \param[out] out       The output buffer, must hold at least `positions.size()` elements
+ */
+void to_aos(Positions const& positions, std::span<glm::vec3> out);
+
+/**
+ * \brief Compute `matrix * vec4(p, 1)` for all points `p` in the range [begin, end).
+ *
+ * All instruction sets evaluate the product in the same order of operations as `glm::mat4 * glm::vec4`
+ * and do not use fused multiply-add, so results agree with glm to within a few ULP.
+ *
+ * \param[in]  matrix The transformation matrix
+ * \param[in]  points The input points
+ * \param[out] out    The transformed points, must already have at least `end` elements
+ * \param[in]  begin  First point to transform
+ * \param[in]  end    One past the last point to transform
+ */
+void transform_points(glm::mat4 const& matrix, Positions const& points, HomogeneousPositions* out, size_t begin, size_t end);
+
+/**
+ * \brief Compute `matrix * vec4(p, 1)` for all points, resizing the output as needed.
+ */
+void transform_points(glm::mat4 const& matrix, Positions const& points, HomogeneousPositions* out);
+
+/**
+ * \brief Divide the xyz coordinates of all points in the range [begin, end) by w.
+ *
+ * Points with `w == 0` are passed through undivided, like the loops in main.cpp do.
+ *
+ * \param[in]  points The homogeneous input points
+ * \param[out] out    The divided points, must already have at least `end` elements
+ * \param[in]  begin  First point to divide
+ * \param[in]  end    One past the last point to divide
+ */
+void perspective_divide(HomogeneousPositions const& points, Positions* out, size_t begin, size_t end);
+
+/**
+ * \brief Divide the xyz coordinates of all points by w, resizing the output as needed.
+ */
+void perspective_divide(HomogeneousPositions const& points, Positions* out);
+
+/**
+ * \brief Transform points by the combined `projection * view * model` matrix.
+ *
+ * The matrix product is computed once, every point is then transformed by a single matrix.
+ *
+ * \param[in]  model_matrix      The model matrix
+ * \param[in]  view_matrix       The view matrix
+ * \param[in]  projection_matrix The projection matrix
+ * \param[in]  points            The input points in model space
+ * \param[out] out               The points in clip space, resized to `points.size()`
+ */
+void transform_points_mvp(glm::mat4 const&      model_matrix,
+                          glm::mat4 const&      view_matrix,
+                          glm::mat4 const&      projection_matrix,
+                          Positions const&      points,
+                          HomogeneousPositions* out);
+
+} // namespace ex2::simd
@@ -0,0 +1,595 @@
+#include "software_rasterizer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+#include "simd_transform.hpp"
+#include "thread_pool.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define EX2_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define EX2_SIMD_X86 0
+#endif
+
+namespace ex2
+{
+
+namespace
+{
+
+using TriangleSetup = SoftwareRenderer::TriangleSetup;
+using TileKernel    = void (*)(TriangleSetup const&, glm::ivec4 const&, Framebuffer*);
+
+constexpr size_t setup_parallel_threshold = 1 << 12;
+constexpr size_t setup_chunk_size         = 1 << 10;
+constexpr float  inside_epsilon           = -1e-5f; //!< Slack of the edge test, so edges shared by two triangles leave no gaps
+constexpr float  line_depth_bias          = 1e-4f;  //!< Lines on a surface are drawn in front of it
+constexpr float  ambient                  = 0.3f;
+
+uint32_t pack_color(glm::vec3 const& color)
+{
+    glm::vec3 c = glm::clamp(color, 0.f, 1.f) * 255.f + 0.5f;
+    return static_cast<uint32_t>(c.x) | (static_cast<uint32_t>(c.y) << 8) | (static_cast<uint32_t>(c.z) << 16) | 0xFF000000u;
+}
+
+TriangleSetup setup_triangle(glm::vec3 const (&ndc)[3], glm::vec3 const (&shading)[3], glm::vec2 const& scale, glm::vec2 const& offset, glm::ivec4 const& rect_bounds, glm::vec3 const& color)
+{
+    TriangleSetup setup{};
+
+    glm::vec3 s[3];
+    for (int k = 0; k < 3; k++)
+        s[k] = glm::vec3(offset.x + ndc[k].x * scale.x, offset.y - ndc[k].y * scale.y, 0.5f * ndc[k].z + 0.5f);
+
+    float area = (s[1].x - s[0].x) * (s[2].y - s[0].y) - (s[1].y - s[0].y) * (s[2].x - s[0].x);
+    if (!(std::abs(area) > 1e-12f))
+        return setup;
+
+    // Pixel centers (x + 0.5, y + 0.5) within the bounding box of the triangle
+    glm::vec2 lower = glm::min(glm::min(glm::vec2(s[0]), glm::vec2(s[1])), glm::vec2(s[2]));
+    glm::vec2 upper = glm::max(glm::max(glm::vec2(s[0]), glm::vec2(s[1])), glm::vec2(s[2]));
+    setup.bounds    = glm::ivec4(std::max(rect_bounds.x, static_cast<int>(std::ceil(lower.x - 0.5f))),
+                                 std::max(rect_bounds.y, static_cast<int>(std::ceil(lower.y - 0.5f))),
+                                 std::min(rect_bounds.z, static_cast<int>(std::floor(upper.x - 0.5f))),
+                                 std::min(rect_bounds.w, static_cast<int>(std::floor(upper.y - 0.5f))));
+    if (setup.bounds.x > setup.bounds.z || setup.bounds.y > setup.bounds.w)
+        return setup;
+
+    // Edge function i is the barycentric coordinate of vertex i, which is 1 at vertex i and 0 on the opposite edge
+    for (int i = 0; i < 3; i++)
+    {
+        glm::vec3 const& a = s[(i + 1) % 3];
+        glm::vec3 const& b = s[(i + 2) % 3];
+        setup.edge_a[i]    = -(b.y - a.y) / area;
+        setup.edge_b[i]    = (b.x - a.x) / area;
+        setup.edge_c[i]    = ((b.y - a.y) * a.x - (b.x - a.x) * a.y) / area;
+    }
+
+    glm::vec3 z = glm::vec3(s[0].z, s[1].z, s[2].z);
+    setup.depth = glm::vec3(glm::dot(setup.edge_a, z), glm::dot(setup.edge_b, z), glm::dot(setup.edge_c, z));
+
+    glm::vec3 normal = glm::cross(shading[1] - shading[0], shading[2] - shading[0]);
+    float     length = glm::length(normal);
+    float     facing = length > 0.f ? std::abs(normal.z) / length : 1.f;
+    setup.color      = pack_color(color * (ambient + (1.f - ambient) * facing));
+    setup.valid      = true;
+    return setup;
+}
+
+// --- Scalar ---
+
+void rasterize_tile_scalar(TriangleSetup const& setup, glm::ivec4 const& region, Framebuffer* framebuffer)
+{
+    for (int y = region.y; y <= region.w; y++)
+    {
+        uint32_t* color = framebuffer->color_row(y);
+        float*    depth = framebuffer->depth_row(y);
+        float     py    = static_cast<float>(y) + 0.5f;
+
+        // The terms of the row are summed first, in the same order as by the SSE4.1 kernel, so both produce the same image
+        glm::vec3 row   = setup.edge_b * py + setup.edge_c;
+        float     row_z = setup.depth.y * py + setup.depth.z;
+
+        for (int x = region.x; x <= region.z; x++)
+        {
+            float     px = static_cast<float>(x) + 0.5f;
+            glm::vec3 l  = setup.edge_a * px + row;
+            if (l.x < inside_epsilon || l.y < inside_epsilon || l.z < inside_epsilon)
+                continue;
+
+            float z = setup.depth.x * px + row_z;
+            if (z < depth[x])
+            {
+                depth[x] = z;
+                color[x] = setup.color;
+            }
+        }
+    }
+}
+
+#if EX2_SIMD_X86
+
+// --- SSE4.1 ---
+
+__attribute__((target("sse4.1"))) void rasterize_tile_sse41(TriangleSetup const& setup, glm::ivec4 const& region, Framebuffer* framebuffer)
+{
+    __m128 const  lane_offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    __m128i const lane_indices = _mm_setr_epi32(0, 1, 2, 3);
+    __m128 const  epsilon      = _mm_set1_ps(inside_epsilon);
+    __m128 const  color        = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(setup.color)));
+    __m128i const first        = _mm_set1_epi32(region.x - 1);
+    __m128i const last         = _mm_set1_epi32(region.z + 1);
+
+    __m128 const a0 = _mm_set1_ps(setup.edge_a.x);
+    __m128 const a1 = _mm_set1_ps(setup.edge_a.y);
+    __m128 const a2 = _mm_set1_ps(setup.edge_a.z);
+    __m128 const az = _mm_set1_ps(setup.depth.x);
+
+    // Groups of four pixels start at multiples of four, which never cross a tile boundary, so the lanes outside the
+    // region can be written back unchanged without touching pixels of other threads
+    int const x_begin = region.x & ~3;
+
+    for (int y = region.y; y <= region.w; y++)
+    {
+        uint32_t* color_row = framebuffer->color_row(y);
+        float*    depth_row = framebuffer->depth_row(y);
+        float     py        = static_cast<float>(y) + 0.5f;
+
+        __m128 const row0 = _mm_set1_ps(setup.edge_b.x * py + setup.edge_c.x);
+        __m128 const row1 = _mm_set1_ps(setup.edge_b.y * py + setup.edge_c.y);
+        __m128 const row2 = _mm_set1_ps(setup.edge_b.z * py + setup.edge_c.z);
+        __m128 const rowz = _mm_set1_ps(setup.depth.y * py + setup.depth.z);
+
+        for (int x = x_begin; x <= region.z; x += 4)
+        {
+            __m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), lane_offsets);
+
+            __m128 l0     = _mm_add_ps(_mm_mul_ps(a0, px), row0);
+            __m128 l1     = _mm_add_ps(_mm_mul_ps(a1, px), row1);
+            __m128 l2     = _mm_add_ps(_mm_mul_ps(a2, px), row2);
+            __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(l0, epsilon), _mm_cmpge_ps(l1, epsilon)), _mm_cmpge_ps(l2, epsilon));
+
+            __m128i xi       = _mm_add_epi32(_mm_set1_epi32(x), lane_indices);
+            __m128i in_range = _mm_and_si128(_mm_cmpgt_epi32(xi, first), _mm_cmplt_epi32(xi, last));
+
+            float* depth     = depth_row + x;
+            __m128 z         = _mm_add_ps(_mm_mul_ps(az, px), rowz);
+            __m128 old_depth = _mm_loadu_ps(depth);
+            __m128 mask      = _mm_and_ps(_mm_and_ps(inside, _mm_castsi128_ps(in_range)), _mm_cmplt_ps(z, old_depth));
+            if (_mm_movemask_ps(mask) == 0)
+                continue;
+
+            __m128i* pixels    = reinterpret_cast<__m128i*>(color_row + x);
+            __m128   old_color = _mm_castsi128_ps(_mm_loadu_si128(pixels));
+            _mm_storeu_ps(depth, _mm_blendv_ps(old_depth, z, mask));
+            _mm_storeu_si128(pixels, _mm_castps_si128(_mm_blendv_ps(old_color, color, mask)));
+        }
+    }
+}
+
+#endif // EX2_SIMD_X86
+
+TileKernel active_tile_kernel()
+{
+#if EX2_SIMD_X86
+    if (simd::active_isa() != simd::Isa::Scalar)
+        return rasterize_tile_sse41;
+#endif
+    return rasterize_tile_scalar;
+}
+
+// --- Image output ---
+
+class Crc32
+{
+public:
+    Crc32()
+    {
+        for (uint32_t n = 0; n < 256; n++)
+        {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++)
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            m_table[n] = c;
+        }
+    }
+
+    uint32_t update(uint32_t crc, uint8_t const* data, size_t size) const
+    {
+        crc = ~crc;
+        for (size_t i = 0; i < size; i++)
+            crc = m_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        return ~crc;
+    }
+
+private:
+    std::array<uint32_t, 256> m_table;
+};
+
+void append_u32(std::vector<uint8_t>* out, uint32_t value)
+{
+    out->push_back(static_cast<uint8_t>(value >> 24));
+    out->push_back(static_cast<uint8_t>(value >> 16));
+    out->push_back(static_cast<uint8_t>(value >> 8));
+    out->push_back(static_cast<uint8_t>(value));
+}
+
+void write_png_chunk(std::ostream& out, char const (&type)[5], std::vector<uint8_t> const& data)
+{
+    static Crc32 const crc32;
+
+    std::vector<uint8_t> chunk(type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+
+    std::vector<uint8_t> header;
+    append_u32(&header, static_cast<uint32_t>(data.size()));
+    std::vector<uint8_t> footer;
+    append_u32(&footer, crc32.update(0, chunk.data(), chunk.size()));
+
+    out.write(reinterpret_cast<char const*>(header.data()), static_cast<std::streamsize>(header.size()));
+    out.write(reinterpret_cast<char const*>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+    out.write(reinterpret_cast<char const*>(footer.data()), static_cast<std::streamsize>(footer.size()));
+}
+
+/**
+ * Write an 8-bit RGB PNG. The image data is stored in uncompressed deflate blocks, which keeps the writer free of a
+ * compression library at the cost of the file size.
+ */
+void write_png(std::ostream& out, Framebuffer const& framebuffer)
+{
+    int width  = framebuffer.width();
+    int height = framebuffer.height();
+
+    // Every row starts with filter type 0 (none)
+    std::vector<uint8_t> raw;
+    raw.reserve(static_cast<size_t>(height) * (3 * static_cast<size_t>(width) + 1));
+    for (int y = 0; y < height; y++)
+    {
+        raw.push_back(0);
+        uint32_t const* row = framebuffer.color_row(y);
+        for (int x = 0; x < width; x++)
+        {
+            raw.push_back(static_cast<uint8_t>(row[x]));
+            raw.push_back(static_cast<uint8_t>(row[x] >> 8));
+            raw.push_back(static_cast<uint8_t>(row[x] >> 16));
+        }
+    }
+
+    constexpr size_t max_block_size = 65535;
+
+    std::vector<uint8_t> zlib = {0x78, 0x01};
+    size_t               offset = 0;
+    do
+    {
+        size_t size = std::min(max_block_size, raw.size() - offset);
+        bool   last = offset + size == raw.size();
+        zlib.push_back(last ? 1 : 0);
+        zlib.push_back(static_cast<uint8_t>(size));
+        zlib.push_back(static_cast<uint8_t>(size >> 8));
+        zlib.push_back(static_cast<uint8_t>(~size));
+        zlib.push_back(static_cast<uint8_t>(~size >> 8));
+        zlib.insert(zlib.end(), raw.begin() + static_cast<std::ptrdiff_t>(offset), raw.begin() + static_cast<std::ptrdiff_t>(offset + size));
+        offset += size;
+    } while (offset < raw.size());
+
+    uint32_t adler_a = 1;
+    uint32_t adler_b = 0;
+    for (uint8_t byte : raw)
+    {
+        adler_a = (adler_a + byte) % 65521;
+        adler_b = (adler_b + adler_a) % 65521;
+    }
+    append_u32(&zlib, (adler_b << 16) | adler_a);
+
+    std::vector<uint8_t> header;
+    append_u32(&header, static_cast<uint32_t>(width));
+    append_u32(&header, static_cast<uint32_t>(height));
+    header.insert(header.end(), {8, 2, 0, 0, 0}); // 8 bits per channel, RGB, deflate, adaptive filtering, no interlace
+
+    static uint8_t const signature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    out.write(reinterpret_cast<char const*>(signature), sizeof(signature));
+    write_png_chunk(out, "IHDR", header);
+    write_png_chunk(out, "IDAT", zlib);
+    write_png_chunk(out, "IEND", {});
+}
+
+void write_ppm(std::ostream& out, Framebuffer const& framebuffer)
+{
+    out << "P6\n"
+        << framebuffer.width() << " " << framebuffer.height() << "\n255\n";
+
+    std::vector<uint8_t> row(3 * static_cast<size_t>(framebuffer.width()));
+    for (int y = 0; y < framebuffer.height(); y++)
+    {
+        uint32_t const* pixels = framebuffer.color_row(y);
+        for (int x = 0; x < framebuffer.width(); x++)
+        {
+            row[3 * x]     = static_cast<uint8_t>(pixels[x]);
+            row[3 * x + 1] = static_cast<uint8_t>(pixels[x] >> 8);
+            row[3 * x + 2] = static_cast<uint8_t>(pixels[x] >> 16);
+        }
+        out.write(reinterpret_cast<char const*>(row.data()), static_cast<std::streamsize>(row.size()));
+    }
+}
+
+bool ends_with(std::string const& text, std::string const& suffix)
+{
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+} // namespace
+
+Framebuffer::Framebuffer(int width, int height) :
+    m_width(std::max(width, 0)),
+    m_height(std::max(height, 0)),
+    m_pitch((static_cast<size_t>(m_width) + 3) & ~size_t(3)),
+    m_color(m_pitch * static_cast<size_t>(m_height), 0xFF000000u),
+    m_depth(m_pitch * static_cast<size_t>(m_height), 1.f)
+{
+}
+
+bool write_image(Framebuffer const& framebuffer, std::string const& path)
+{
+    bool is_png = ends_with(path, ".png");
+    if (!is_png && !ends_with(path, ".ppm"))
+    {
+        std::cerr << "Unknown image format of '" << path << "', expected .png or .ppm" << std::endl;
+        return false;
+    }
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out)
+    {
+        std::cerr << "Failed to open '" << path << "' for writing" << std::endl;
+        return false;
+    }
+
+    if (is_png)
+        write_png(out, framebuffer);
+    else
+        write_ppm(out, framebuffer);
+
+    if (!out)
+    {
+        std::cerr << "Failed to write '" << path << "'" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+SoftwareRenderer::SoftwareRenderer(Framebuffer* framebuffer, glm::vec4 const& viewport) :
+    m_framebuffer(framebuffer),
+    m_viewport(viewport)
+{
+}
+
+SoftwareRenderer::PixelRect SoftwareRenderer::pixel_rect() const
+{
+    float width  = static_cast<float>(m_framebuffer->width());
+    float height = static_cast<float>(m_framebuffer->height());
+
+    // The viewport has y from the bottom, the framebuffer stores rows from the top
+    int left   = std::clamp(static_cast<int>(std::lround(m_viewport.x * width)), 0, m_framebuffer->width());
+    int right  = std::clamp(static_cast<int>(std::lround((m_viewport.x + m_viewport.z) * width)), left, m_framebuffer->width());
+    int top    = std::clamp(m_framebuffer->height() - static_cast<int>(std::lround((m_viewport.y + m_viewport.w) * height)), 0, m_framebuffer->height());
+    int bottom = std::clamp(m_framebuffer->height() - static_cast<int>(std::lround(m_viewport.y * height)), top, m_framebuffer->height());
+
+    return PixelRect{left, top, right - left, bottom - top};
+}
+
+void SoftwareRenderer::clear(glm::vec3 const& color)
+{
+    PixelRect rect   = pixel_rect();
+    uint32_t  packed = pack_color(color);
+
+    for (int y = rect.y; y < rect.y + rect.height; y++)
+    {
+        std::fill_n(m_framebuffer->color_row(y) + rect.x, rect.width, packed);
+        std::fill_n(m_framebuffer->depth_row(y) + rect.x, rect.width, 1.f);
+    }
+}
+
+void SoftwareRenderer::set_camera(glm::mat4 const& view_matrix, glm::mat4 const& projection_matrix)
+{
+    m_view_matrix               = view_matrix;
+    m_projection_matrix         = projection_matrix;
+    m_inverse_projection_matrix = glm::inverse(projection_matrix);
+}
+
+void SoftwareRenderer::set_camera(Camera<float> const& camera)
+{
+    m_view_matrix               = camera.view_matrix();
+    m_projection_matrix         = camera.projection_matrix();
+    m_inverse_projection_matrix = camera.inverse_projection_matrix();
+}
+
+void SoftwareRenderer::render_mesh(std::span<glm::vec3 const> positions, std::span<glm::u32vec3 const> faces, glm::vec3 const& color)
+{
+    m_transform.run(positions, m_view_matrix, m_projection_matrix);
+    m_clipper.run(m_transform.clip(), m_transform.ndc(), faces, ClipOptions{});
+    m_stats.submitted_triangles += faces.size();
+
+    // Shade in view space, where the depth is not compressed like in NDC
+    rasterize(m_clipper.clip(), m_clipper.ndc(), m_clipper.indices(), color, m_inverse_projection_matrix);
+}
+
+void SoftwareRenderer::render_mesh(std::span<glm::vec4 const> clip_positions, std::span<glm::u32vec3 const> faces, glm::vec3 const& color)
+{
+    m_ndc.resize(clip_positions.size());
+    for (size_t i = 0; i < clip_positions.size(); i++)
+    {
+        glm::vec4 const& p = clip_positions[i];
+        m_ndc[i]           = p.w != 0.f ? glm::vec3(p) / p.w : glm::vec3(p);
+    }
+
+    m_clipper.run(clip_positions, m_ndc, faces, ClipOptions{});
+    m_stats.submitted_triangles += faces.size();
+    rasterize(m_clipper.clip(), m_clipper.ndc(), m_clipper.indices(), color, glm::mat4(1.f));
+}
+
+void SoftwareRenderer::render_lines(std::span<glm::vec3 const> positions, std::span<glm::vec3 const> colors)
+{
+    PixelRect rect                   = pixel_rect();
+    glm::mat4 view_projection_matrix = m_projection_matrix * m_view_matrix;
+
+    size_t line_count = std::min(positions.size() / 2, colors.size());
+    for (size_t i = 0; i < line_count; i++)
+    {
+        draw_line(view_projection_matrix * glm::vec4(positions[2 * i], 1.f),
+                  view_projection_matrix * glm::vec4(positions[2 * i + 1], 1.f),
+                  pack_color(colors[i]), rect);
+    }
+    m_stats.lines += line_count;
+}
+
+void SoftwareRenderer::render_lines(std::span<glm::vec4 const> clip_positions, std::span<glm::vec3 const> colors)
+{
+    PixelRect rect = pixel_rect();
+
+    size_t line_count = std::min(clip_positions.size() / 2, colors.size());
+    for (size_t i = 0; i < line_count; i++)
+        draw_line(clip_positions[2 * i], clip_positions[2 * i + 1], pack_color(colors[i]), rect);
+    m_stats.lines += line_count;
+}
+
+void SoftwareRenderer::rasterize(std::span<glm::vec4 const> clip, std::span<glm::vec3 const> ndc, std::span<glm::u32vec3 const> faces, glm::vec3 const& color, glm::mat4 const& shading_matrix)
+{
+    PixelRect rect = pixel_rect();
+    if (rect.width <= 0 || rect.height <= 0 || faces.empty())
+        return;
+
+    glm::vec2  scale       = 0.5f * glm::vec2(static_cast<float>(rect.width), static_cast<float>(rect.height));
+    glm::vec2  offset      = glm::vec2(static_cast<float>(rect.x), static_cast<float>(rect.y)) + scale;
+    glm::ivec4 rect_bounds = glm::ivec4(rect.x, rect.y, rect.x + rect.width - 1, rect.y + rect.height - 1);
+
+    m_setups.resize(faces.size());
+    parallel_for(faces.size(), setup_parallel_threshold, setup_chunk_size, [&](size_t begin, size_t end) {
+        for (size_t t = begin; t < end; t++)
+        {
+            glm::vec3 triangle[3];
+            glm::vec3 shading[3];
+            for (int k = 0; k < 3; k++)
+            {
+                glm::vec4 p = shading_matrix * clip[faces[t][k]];
+                triangle[k] = ndc[faces[t][k]];
+                shading[k]  = glm::vec3(p) / p.w;
+            }
+            m_setups[t] = setup_triangle(triangle, shading, scale, offset, rect_bounds, color);
+        }
+    });
+
+    // Tiles follow a grid over the whole framebuffer, so that tiles of one viewport never share a group of four pixels
+    int first_tile_x = rect_bounds.x / tile_size;
+    int first_tile_y = rect_bounds.y / tile_size;
+    int tiles_x      = rect_bounds.z / tile_size - first_tile_x + 1;
+    int tiles_y      = rect_bounds.w / tile_size - first_tile_y + 1;
+
+    m_bins.resize(static_cast<size_t>(tiles_x) * static_cast<size_t>(tiles_y));
+    for (std::vector<uint32_t>& bin : m_bins)
+        bin.clear();
+
+    for (size_t t = 0; t < m_setups.size(); t++)
+    {
+        TriangleSetup const& setup = m_setups[t];
+        if (!setup.valid)
+            continue;
+
+        m_stats.rasterized_triangles++;
+        for (int ty = setup.bounds.y / tile_size; ty <= setup.bounds.w / tile_size; ty++)
+        {
+            for (int tx = setup.bounds.x / tile_size; tx <= setup.bounds.z / tile_size; tx++)
+            {
+                m_bins[static_cast<size_t>(ty - first_tile_y) * tiles_x + (tx - first_tile_x)].push_back(static_cast<uint32_t>(t));
+                m_stats.binned_triangles++;
+            }
+        }
+    }
+
+    // Every tile is rasterized by one thread, in submission order, so the result does not depend on the thread count
+    TileKernel kernel = active_tile_kernel();
+    parallel_for(m_bins.size(), 2, 1, [&](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; b++)
+        {
+            int        tx   = first_tile_x + static_cast<int>(b % tiles_x);
+            int        ty   = first_tile_y + static_cast<int>(b / tiles_x);
+            glm::ivec4 tile = glm::ivec4(std::max(rect_bounds.x, tx * tile_size),
+                                         std::max(rect_bounds.y, ty * tile_size),
+                                         std::min(rect_bounds.z, (tx + 1) * tile_size - 1),
+                                         std::min(rect_bounds.w, (ty + 1) * tile_size - 1));
+
+            for (uint32_t t : m_bins[b])
+            {
+                TriangleSetup const& setup  = m_setups[t];
+                glm::ivec4           region = glm::ivec4(std::max(tile.x, setup.bounds.x),
+                                                         std::max(tile.y, setup.bounds.y),
+                                                         std::min(tile.z, setup.bounds.z),
+                                                         std::min(tile.w, setup.bounds.w));
+                kernel(setup, region, m_framebuffer);
+            }
+        }
+    });
+}
+
+void SoftwareRenderer::draw_line(glm::vec4 a, glm::vec4 b, uint32_t color, PixelRect const& rect)
+{
+    // Clip the line against the six planes of the view volume in homogeneous coordinates (Liang-Barsky)
+    float t_begin = 0.f;
+    float t_end   = 1.f;
+    for (int axis = 0; axis < 3; axis++)
+    {
+        for (float sign : {1.f, -1.f})
+        {
+            float da = a.w + sign * a[axis];
+            float db = b.w + sign * b[axis];
+            if (da < 0.f && db < 0.f)
+                return;
+            if (da < 0.f)
+                t_begin = std::max(t_begin, da / (da - db));
+            else if (db < 0.f)
+                t_end = std::min(t_end, da / (da - db));
+        }
+    }
+    if (t_begin > t_end)
+        return;
+
+    glm::vec4 clipped_a = a + t_begin * (b - a);
+    glm::vec4 clipped_b = a + t_end * (b - a);
+    if (clipped_a.w <= 0.f || clipped_b.w <= 0.f)
+        return;
+
+    auto to_screen = [&rect](glm::vec4 const& p) {
+        glm::vec3 ndc = glm::vec3(p) / p.w;
+        return glm::vec3(static_cast<float>(rect.x) + (0.5f + 0.5f * ndc.x) * static_cast<float>(rect.width),
+                         static_cast<float>(rect.y) + (0.5f - 0.5f * ndc.y) * static_cast<float>(rect.height),
+                         0.5f * ndc.z + 0.5f);
+    };
+    glm::vec3 begin = to_screen(clipped_a);
+    glm::vec3 end   = to_screen(clipped_b);
+
+    // Depth is linear in screen space after the perspective divide, so it is interpolated along with x and y
+    glm::vec3 delta = end - begin;
+    int       steps = std::max(1, static_cast<int>(std::ceil(std::max(std::abs(delta.x), std::abs(delta.y)))));
+    glm::vec3 step  = delta / static_cast<float>(steps);
+    glm::vec3 p     = begin;
+    for (int i = 0; i <= steps; i++, p += step)
+    {
+        int x = static_cast<int>(std::floor(p.x));
+        int y = static_cast<int>(std::floor(p.y));
+        if (x < rect.x || x >= rect.x + rect.width || y < rect.y || y >= rect.y + rect.height)
+            continue;
+
+        float& depth = m_framebuffer->depth_row(y)[x];
+        if (p.z - line_depth_bias <= depth)
+        {
+            depth                          = std::min(depth, p.z);
+            m_framebuffer->color_row(y)[x] = color;
+        }
+    }
+}
+
+} // namespace ex2
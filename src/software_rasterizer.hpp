@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "camera_math.hpp"
+#include "transform_pipeline.hpp"
+#include "triangle_clipper.hpp"
+
+namespace ex2
+{
+
+/**
+ * \brief An RGBA8 color buffer with a depth buffer, stored row by row from the top.
+ *
+ * Rows are padded to a multiple of four pixels, so the rasterizer can always access four pixels at once.
+ */
+class Framebuffer
+{
+public:
+    Framebuffer(int width, int height);
+
+    int    width() const { return m_width; }
+    int    height() const { return m_height; }
+    size_t pitch() const { return m_pitch; } //!< Pixels from one row to the next
+
+    uint32_t*       color_row(int y) { return m_color.data() + static_cast<size_t>(y) * m_pitch; }
+    uint32_t const* color_row(int y) const { return m_color.data() + static_cast<size_t>(y) * m_pitch; }
+    float*          depth_row(int y) { return m_depth.data() + static_cast<size_t>(y) * m_pitch; }
+    float const*    depth_row(int y) const { return m_depth.data() + static_cast<size_t>(y) * m_pitch; }
+
+    //! The color of a pixel, with 8 bits per channel as `0xAABBGGRR`
+    uint32_t pixel(int x, int y) const { return color_row(y)[x]; }
+
+private:
+    int                   m_width;
+    int                   m_height;
+    size_t                m_pitch;
+    std::vector<uint32_t> m_color;
+    std::vector<float>    m_depth;
+};
+
+/**
+ * \brief Write the color buffer as PNG or binary PPM, chosen by the extension of \c path (`.png` or `.ppm`).
+ *
+ * \return true on success, false if the format is unknown or the file could not be written (an error is printed to stderr)
+ */
+bool write_image(Framebuffer const& framebuffer, std::string const& path);
+
+/**
+ * \brief Renders meshes and lines into a viewport of a \c Framebuffer on the CPU, for machines without a GPU.
+ *
+ * It offers the drawing functions of \c cgtub::SimpleRenderer for positions in world space, which are projected with
+ * the camera set by \c set_camera(...), and of \c cgtub::NDCRenderer for positions in clip space. Triangles are clipped
+ * to the view volume, flat shaded by their orientation to the viewer and drawn with a depth test, on both sides.
+ *
+ * Triangles are set up in parallel and binned into screen tiles of \c tile_size pixels, which are then rasterized in
+ * parallel on the default thread pool. Within a tile, the edge functions are evaluated for four pixels at once with
+ * SSE4.1 if \c simd::active_isa() supports it, in the same order of operations as the scalar path, so both produce the
+ * same image. Lines are few and drawn serially.
+ */
+class SoftwareRenderer
+{
+public:
+    static constexpr int tile_size = 64;
+
+    struct Stats
+    {
+        size_t submitted_triangles  = 0; //!< Triangles passed to render_mesh(...)
+        size_t rasterized_triangles = 0; //!< Triangles left after clipping and dropping degenerate ones
+        size_t binned_triangles     = 0; //!< Sum of the triangles in all tiles
+        size_t lines                = 0; //!< Lines passed to render_lines(...)
+    };
+
+    /**
+     * \param[in] framebuffer The framebuffer to render to, which must outlive the renderer
+     * \param[in] viewport    The part of the framebuffer to render to as (x, y, width, height), in fractions of the
+     *                        framebuffer size with y from the bottom, like the viewports of \c cgtub::Canvas
+     */
+    SoftwareRenderer(Framebuffer* framebuffer, glm::vec4 const& viewport);
+
+    /**
+     * \brief Clear the color of the viewport and reset its depth.
+     */
+    void clear(glm::vec3 const& color);
+
+    /**
+     * \brief Set the camera used to project positions in world space.
+     *
+     * The inverse projection, used for shading, is computed here once instead of for every mesh.
+     */
+    void set_camera(glm::mat4 const& view_matrix, glm::mat4 const& projection_matrix);
+
+    /**
+     * \brief Set the camera used to project positions in world space, with the inverse projection it already holds.
+     */
+    void set_camera(Camera<float> const& camera);
+
+    void render_mesh(std::span<glm::vec3 const> positions, std::span<glm::u32vec3 const> faces, glm::vec3 const& color);
+    void render_mesh(std::span<glm::vec4 const> clip_positions, std::span<glm::u32vec3 const> faces, glm::vec3 const& color);
+
+    /**
+     * \brief Render lines between consecutive pairs of positions, with one color per line.
+     */
+    void render_lines(std::span<glm::vec3 const> positions, std::span<glm::vec3 const> colors);
+    void render_lines(std::span<glm::vec4 const> clip_positions, std::span<glm::vec3 const> colors);
+
+    //! Statistics accumulated since construction
+    Stats const& stats() const { return m_stats; }
+
+    /**
+     * \brief Per-triangle data of the rasterizer: edge functions normalized to barycentric coordinates and the depth plane.
+     */
+    struct TriangleSetup
+    {
+        glm::vec3  edge_a; //!< x coefficients of the three edge functions
+        glm::vec3  edge_b; //!< y coefficients
+        glm::vec3  edge_c; //!< Constant terms
+        glm::vec3  depth;  //!< Depth as `depth.x * x + depth.y * y + depth.z`
+        glm::ivec4 bounds; //!< Pixel bounds (min x, min y, max x, max y), inclusive
+        uint32_t   color;
+        bool       valid;
+    };
+
+private:
+    struct PixelRect
+    {
+        int x      = 0;
+        int y      = 0;
+        int width  = 0;
+        int height = 0;
+    };
+
+    PixelRect pixel_rect() const;
+    void      rasterize(std::span<glm::vec4 const> clip, std::span<glm::vec3 const> ndc, std::span<glm::u32vec3 const> faces, glm::vec3 const& color, glm::mat4 const& shading_matrix);
+    void      draw_line(glm::vec4 a, glm::vec4 b, uint32_t color, PixelRect const& rect);
+
+    Framebuffer* m_framebuffer;
+    glm::vec4    m_viewport;
+    glm::mat4    m_view_matrix               = glm::mat4(1.f);
+    glm::mat4    m_projection_matrix         = glm::mat4(1.f);
+    glm::mat4    m_inverse_projection_matrix = glm::mat4(1.f);
+
+    TransformPipeline                  m_transform;
+    TriangleClipper                    m_clipper;
+    std::vector<glm::vec3>             m_ndc;
+    std::vector<TriangleSetup>         m_setups;
+    std::vector<std::vector<uint32_t>> m_bins;
+
+    Stats m_stats;
+};
+
+} // namespace ex2
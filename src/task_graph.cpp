@@ -0,0 +1,64 @@
+#include "task_graph.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+#include "thread_pool.hpp"
+
+namespace ex2
+{
+
+TaskGraph::Task& TaskGraph::add_task(std::initializer_list<TaskId> dependencies, bool uses_pool)
+{
+    uint32_t wave = 0;
+    for (TaskId dependency : dependencies)
+    {
+        if (dependency == none)
+            continue;
+
+        assert(dependency < m_tasks.size());
+        wave = std::max(wave, m_tasks[dependency].wave + 1);
+    }
+
+    Task& task     = m_tasks.emplace_back();
+    task.wave      = wave;
+    task.uses_pool = uses_pool;
+    m_wave_count   = std::max(m_wave_count, wave + 1);
+    return task;
+}
+
+void TaskGraph::run()
+{
+    for (uint32_t wave = 0; wave < m_wave_count; wave++)
+    {
+        m_wave_tasks.clear();
+        for (TaskId id = 0; id < m_tasks.size(); id++)
+        {
+            if (m_tasks[id].wave == wave && !m_tasks[id].uses_pool)
+                m_wave_tasks.push_back(id);
+        }
+
+        // A single task runs on the calling thread without waking up the workers
+        parallel_for(m_wave_tasks.size(), 2, 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+            {
+                Task const& task = m_tasks[m_wave_tasks[i]];
+                task.call(task.work);
+            }
+        });
+
+        for (Task const& task : m_tasks)
+        {
+            if (task.wave == wave && task.uses_pool)
+                task.call(task.work);
+        }
+    }
+}
+
+void TaskGraph::clear()
+{
+    m_tasks.clear();
+    m_wave_count = 0;
+}
+
+} // namespace ex2
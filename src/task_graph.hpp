@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace ex2
+{
+
+/**
+ * \brief A set of tasks with dependencies between them, run on the default thread pool.
+ *
+ * Tasks can only depend on tasks added before them, so the graph is acyclic by construction. \c run() executes the
+ * graph in waves: a wave contains the tasks whose longest chain of dependencies has the same length, so all tasks of a
+ * wave only depend on tasks of earlier waves and can run concurrently.
+ *
+ * The thread pool runs nested loops serially, so tasks that use \c parallel_for(...) themselves are marked as such and
+ * run one after another on the calling thread, where their loops get the whole pool. All other tasks of a wave are
+ * spread over the pool first, so a wave takes as long as its slowest other task plus all of its pool tasks.
+ *
+ * Every wave is a barrier: a task waits for all tasks of the earlier waves, not only for its dependencies, and a pool
+ * task without dependencies does not overlap the other tasks of its wave. The graph is meant for a handful of tasks per
+ * frame, where this costs less than tracking the dependencies of every task.
+ *
+ * The work of a task is stored in the task itself, so adding tasks does not allocate once the graph has grown to its
+ * size in a previous frame.
+ */
+class TaskGraph
+{
+public:
+    using TaskId = uint32_t;
+
+    //! A dependency on \c none is ignored, e.g. for stages that were not scheduled
+    static constexpr TaskId none = ~TaskId(0);
+
+    //! Largest size of the work of a task, e.g. a lambda capturing a few pointers and values
+    static constexpr size_t max_work_size = 48;
+
+    /**
+     * \brief Add a task that runs after all of its dependencies.
+     *
+     * \param[in] work         The work of the task, a callable that is copied bytewise into the task, so it has to be
+     *                         trivially copyable and at most \c max_work_size bytes
+     * \param[in] dependencies Tasks that have to complete before this one starts; \c none entries are ignored
+     * \param[in] uses_pool    The task runs loops on the thread pool itself
+     *
+     * \return The id of the task, to be used as a dependency of later tasks
+     */
+    template <typename Work>
+    TaskId add(Work const& work, std::initializer_list<TaskId> dependencies = {}, bool uses_pool = false);
+
+    /**
+     * \brief Run all tasks and wait until they have completed. The tasks must not throw.
+     */
+    void run();
+
+    /**
+     * \brief Remove all tasks.
+     */
+    void clear();
+
+    size_t size() const { return m_tasks.size(); }
+
+private:
+    struct Task
+    {
+        alignas(std::max_align_t) std::byte work[max_work_size]; // The callable, copied bytewise
+        void (*call)(std::byte const*) = nullptr;                 // Calls the callable stored in work
+
+        uint32_t wave      = 0;
+        bool     uses_pool = false;
+    };
+
+    Task& add_task(std::initializer_list<TaskId> dependencies, bool uses_pool);
+
+    std::vector<Task>   m_tasks;
+    uint32_t            m_wave_count = 0;
+    std::vector<TaskId> m_wave_tasks; // Scratch list of the tasks of one wave
+};
+
+template <typename Work>
+TaskGraph::TaskId TaskGraph::add(Work const& work, std::initializer_list<TaskId> dependencies, bool uses_pool)
+{
+    static_assert(sizeof(Work) <= max_work_size && alignof(Work) <= alignof(std::max_align_t), "The work of a task is too large");
+    static_assert(std::is_trivially_copyable_v<Work>, "The work of a task is copied bytewise and never destroyed");
+
+    Task& task = add_task(dependencies, uses_pool);
+    std::memcpy(task.work, &work, sizeof(Work));
+    task.call = [](std::byte const* stored) { (*std::launder(reinterpret_cast<Work const*>(stored)))(); };
+    return static_cast<TaskId>(m_tasks.size() - 1);
+}
+
+} // namespace ex2
@@ -0,0 +1,208 @@
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace ex2
+{
+
+namespace
+{
+
+thread_local bool is_inside_parallel_for = false;
+
+unsigned int default_worker_count = std::max(1u, std::thread::hardware_concurrency()) - 1;
+
+constexpr uint64_t pack_range(uint32_t front, uint32_t back)
+{
+    return static_cast<uint64_t>(front) | (static_cast<uint64_t>(back) << 32);
+}
+
+constexpr uint32_t range_front(uint64_t range)
+{
+    return static_cast<uint32_t>(range);
+}
+
+constexpr uint32_t range_back(uint64_t range)
+{
+    return static_cast<uint32_t>(range >> 32);
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(unsigned int worker_count)
+    : m_queues(new ChunkQueue[worker_count + 1])
+{
+    m_workers.reserve(worker_count);
+    for (unsigned int i = 0; i < worker_count; i++)
+    {
+        m_workers.emplace_back(&ThreadPool::worker_main, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+
+    for (std::thread& worker : m_workers)
+        worker.join();
+}
+
+void ThreadPool::parallel_for(size_t count, size_t chunk_size, RangeFunctionRef body)
+{
+    if (count == 0)
+        return;
+
+    chunk_size         = std::max<size_t>(chunk_size, 1);
+    size_t chunk_count = (count + chunk_size - 1) / chunk_size;
+
+    if (m_workers.empty() || chunk_count == 1 || is_inside_parallel_for)
+    {
+        body(0, count);
+        return;
+    }
+
+    // Chunk indices are stored in 32 bits, grow the chunks for huge ranges
+    size_t const max_chunks = std::numeric_limits<uint32_t>::max();
+    if (chunk_count > max_chunks)
+    {
+        chunk_size  = (count + max_chunks - 1) / max_chunks;
+        chunk_count = (count + chunk_size - 1) / chunk_size;
+    }
+
+    std::lock_guard<std::mutex> call_lock(m_call_mutex);
+
+    m_body       = &body;
+    m_count      = count;
+    m_chunk_size = chunk_size;
+    m_remaining_chunks.store(chunk_count, std::memory_order_relaxed);
+
+    // Every participant starts with a contiguous block of chunks
+    unsigned int participants = worker_count() + 1;
+    for (unsigned int p = 0; p < participants; p++)
+    {
+        uint32_t front = static_cast<uint32_t>(chunk_count * p / participants);
+        uint32_t back  = static_cast<uint32_t>(chunk_count * (p + 1) / participants);
+        m_queues[p].range.store(pack_range(front, back), std::memory_order_relaxed);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // Workers count as active until they have looked at this job, so none can touch it after we return
+        m_active_workers.store(worker_count(), std::memory_order_relaxed);
+        m_generation++;
+    }
+    m_wake.notify_all();
+
+    is_inside_parallel_for = true;
+    run_participant(worker_count());
+    is_inside_parallel_for = false;
+
+    while (m_remaining_chunks.load(std::memory_order_acquire) != 0 ||
+           m_active_workers.load(std::memory_order_acquire) != 0)
+    {
+        std::this_thread::yield();
+    }
+
+    m_body = nullptr;
+}
+
+void ThreadPool::worker_main(unsigned int index)
+{
+    is_inside_parallel_for = true;
+
+    uint64_t seen_generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&]() { return m_stop || m_generation != seen_generation; });
+            if (m_stop)
+                return;
+            seen_generation = m_generation;
+        }
+
+        run_participant(index);
+        m_active_workers.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+void ThreadPool::run_participant(unsigned int index)
+{
+    uint32_t chunk;
+    while (pop_front(index, &chunk))
+        run_chunk(chunk);
+
+    // Own block done, steal from the back of the other blocks until all are empty
+    unsigned int participants = worker_count() + 1;
+    bool         found_work   = true;
+    while (found_work)
+    {
+        found_work = false;
+        for (unsigned int offset = 1; offset < participants; offset++)
+        {
+            unsigned int victim = (index + offset) % participants;
+            while (pop_back(victim, &chunk))
+            {
+                run_chunk(chunk);
+                found_work = true;
+            }
+        }
+    }
+}
+
+bool ThreadPool::pop_front(unsigned int queue, uint32_t* chunk)
+{
+    std::atomic<uint64_t>& range   = m_queues[queue].range;
+    uint64_t               current = range.load(std::memory_order_relaxed);
+    while (range_front(current) < range_back(current))
+    {
+        if (range.compare_exchange_weak(current, pack_range(range_front(current) + 1, range_back(current)), std::memory_order_acquire))
+        {
+            *chunk = range_front(current);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ThreadPool::pop_back(unsigned int queue, uint32_t* chunk)
+{
+    std::atomic<uint64_t>& range   = m_queues[queue].range;
+    uint64_t               current = range.load(std::memory_order_relaxed);
+    while (range_front(current) < range_back(current))
+    {
+        if (range.compare_exchange_weak(current, pack_range(range_front(current), range_back(current) - 1), std::memory_order_acquire))
+        {
+            *chunk = range_back(current) - 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::run_chunk(uint32_t chunk)
+{
+    size_t begin = static_cast<size_t>(chunk) * m_chunk_size;
+    size_t end   = std::min(m_count, begin + m_chunk_size);
+
+    (*m_body)(begin, end);
+    m_remaining_chunks.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void configure_default_thread_pool(unsigned int worker_count)
+{
+    default_worker_count = worker_count;
+}
+
+ThreadPool& default_thread_pool()
+{
+    static ThreadPool pool(default_worker_count);
+    return pool;
+}
+
+} // namespace ex2
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ex2
+{
+
+/**
+ * \brief Non-owning reference to a callable with the signature `void(size_t begin, size_t end)`.
+ *
+ * Unlike \c std::function it never allocates: it stores a pointer to the callable and a function that calls it. The
+ * callable must outlive the reference, which holds for the loop bodies passed down to \c ThreadPool::parallel_for(...).
+ */
+class RangeFunctionRef
+{
+public:
+    template <typename Function>
+    RangeFunctionRef(Function const& function)
+        : m_function(&function),
+          m_call([](void const* f, size_t begin, size_t end) { (*static_cast<Function const*>(f))(begin, end); })
+    {
+    }
+
+    void operator()(size_t begin, size_t end) const { m_call(m_function, begin, end); }
+
+private:
+    void const* m_function;
+    void (*m_call)(void const*, size_t, size_t);
+};
+
+/**
+ * \brief Persistent pool of worker threads that runs loops over index ranges in parallel.
+ *
+ * A call to \c parallel_for(...) splits the range into chunks and hands every participant (the workers and the calling
+ * thread) a contiguous block of chunks. Participants that run out of work steal chunks from the back of other blocks,
+ * so uneven chunk costs are balanced without a central queue.
+ *
+ * Every index is processed by exactly one call of the loop body, so loops that write element \c i only from index \c i
+ * produce the same output regardless of the number of workers or the scheduling.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * \param[in] worker_count Number of worker threads in addition to the calling thread; 0 runs everything on the calling thread
+     */
+    explicit ThreadPool(unsigned int worker_count);
+    ~ThreadPool();
+
+    ThreadPool(ThreadPool const&)            = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+
+    unsigned int worker_count() const { return static_cast<unsigned int>(m_workers.size()); }
+
+    /**
+     * \brief Call \c body for consecutive sub-ranges of [0, count) in parallel and wait until all calls have returned.
+     *
+     * Calls made from inside a loop body run serially on the calling thread. The body must not throw.
+     *
+     * \param[in] count      Size of the index range
+     * \param[in] chunk_size Number of indices passed to a single call of \c body
+     * \param[in] body       Function called with the sub-ranges [begin, end)
+     */
+    void parallel_for(size_t count, size_t chunk_size, RangeFunctionRef body);
+
+private:
+    struct alignas(64) ChunkQueue
+    {
+        // Remaining chunks [front, back) packed into one word, so the owner and thieves can update it with a single CAS
+        std::atomic<uint64_t> range{0};
+    };
+
+    void worker_main(unsigned int index);
+    void run_participant(unsigned int index);
+    bool pop_front(unsigned int queue, uint32_t* chunk);
+    bool pop_back(unsigned int queue, uint32_t* chunk);
+    void run_chunk(uint32_t chunk);
+
+    std::vector<std::thread>      m_workers;
+    std::unique_ptr<ChunkQueue[]> m_queues; // One per worker, plus one for the calling thread
+
+    std::mutex              m_call_mutex; // Serializes calls to parallel_for from different threads
+    std::mutex              m_mutex;
+    std::condition_variable m_wake;
+    uint64_t                m_generation = 0;
+    bool                    m_stop       = false;
+
+    RangeFunctionRef const* m_body       = nullptr;
+    size_t                  m_count      = 0;
+    size_t                  m_chunk_size = 0;
+    std::atomic<size_t>     m_remaining_chunks{0};
+    std::atomic<unsigned>   m_active_workers{0};
+};
+
+//! Largest number of workers accepted on the command line
+constexpr unsigned int max_worker_count = 1024;
+
+/**
+ * \brief Set the number of workers of the pool returned by \c default_thread_pool().
+ *
+ * Must be called before the first call to \c default_thread_pool() to have an effect. By default, the pool has one
+ * worker less than the number of hardware threads, since the calling thread participates in the work.
+ */
+void configure_default_thread_pool(unsigned int worker_count);
+
+/**
+ * \brief The thread pool shared by the vertex processing stages.
+ */
+ThreadPool& default_thread_pool();
+
+/**
+ * \brief Run \c body over [0, count) in chunks on the default thread pool, or serially if \c count is below \c serial_threshold.
+ *
+ * Small inputs skip the pool entirely, so they do not pay for waking up and synchronizing workers, and call \c body
+ * directly. Neither path allocates: the pool receives the body through a \c RangeFunctionRef.
+ */
+template <typename Function>
+void parallel_for(size_t count, size_t serial_threshold, size_t chunk_size, Function const& body)
+{
+    if (count < serial_threshold)
+    {
+        body(size_t(0), count);
+        return;
+    }
+
+    default_thread_pool().parallel_for(count, chunk_size, RangeFunctionRef(body));
+}
+
+} // namespace ex2
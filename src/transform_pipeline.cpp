@@ -0,0 +1,79 @@
+#include "transform_pipeline.hpp"
+
+#include <algorithm>
+
+#include "thread_pool.hpp"
+
+namespace ex2
+{
+
+void TransformPipeline::run(std::span<glm::vec3 const> positions, glm::mat4 const& view_matrix, glm::mat4 const& projection_matrix)
+{
+    transform(positions, view_matrix, projection_matrix);
+}
+
+void TransformPipeline::run(std::span<glm::u16vec3 const> positions, glm::mat4 const& decode_matrix, glm::mat4 const& view_matrix, glm::mat4 const& projection_matrix)
+{
+    // Decoding is folded into the view matrix, so the vertex loop is the same as for float positions
+    transform(positions, view_matrix * decode_matrix, projection_matrix);
+}
+
+template <typename Position>
+void TransformPipeline::transform(std::span<Position const> positions, glm::mat4 const& view_matrix, glm::mat4 const& projection_matrix)
+{
+    // Buffers only ever grow, so steady-state frames do not touch the allocator
+    if (positions.size() > m_view.size())
+    {
+        m_view.resize(positions.size());
+        m_clip.resize(positions.size());
+        m_ndc.resize(positions.size());
+        m_soa_points.resize(positions.size());
+        m_soa_clip.resize(positions.size());
+        m_soa_ndc.resize(positions.size());
+    }
+    m_size = positions.size();
+
+    parallel_for(m_size, parallel_threshold, parallel_chunk_size, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            glm::vec3 p       = glm::vec3(positions[i]);
+            m_soa_points.x[i]    = p.x;
+            m_soa_points.y[i]    = p.y;
+            m_soa_points.z[i]    = p.z;
+        }
+
+        // The view matrix is affine, so w is exactly 1 and the projection of the view space positions equals the
+        // projection of the homogeneous ones
+        simd::transform_points(view_matrix, m_soa_points, &m_soa_clip, begin, end);
+        std::copy(m_soa_clip.x.begin() + begin, m_soa_clip.x.begin() + end, m_soa_points.x.begin() + begin);
+        std::copy(m_soa_clip.y.begin() + begin, m_soa_clip.y.begin() + end, m_soa_points.y.begin() + begin);
+        std::copy(m_soa_clip.z.begin() + begin, m_soa_clip.z.begin() + end, m_soa_points.z.begin() + begin);
+
+        project(projection_matrix, begin, end, true);
+    });
+}
+
+void TransformPipeline::reproject(glm::mat4 const& projection_matrix)
+{
+    // The view space positions of the last run are still in SoA layout
+    parallel_for(m_size, parallel_threshold, parallel_chunk_size, [&](size_t begin, size_t end) {
+        project(projection_matrix, begin, end, false);
+    });
+}
+
+void TransformPipeline::project(glm::mat4 const& projection_matrix, size_t begin, size_t end, bool write_view)
+{
+    simd::transform_points(projection_matrix, m_soa_points, &m_soa_clip, begin, end);
+    simd::perspective_divide(m_soa_clip, &m_soa_ndc, begin, end);
+
+    // The outputs are read in AoS layout by the clipper, the culling and the renderers
+    for (size_t i = begin; i < end; i++)
+    {
+        if (write_view)
+            m_view[i] = glm::vec3(m_soa_points.x[i], m_soa_points.y[i], m_soa_points.z[i]);
+        m_clip[i] = glm::vec4(m_soa_clip.x[i], m_soa_clip.y[i], m_soa_clip.z[i], m_soa_clip.w[i]);
+        m_ndc[i]  = glm::vec3(m_soa_ndc.x[i], m_soa_ndc.y[i], m_soa_ndc.z[i]);
+    }
+}
+
+} // namespace ex2
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "simd_transform.hpp"
+
+namespace ex2
+{
+
+/**
+ * \brief Transforms vertex positions to view space, clip space and normalized device coordinates in a single pass.
+ *
+ * The pipeline owns its output buffers and reuses them from frame to frame. Once the buffers have grown to
+ * the size of the largest input, running the pipeline does not allocate memory anymore.
+ *
+ * The positions are transformed in structure-of-arrays layout by the kernels of \c simd_transform.hpp, chunk by chunk,
+ * and written to the array-of-structures outputs. Inputs with at least \c parallel_threshold positions are split into
+ * chunks and transformed on the default thread pool.
+ */
+class TransformPipeline
+{
+public:
+    //! Inputs below this size are transformed serially on the calling thread
+    static constexpr size_t parallel_threshold = size_t(1) << 14;
+    //! Number of positions transformed by a single task
+    static constexpr size_t parallel_chunk_size = size_t(1) << 12;
+
+    /**
+     * \brief Transform all positions with the given matrices.
+     *
+     * For every input position `p` the outputs are
+     *  - view: `view_matrix * p`
+     *  - clip: `projection_matrix * view_matrix * p`
+     *  - ndc:  `clip / clip.w` (or `clip.xyz` if `clip.w == 0`)
+     *
+     * \param[in] positions         The vertex positions in world space
+     * \param[in] view_matrix       The view matrix of the camera, which has to be affine
+     * \param[in] projection_matrix The projection matrix of the camera
+     */
+    void run(std::span<glm::vec3 const> positions, glm::mat4 const& view_matrix, glm::mat4 const& projection_matrix);
+
+    /**
+     * \brief Transform 16-bit quantized positions, as produced by \c quantize_mesh(...).
+     *
+     * The positions are decoded on the fly, which reads half the memory of float positions.
+     *
+     * \param[in] positions         The quantized vertex positions
+     * \param[in] decode_matrix     The matrix restoring the world space positions from the quantized ones
+     * \param[in] view_matrix       The view matrix of the camera
+     * \param[in] projection_matrix The projection matrix of the camera
+     */
+    void run(std::span<glm::u16vec3 const> positions, glm::mat4 const& decode_matrix, glm::mat4 const& view_matrix, glm::mat4 const& projection_matrix);
+
+    /**
+     * \brief Recompute only the clip space and NDC outputs from the view space positions of the last call to \c run(...).
+     *
+     * Use this when only the projection matrix has changed since the last call to \c run(...).
+     *
+     * \param[in] projection_matrix The projection matrix of the camera
+     */
+    void reproject(glm::mat4 const& projection_matrix);
+
+    /**
+     * \brief Positions in view space computed by the last call to \c run(...)
+     */
+    std::span<glm::vec3 const> view() const { return {m_view.data(), m_size}; }
+
+    /**
+     * \brief Homogeneous positions in clip space computed by the last call to \c run(...)
+     */
+    std::span<glm::vec4 const> clip() const { return {m_clip.data(), m_size}; }
+
+    /**
+     * \brief Positions in normalized device coordinates computed by the last call to \c run(...)
+     */
+    std::span<glm::vec3 const> ndc() const { return {m_ndc.data(), m_size}; }
+
+private:
+    template <typename Position>
+    void transform(std::span<Position const> positions, glm::mat4 const& view_matrix, glm::mat4 const& projection_matrix);
+
+    //! Project the view space positions in [begin, end) of \c m_soa_points and write the outputs
+    void project(glm::mat4 const& projection_matrix, size_t begin, size_t end, bool write_view);
+
+    std::vector<glm::vec3> m_view;
+    std::vector<glm::vec4> m_clip;
+    std::vector<glm::vec3> m_ndc;
+    size_t                 m_size = 0;
+
+    simd::Positions            m_soa_points; // The input positions, then their view space positions
+    simd::HomogeneousPositions m_soa_clip;
+    simd::Positions            m_soa_ndc;
+};
+
+} // namespace ex2
@@ -0,0 +1,250 @@
+#include "triangle_clipper.hpp"
+
+#include <algorithm>
+
+namespace ex2
+{
+
+namespace
+{
+
+constexpr int plane_count = 6;
+
+/**
+ * Signed distance of a homogeneous point to a plane of the view volume, positive inside.
+ * The planes are, in order: left, right, bottom, top, near, far.
+ */
+float plane_distance(glm::vec4 const& p, int plane)
+{
+    switch (plane)
+    {
+    case 0:
+        return p.w + p.x;
+    case 1:
+        return p.w - p.x;
+    case 2:
+        return p.w + p.y;
+    case 3:
+        return p.w - p.y;
+    case 4:
+        return p.w + p.z;
+    default:
+        return p.w - p.z;
+    }
+}
+
+uint8_t outcode(glm::vec4 const& p)
+{
+    uint8_t code = 0;
+    for (int plane = 0; plane < plane_count; plane++)
+    {
+        if (plane_distance(p, plane) < 0.f)
+            code |= static_cast<uint8_t>(1 << plane);
+    }
+    return code;
+}
+
+/**
+ * A polygon vertex, remembering the index of the input vertex it came from so unclipped vertices are not duplicated.
+ */
+struct PolygonVertex
+{
+    glm::vec4 position;
+    uint32_t  index;
+};
+
+constexpr uint32_t new_vertex = ~uint32_t(0);
+
+// Clipping a triangle against six planes adds at most one vertex per plane
+constexpr size_t max_polygon_size = 3 + plane_count;
+
+} // namespace
+
+void TriangleClipper::run(std::span<glm::vec4 const> clip, std::span<glm::vec3 const> ndc, std::span<glm::u32vec3 const> triangles, ClipOptions const& options)
+{
+    m_stats      = Stats();
+    m_input_clip = clip;
+    m_input_ndc  = ndc;
+
+    // Clearing keeps the capacity, so steady-state frames do not allocate
+    m_new_clip.clear();
+    m_new_ndc.clear();
+    m_indices.clear();
+
+    m_clip_output = clip;
+    m_ndc_output  = ndc;
+
+    if (!options.enabled)
+    {
+        m_indices_output = triangles;
+        m_stats.accepted = triangles.size();
+        m_stats.emitted  = triangles.size();
+        return;
+    }
+
+    m_outcodes.resize(clip.size());
+    for (size_t i = 0; i < clip.size(); i++)
+        m_outcodes[i] = outcode(clip[i]);
+
+    for (glm::u32vec3 const& triangle : triangles)
+    {
+        uint8_t a = m_outcodes[triangle.x];
+        uint8_t b = m_outcodes[triangle.y];
+        uint8_t c = m_outcodes[triangle.z];
+
+        if ((a | b | c) == 0)
+        {
+            m_stats.accepted++;
+            emit_triangle(triangle.x, triangle.y, triangle.z, options.cull_back_faces);
+        }
+        else if ((a & b & c) != 0)
+        {
+            m_stats.rejected++;
+        }
+        else
+        {
+            m_stats.clipped++;
+            clip_triangle(triangle, options.cull_back_faces);
+        }
+    }
+
+    if (!m_new_clip.empty())
+        compact();
+    m_indices_output = m_indices;
+}
+
+void TriangleClipper::clip_triangle(glm::u32vec3 const& triangle, bool cull_back_faces)
+{
+    PolygonVertex buffers[2][max_polygon_size];
+    PolygonVertex* polygon = buffers[0];
+    PolygonVertex* output  = buffers[1];
+    size_t         size    = 3;
+
+    for (int i = 0; i < 3; i++)
+        polygon[i] = {m_input_clip[triangle[i]], triangle[i]};
+
+    uint8_t crossed = m_outcodes[triangle.x] | m_outcodes[triangle.y] | m_outcodes[triangle.z];
+
+    // Sutherland-Hodgman, only against the planes the triangle crosses
+    for (int plane = 0; plane < plane_count && size > 0; plane++)
+    {
+        if (!(crossed & (1 << plane)))
+            continue;
+
+        size_t output_size = 0;
+        for (size_t i = 0; i < size; i++)
+        {
+            PolygonVertex const& current = polygon[i];
+            PolygonVertex const& next    = polygon[(i + 1) % size];
+
+            float d_current = plane_distance(current.position, plane);
+            float d_next    = plane_distance(next.position, plane);
+
+            if (d_current >= 0.f)
+                output[output_size++] = current;
+
+            if ((d_current >= 0.f) != (d_next >= 0.f))
+            {
+                float t               = d_current / (d_current - d_next);
+                output[output_size++] = {glm::mix(current.position, next.position, t), new_vertex};
+            }
+        }
+
+        std::swap(polygon, output);
+        size = output_size;
+    }
+
+    if (size < 3)
+        return;
+
+    // Add the new vertices, then triangulate the convex polygon as a fan
+    uint32_t indices[max_polygon_size];
+    for (size_t i = 0; i < size; i++)
+    {
+        if (polygon[i].index != new_vertex)
+        {
+            indices[i] = polygon[i].index;
+            continue;
+        }
+
+        glm::vec4 const& p = polygon[i].position;
+        indices[i]         = static_cast<uint32_t>(m_input_clip.size() + m_new_clip.size());
+        m_new_clip.push_back(p);
+        m_new_ndc.push_back(p.w != 0.0f ? glm::vec3(p) / p.w : glm::vec3(p));
+    }
+
+    for (size_t i = 1; i + 1 < size; i++)
+        emit_triangle(indices[0], indices[i], indices[i + 1], cull_back_faces);
+}
+
+void TriangleClipper::emit_triangle(uint32_t a, uint32_t b, uint32_t c, bool cull_back_faces)
+{
+    if (cull_back_faces)
+    {
+        // Front faces are counter-clockwise in NDC
+        glm::vec3 const& pa   = ndc_vertex(a);
+        glm::vec3 const& pb   = ndc_vertex(b);
+        glm::vec3 const& pc   = ndc_vertex(c);
+        float            area = (pb.x - pa.x) * (pc.y - pa.y) - (pc.x - pa.x) * (pb.y - pa.y);
+
+        if (area <= 0.f)
+        {
+            m_stats.culled++;
+            return;
+        }
+    }
+
+    m_indices.emplace_back(a, b, c);
+    m_stats.emitted++;
+}
+
+void TriangleClipper::compact()
+{
+    uint32_t const input_size = static_cast<uint32_t>(m_input_clip.size());
+    uint32_t const unused     = ~uint32_t(0);
+
+    // Only the input vertices of visible triangles are copied, which are few when most of the mesh is outside
+    m_remap.assign(input_size, unused);
+    m_clip.clear();
+    m_ndc.clear();
+    for (glm::u32vec3& triangle : m_indices)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            uint32_t index = triangle[k];
+            if (index >= input_size)
+                continue;
+
+            if (m_remap[index] == unused)
+            {
+                m_remap[index] = static_cast<uint32_t>(m_clip.size());
+                m_clip.push_back(m_input_clip[index]);
+                m_ndc.push_back(m_input_ndc[index]);
+            }
+            triangle[k] = m_remap[index];
+        }
+    }
+
+    // The created vertices follow the used input vertices
+    uint32_t const new_base = static_cast<uint32_t>(m_clip.size());
+    m_clip.insert(m_clip.end(), m_new_clip.begin(), m_new_clip.end());
+    m_ndc.insert(m_ndc.end(), m_new_ndc.begin(), m_new_ndc.end());
+    for (glm::u32vec3& triangle : m_indices)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            if (triangle[k] >= input_size)
+                triangle[k] = triangle[k] - input_size + new_base;
+        }
+    }
+
+    m_clip_output = m_clip;
+    m_ndc_output  = m_ndc;
+}
+
+glm::vec3 const& TriangleClipper::ndc_vertex(uint32_t index) const
+{
+    return index < m_input_ndc.size() ? m_input_ndc[index] : m_new_ndc[index - m_input_ndc.size()];
+}
+
+} // namespace ex2
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace ex2
+{
+
+/**
+ * \brief Options of the clipping stage.
+ */
+struct ClipOptions
+{
+    bool enabled         = true;  //!< Clip triangles to the view volume; if disabled all triangles are passed through
+    bool cull_back_faces = false; //!< Drop triangles that are clockwise in NDC
+
+    bool operator==(ClipOptions const&) const = default;
+};
+
+/**
+ * \brief Clips triangles in homogeneous clip space against the canonical view volume (-w <= x, y, z <= w).
+ *
+ * Triangles entirely inside the view volume are kept as they are and triangles entirely outside one of its planes are
+ * dropped, both decided by the outcodes of their vertices. The remaining triangles are clipped against the planes they
+ * cross and the resulting polygons are triangulated, which adds new vertices.
+ *
+ * The output consists of a vertex buffer and a compacted index buffer with the visible triangles only. As long as no
+ * vertices are created, the vertex buffer is a view of the input vertices, and if clipping is disabled the index buffer
+ * is a view of the input triangles as well, so the inputs must stay valid while the output is used. Otherwise the vertex
+ * buffer holds the input vertices used by the visible triangles, in the order they are first used, followed by the
+ * vertices created by clipping, which are kept apart while clipping. All buffers are reused from call to call.
+ */
+class TriangleClipper
+{
+public:
+    struct Stats
+    {
+        size_t accepted = 0; //!< Triangles inside the view volume
+        size_t rejected = 0; //!< Triangles outside the view volume
+        size_t clipped  = 0; //!< Triangles crossing the boundary of the view volume
+        size_t culled   = 0; //!< Back-facing triangles that were dropped
+        size_t emitted  = 0; //!< Triangles in the output index buffer
+    };
+
+    /**
+     * \brief Clip triangles and optionally cull back faces.
+     *
+     * \param[in] clip      Vertex positions in clip space
+     * \param[in] ndc       Vertex positions in normalized device coordinates (`clip / clip.w`)
+     * \param[in] triangles Vertex indices of the triangles
+     * \param[in] options   Clipping options; if clipping is disabled the input is passed through unchanged
+     */
+    void run(std::span<glm::vec4 const> clip, std::span<glm::vec3 const> ndc, std::span<glm::u32vec3 const> triangles, ClipOptions const& options);
+
+    //! Clip space positions of the vertices of \c indices()
+    std::span<glm::vec4 const> clip() const { return m_clip_output; }
+    //! NDC positions of the vertices of \c indices()
+    std::span<glm::vec3 const> ndc() const { return m_ndc_output; }
+    //! Indices of the visible triangles
+    std::span<glm::u32vec3 const> indices() const { return m_indices_output; }
+
+    Stats const& stats() const { return m_stats; }
+
+private:
+    void             clip_triangle(glm::u32vec3 const& triangle, bool cull_back_faces);
+    void             emit_triangle(uint32_t a, uint32_t b, uint32_t c, bool cull_back_faces);
+    void             compact();
+    glm::vec3 const& ndc_vertex(uint32_t index) const;
+
+    std::span<glm::vec4 const> m_input_clip;
+    std::span<glm::vec3 const> m_input_ndc;
+
+    std::vector<glm::vec4>    m_new_clip; // Vertices created by clipping, with indices after the input vertices
+    std::vector<glm::vec3>    m_new_ndc;
+    std::vector<glm::vec4>    m_clip;     // Compacted vertices, only used if vertices were created
+    std::vector<glm::vec3>    m_ndc;
+    std::vector<glm::u32vec3> m_indices;
+    std::vector<uint32_t>     m_remap;    // New index of every input vertex while compacting
+    std::vector<uint8_t>      m_outcodes;
+
+    std::span<glm::vec4 const>    m_clip_output;
+    std::span<glm::vec3 const>    m_ndc_output;
+    std::span<glm::u32vec3 const> m_indices_output;
+    Stats                         m_stats;
+};
+
+} // namespace ex2